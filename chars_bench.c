@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "softposit.h"
+
+//Decimal formatting and parsing speed, and exact round trips: every p8,
+//p16 and pX2 (x <= 20) pattern, minpos and maxpos of every pX2 width, and
+//n random p32/p64 patterns.
+//  ./chars_bench [n]
+
+static double now(){
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + 1e-9*t.tv_nsec;
+}
+
+static uint64_t rng = 88172645463325252ULL;
+
+static uint64_t next(){
+	rng ^= rng << 13;
+	rng ^= rng >> 7;
+	rng ^= rng << 17;
+	return rng;
+}
+
+static size_t roundTripPX2(uint32_t v, int x){
+	char buf[64], *end;
+	posit_2_t a, b;
+
+	a.v = v;
+	b.v = ~v;
+	end = pX2_to_chars(buf, buf + sizeof buf, a, x);
+	if (!end || pX2_from_chars(buf, end, &b, x)!=end || b.v!=a.v) {
+		printf("pX2 x=%d: %08x -> \"%.*s\" -> %08x\n", x, a.v, end ? (int)(end-buf) : 0, buf, b.v);
+		return 1;
+	}
+	return 0;
+}
+
+//Formats n values into one buffer, parses them back and compares
+#define ROUND_TRIP(N, a, n, mismatches) do { \
+	char *text = malloc(32*(n) + 1), *end; \
+	posit##N##_t *back = malloc((n)*sizeof *back + 1); \
+	const char *stop; \
+	double t0, tOut, tIn; \
+	size_t written, read, j; \
+	\
+	t0 = now(); \
+	written = p##N##_to_chars_n(text, text + 32*(n), a, n, ' ', &end); \
+	tOut = now() - t0; \
+	t0 = now(); \
+	read = p##N##_from_chars_n(text, end, back, n, 1, &stop); \
+	tIn = now() - t0; \
+	mismatches += (written!=(n)) + (read!=(n)); \
+	for (j=0; j<read && j<(n); j++) mismatches += back[j].v!=(a)[j].v; \
+	printf("posit%-2d %zu values: to_chars %.1f ns/value, from_chars %.1f ns/value\n", \
+		N, (size_t)(n), 1e9*tOut/(n), 1e9*tIn/(n)); \
+	free(text); \
+	free(back); \
+} while (0)
+
+int main(int argc, char **argv){
+	size_t n = (argc>1) ? strtoul(argv[1], 0, 10) : 1<<20, i, mismatches = 0;
+	posit8_t *a8 = malloc(256*sizeof *a8);
+	posit16_t *a16 = malloc(65536*sizeof *a16);
+	posit32_t *a32;
+	posit64_t *a64;
+	uint32_t v;
+	int x;
+
+	if (n<1) n = 1;
+	a32 = malloc(n*sizeof *a32);
+	a64 = malloc(n*sizeof *a64);
+	for (i=0; i<256; i++) a8[i].v = (uint8_t) i;
+	for (i=0; i<65536; i++) a16[i].v = (uint16_t) i;
+	for (i=0; i<n; i++) {
+		a32[i].v = (uint32_t) next();
+		a64[i].v = next();
+	}
+	ROUND_TRIP(8, a8, 256, mismatches);
+	ROUND_TRIP(16, a16, 65536, mismatches);
+	ROUND_TRIP(32, a32, n, mismatches);
+	ROUND_TRIP(64, a64, n, mismatches);
+
+	for (x=2; x<=32; x++) {
+		if (x<=20)
+			for (v=0; v < 1u<<x; v++) mismatches += roundTripPX2(v<<(32-x), x);
+		//minpos and maxpos, both signs
+		mismatches += roundTripPX2(1u<<(32-x), x);
+		mismatches += roundTripPX2(-(1u<<(32-x)), x);
+		mismatches += roundTripPX2(0x80000000u - (1u<<(32-x)), x);
+		mismatches += roundTripPX2(0x80000000u + (1u<<(32-x)), x);
+	}
+	printf("%zu round-trip mismatches\n", mismatches);
+
+	free(a8);
+	free(a16);
+	free(a32);
+	free(a64);
+	return mismatches!=0;
+}
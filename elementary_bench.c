@@ -0,0 +1,89 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "softposit.h"
+
+//Throughput of the posit elementary functions, next to the round trip
+//through libm that they replace:
+//  ./elementary_bench [n] [repeats]
+
+static double now(){
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + 1e-9*t.tv_nsec;
+}
+
+#define TIME(name, call) do { \
+	double t0, best = 1e30; \
+	int r; \
+	for (r=0; r<repeats; r++) { \
+		t0 = now(); \
+		call; \
+		t0 = now() - t0; \
+		if (t0<best) best = t0; \
+	} \
+	printf("%-18s %7.2f ns/element\n", name, 1e9*best/n); \
+} while (0)
+
+//Each function against convert, libm, convert on the same arguments
+#define UNARY(N, f) do { \
+	TIME("p" #N "_" #f "_n", p##N##_##f##_n(x##N, n, y##N)); \
+	TIME("  via double", for (i=0; i<n; i++) \
+		z##N[i] = convertDoubleToP##N(f(convertP##N##ToDouble(x##N[i])))); \
+} while (0)
+
+#define BINARY(N, f) do { \
+	TIME("p" #N "_" #f "_n", p##N##_##f##_n(x##N, w##N, n, y##N)); \
+	TIME("  via double", for (i=0; i<n; i++) \
+		z##N[i] = convertDoubleToP##N(f(convertP##N##ToDouble(x##N[i]), convertP##N##ToDouble(w##N[i])))); \
+} while (0)
+
+int main(int argc, char **argv) {
+	size_t n = (argc>1) ? strtoul(argv[1], 0, 10) : 1<<18, i;
+	int repeats = (argc>2) ? atoi(argv[2]) : 10;
+	posit32_t *x32 = malloc(n*sizeof *x32 + 1), *w32 = malloc(n*sizeof *w32 + 1);
+	posit32_t *y32 = malloc(n*sizeof *y32 + 1), *z32 = malloc(n*sizeof *z32 + 1);
+	posit64_t *x64 = malloc(n*sizeof *x64 + 1), *w64 = malloc(n*sizeof *w64 + 1);
+	posit64_t *y64 = malloc(n*sizeof *y64 + 1), *z64 = malloc(n*sizeof *z64 + 1);
+
+	//Positive arguments over a few decades, so log and pow stay in their domain
+	srand(1);
+	for (i=0; i<n; i++) {
+		double a = exp(8.0*rand()/RAND_MAX - 4.0), b = 6.0*rand()/RAND_MAX - 3.0;
+		x32[i] = convertDoubleToP32(a);
+		w32[i] = convertDoubleToP32(b);
+		x64[i] = convertDoubleToP64(a);
+		w64[i] = convertDoubleToP64(b);
+	}
+
+	UNARY(32, exp);
+	UNARY(32, exp2);
+	UNARY(32, log);
+	UNARY(32, log2);
+	UNARY(32, sin);
+	UNARY(32, cos);
+	UNARY(32, tanh);
+	BINARY(32, pow);
+	BINARY(32, atan2);
+
+	UNARY(64, exp);
+	UNARY(64, exp2);
+	UNARY(64, log);
+	UNARY(64, log2);
+	UNARY(64, sin);
+	UNARY(64, cos);
+	UNARY(64, tanh);
+	BINARY(64, pow);
+	BINARY(64, atan2);
+
+	free(x32);
+	free(w32);
+	free(y32);
+	free(z32);
+	free(x64);
+	free(w64);
+	free(y64);
+	free(z64);
+	return 0;
+}
@@ -0,0 +1,61 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "softposit.h"
+
+//Cost of inexact tracking: build the library with `make all` and with
+//`make exact`, link this file against each and compare the timings.
+//  ./exact_bench [n] [repeats]
+
+static double now(){
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + 1e-9*t.tv_nsec;
+}
+
+#define TIME(name, call) do { \
+	double t0, best = 1e30; \
+	int r; \
+	for (r=0; r<repeats; r++) { \
+		t0 = now(); \
+		call; \
+		t0 = now() - t0; \
+		if (t0<best) best = t0; \
+	} \
+	printf("%-14s %7.2f ns/element\n", name, 1e9*best/n); \
+} while (0)
+
+int main(int argc, char **argv) {
+	size_t n = (argc>1) ? strtoul(argv[1], 0, 10) : 1<<20, i;
+	int repeats = (argc>2) ? atoi(argv[2]) : 20;
+	posit32_t *a = malloc(n*sizeof *a), *b = malloc(n*sizeof *b), *c = malloc(n*sizeof *c), *z = malloc(n*sizeof *z);
+	posit16_t *a16 = malloc(n*sizeof *a16), *b16 = malloc(n*sizeof *b16), *z16 = malloc(n*sizeof *z16);
+
+	srand(1);
+	for (i=0; i<n; i++) {
+		a[i] = convertDoubleToP32(100*(rand()/(double)RAND_MAX - 0.5));
+		b[i] = convertDoubleToP32(rand()/(double)RAND_MAX + 0.1);
+		c[i] = convertDoubleToP32(rand()/(double)RAND_MAX);
+		a16[i] = p32_to_p16(a[i]);
+		b16[i] = p32_to_p16(b[i]);
+	}
+
+	softposit_clearFlags(softposit_flag_inexact);
+	TIME("p16_add_n", p16_add_n(a16, b16, n, z16));
+	TIME("p16_mul_n", p16_mul_n(a16, b16, n, z16));
+	TIME("p32_add_n", p32_add_n(a, b, n, z));
+	TIME("p32_mul_n", p32_mul_n(a, b, n, z));
+	TIME("p32_div_n", p32_div_n(a, b, n, z));
+	TIME("p32_mulAdd_n", p32_mulAdd_n(a, b, c, n, z));
+	TIME("p32_sqrt_n", p32_sqrt_n(b, n, z));
+	printf("inexact flag %s\n", softposit_testFlags(softposit_flag_inexact) ? "raised (exact build)" : "clear");
+
+	free(a);
+	free(b);
+	free(c);
+	free(z);
+	free(a16);
+	free(b16);
+	free(z16);
+	return 0;
+}
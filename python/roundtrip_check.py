@@ -0,0 +1,43 @@
+#Checks that _softposit results keep their posit width: every posit16 pattern
+#and random posit32 patterns go through to_float and from_float unchanged,
+#and the output of add feeds straight back into to_float.
+#  python3 roundtrip_check.py [n]
+import random
+import sys
+from array import array
+
+import _softposit
+
+
+def mismatches(name, got, want):
+    bad = sum(g!=w for g, w in zip(got, want)) + abs(len(got) - len(want))
+    print("%-22s %d values, %d mismatches" % (name, len(want), bad))
+    return bad
+
+
+def main():
+    n = int(sys.argv[1]) if len(sys.argv)>1 else 1<<20
+    bad = 0
+
+    p16 = array('H', range(1<<16))
+    x16 = _softposit.to_float(p16)
+    bad += mismatches("posit16 round trip", _softposit.from_float(x16, 16), p16)
+
+    random.seed(1)
+    p32 = array('I', [random.getrandbits(32) for _ in range(n)])
+    p32.extend([0, 1, 0x7fffffff, 0x80000000, 0x80000001, 0xffffffff])
+    x32 = _softposit.to_float(p32)
+    bad += mismatches("posit32 round trip", _softposit.from_float(x32, 32), p32)
+
+    #Doubling is exact away from maxpos, so the sums must decode to 2x
+    x = array('d', [1, 2.5, -3, 0.125, 100, -0.75])
+    for bits in (16, 32):
+        a = _softposit.from_float(x, bits)
+        bad += mismatches("posit%d add" % bits, _softposit.to_float(_softposit.add(a, a)), [2*v for v in x])
+
+    print("%d mismatches" % bad)
+    return bad!=0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,336 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+/*----------------------------------------------------------------------------
+| CPython extension module _softposit: array operations on posit bit
+| patterns held in any C-contiguous buffer (bytes, bytearray, array.array,
+| numpy arrays, memoryviews, ...).  The posit width follows the buffer's
+| item size: 1, 2 or 4 bytes for posit8, posit16 and posit32.  Results go
+| to the optional out buffer or to a new array.array whose type code ('B',
+| 'H', 'I' or 'd') keeps the width, and every kernel runs with the GIL
+| released.
+|
+|   add(a, b[, out])  sub(a, b[, out])  mul(a, b[, out])  div(a, b[, out])
+|   fma(a, b, c[, out])           a*b + c, rounded once
+|   sqrt(a[, out])
+|   dot(a, b)                     quire dot product, returned as a pattern
+|   from_float(x, bits[, out])    float32/float64 buffer to posit<bits>
+|   to_float(a[, out])            posit buffer to float64
+*----------------------------------------------------------------------------*/
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include "softposit.h"
+
+typedef struct {
+	Py_buffer view;
+	bool held;
+} spBuffer;
+
+static void spRelease( spBuffer * b, int n ){
+	int i;
+
+	for (i=0; i<n; i++)
+		if (b[i].held) PyBuffer_Release( &b[i].view );
+}
+
+static int spGet( PyObject * obj, spBuffer * b, bool writable ){
+	if (PyObject_GetBuffer( obj, &b->view, (writable ? PyBUF_WRITABLE : 0) | PyBUF_C_CONTIGUOUS )) return -1;
+	b->held = 1;
+	if (b->view.itemsize!=1 && b->view.itemsize!=2 && b->view.itemsize!=4 && b->view.itemsize!=8){
+		PyErr_SetString( PyExc_TypeError, "buffer item size must be 1, 2, 4 or 8 bytes" );
+		return -1;
+	}
+	return 0;
+}
+
+static Py_ssize_t spCount( const spBuffer * b ){
+	return b->view.len / b->view.itemsize;
+}
+
+//Posit width of a pattern buffer, or -1 with an exception set
+static int spPositBits( const spBuffer * b ){
+	if (b->view.itemsize>4){
+		PyErr_SetString( PyExc_TypeError, "posit buffers must hold 8, 16 or 32-bit patterns" );
+		return -1;
+	}
+	return 8*(int) b->view.itemsize;
+}
+
+/*----------------------------------------------------------------------------
+| Fills in the output buffer: the caller's, which must have count items of
+| itemSize bytes, or a new zeroed array.array of matching type code, so the
+| result can be fed straight back in.  Returns a new reference to it.
+*----------------------------------------------------------------------------*/
+static PyObject * spOutput( PyObject * out, spBuffer * b, Py_ssize_t count, Py_ssize_t itemSize ){
+	PyObject * module, * bytes, * result;
+	const char * typeCode = (itemSize==1) ? "B" : (itemSize==2) ? "H"
+		: (itemSize==4) ? ((sizeof (unsigned int)==4) ? "I" : "L") : "d";
+
+	if (out && out!=Py_None){
+		if (spGet( out, b, 1 )) return 0;
+		if (b->view.itemsize!=itemSize || spCount( b )!=count){
+			PyErr_SetString( PyExc_ValueError, "out has the wrong item size or length" );
+			return 0;
+		}
+		Py_INCREF( out );
+		return out;
+	}
+	module = PyImport_ImportModule( "array" );
+	if (!module) return 0;
+	bytes = PyBytes_FromStringAndSize( 0, count*itemSize );
+	if (!bytes){
+		Py_DECREF( module );
+		return 0;
+	}
+	memset( PyBytes_AS_STRING( bytes ), 0, count*itemSize );
+	result = PyObject_CallMethod( module, "array", "sO", typeCode, bytes );
+	Py_DECREF( bytes );
+	Py_DECREF( module );
+	if (result && spGet( result, b, 1 )){
+		Py_DECREF( result );
+		return 0;
+	}
+	return result;
+}
+
+static PyObject * spBinary( PyObject * args, int op ){
+	PyObject * a, * b, * c = 0, * out = 0, * result = 0;
+	spBuffer buf[4] = { { .held = 0 } };
+	Py_ssize_t n;
+	int nIn = (op==4) ? 3 : 2, bits, i;
+
+	if (op==4){
+		if (!PyArg_ParseTuple( args, "OOO|O", &a, &b, &c, &out )) return 0;
+	}
+	else if (!PyArg_ParseTuple( args, "OO|O", &a, &b, &out )) return 0;
+	if (spGet( a, &buf[0], 0 ) || spGet( b, &buf[1], 0 ) || (c && spGet( c, &buf[2], 0 ))) goto done;
+	bits = spPositBits( &buf[0] );
+	if (bits<0) goto done;
+	n = spCount( &buf[0] );
+	for (i=1; i<nIn; i++){
+		if (buf[i].view.itemsize!=buf[0].view.itemsize || spCount( &buf[i] )!=n){
+			PyErr_SetString( PyExc_ValueError, "operands differ in item size or length" );
+			goto done;
+		}
+	}
+	result = spOutput( out, &buf[3], n, buf[0].view.itemsize );
+	if (!result) goto done;
+
+	Py_BEGIN_ALLOW_THREADS
+	switch (bits*8 + op){
+#define SP_CASE( N, opIndex, call ) \
+		case N*8 + opIndex: \
+			call; \
+			break;
+#define SP_OPS( N ) \
+		SP_CASE( N, 0, p##N##_add_n( buf[0].view.buf, buf[1].view.buf, n, buf[3].view.buf ) ) \
+		SP_CASE( N, 1, p##N##_sub_n( buf[0].view.buf, buf[1].view.buf, n, buf[3].view.buf ) ) \
+		SP_CASE( N, 2, p##N##_mul_n( buf[0].view.buf, buf[1].view.buf, n, buf[3].view.buf ) ) \
+		SP_CASE( N, 3, p##N##_div_n( buf[0].view.buf, buf[1].view.buf, n, buf[3].view.buf ) ) \
+		SP_CASE( N, 4, p##N##_mulAdd_n( buf[0].view.buf, buf[1].view.buf, buf[2].view.buf, n, buf[3].view.buf ) )
+		SP_OPS( 8 )
+		SP_OPS( 16 )
+		SP_OPS( 32 )
+#undef SP_OPS
+#undef SP_CASE
+	}
+	Py_END_ALLOW_THREADS
+
+done:
+	spRelease( buf, 4 );
+	return result;
+}
+
+static PyObject * sp_add( PyObject * self, PyObject * args ){ return spBinary( args, 0 ); }
+static PyObject * sp_sub( PyObject * self, PyObject * args ){ return spBinary( args, 1 ); }
+static PyObject * sp_mul( PyObject * self, PyObject * args ){ return spBinary( args, 2 ); }
+static PyObject * sp_div( PyObject * self, PyObject * args ){ return spBinary( args, 3 ); }
+static PyObject * sp_fma( PyObject * self, PyObject * args ){ return spBinary( args, 4 ); }
+
+static PyObject * sp_sqrt( PyObject * self, PyObject * args ){
+	PyObject * a, * out = 0, * result = 0;
+	spBuffer buf[2] = { { .held = 0 } };
+	Py_ssize_t n;
+	int bits;
+
+	if (!PyArg_ParseTuple( args, "O|O", &a, &out )) return 0;
+	if (spGet( a, &buf[0], 0 ) || (bits = spPositBits( &buf[0] ))<0) goto done;
+	n = spCount( &buf[0] );
+	result = spOutput( out, &buf[1], n, buf[0].view.itemsize );
+	if (!result) goto done;
+
+	Py_BEGIN_ALLOW_THREADS
+	switch (bits){
+		case 8: p8_sqrt_n( buf[0].view.buf, n, buf[1].view.buf ); break;
+		case 16: p16_sqrt_n( buf[0].view.buf, n, buf[1].view.buf ); break;
+		case 32: p32_sqrt_n( buf[0].view.buf, n, buf[1].view.buf ); break;
+	}
+	Py_END_ALLOW_THREADS
+
+done:
+	spRelease( buf, 2 );
+	return result;
+}
+
+static PyObject * sp_dot( PyObject * self, PyObject * args ){
+	PyObject * a, * b, * result = 0;
+	spBuffer buf[2] = { { .held = 0 } };
+	unsigned long uiZ = 0;
+	Py_ssize_t n;
+	int bits;
+
+	if (!PyArg_ParseTuple( args, "OO", &a, &b )) return 0;
+	if (spGet( a, &buf[0], 0 ) || spGet( b, &buf[1], 0 ) || (bits = spPositBits( &buf[0] ))<0) goto done;
+	n = spCount( &buf[0] );
+	if (buf[1].view.itemsize!=buf[0].view.itemsize || spCount( &buf[1] )!=n){
+		PyErr_SetString( PyExc_ValueError, "operands differ in item size or length" );
+		goto done;
+	}
+
+	Py_BEGIN_ALLOW_THREADS
+	switch (bits){
+		case 8: uiZ = p8_dot_n( buf[0].view.buf, buf[1].view.buf, n ).v; break;
+		case 16: uiZ = p16_dot_n( buf[0].view.buf, buf[1].view.buf, n ).v; break;
+		case 32: uiZ = p32_dot_n( buf[0].view.buf, buf[1].view.buf, n ).v; break;
+	}
+	Py_END_ALLOW_THREADS
+	result = PyLong_FromUnsignedLong( uiZ );
+
+done:
+	spRelease( buf, 2 );
+	return result;
+}
+
+static PyObject * sp_from_float( PyObject * self, PyObject * args ){
+	PyObject * x, * out = 0, * result = 0;
+	spBuffer buf[2] = { { .held = 0 } };
+	Py_ssize_t n, i;
+	int bits;
+
+	if (!PyArg_ParseTuple( args, "Oi|O", &x, &bits, &out )) return 0;
+	if (bits!=8 && bits!=16 && bits!=32){
+		PyErr_SetString( PyExc_ValueError, "bits must be 8, 16 or 32" );
+		return 0;
+	}
+	if (spGet( x, &buf[0], 0 )) goto done;
+	if (buf[0].view.itemsize!=4 && buf[0].view.itemsize!=8){
+		PyErr_SetString( PyExc_TypeError, "expected a float32 or float64 buffer" );
+		goto done;
+	}
+	n = spCount( &buf[0] );
+	result = spOutput( out, &buf[1], n, bits/8 );
+	if (!result) goto done;
+
+	Py_BEGIN_ALLOW_THREADS
+	if (buf[0].view.itemsize==4){
+		const float * f = buf[0].view.buf;
+		switch (bits){
+			case 8:
+				for (i=0; i<n; i++) ((posit8_t *) buf[1].view.buf)[i] = convertDoubleToP8( f[i] );
+				break;
+			case 16:
+				convertFloatToP16_n( f, n, buf[1].view.buf );
+				break;
+			case 32:
+				for (i=0; i<n; i++) ((posit32_t *) buf[1].view.buf)[i] = convertFloatToP32( f[i] );
+				break;
+		}
+	}
+	else{
+		switch (bits){
+			case 8: convertDoubleToP8_n( buf[0].view.buf, n, buf[1].view.buf ); break;
+			case 16: convertDoubleToP16_n( buf[0].view.buf, n, buf[1].view.buf ); break;
+			case 32: convertDoubleToP32_n( buf[0].view.buf, n, buf[1].view.buf ); break;
+		}
+	}
+	Py_END_ALLOW_THREADS
+
+done:
+	spRelease( buf, 2 );
+	return result;
+}
+
+static PyObject * sp_to_float( PyObject * self, PyObject * args ){
+	PyObject * a, * out = 0, * result = 0;
+	spBuffer buf[2] = { { .held = 0 } };
+	Py_ssize_t n;
+	int bits;
+
+	if (!PyArg_ParseTuple( args, "O|O", &a, &out )) return 0;
+	if (spGet( a, &buf[0], 0 ) || (bits = spPositBits( &buf[0] ))<0) goto done;
+	n = spCount( &buf[0] );
+	result = spOutput( out, &buf[1], n, sizeof (double) );
+	if (!result) goto done;
+
+	Py_BEGIN_ALLOW_THREADS
+	switch (bits){
+		case 8: convertP8ToDouble_n( buf[0].view.buf, n, buf[1].view.buf ); break;
+		case 16: convertP16ToDouble_n( buf[0].view.buf, n, buf[1].view.buf ); break;
+		case 32: convertP32ToDouble_n( buf[0].view.buf, n, buf[1].view.buf ); break;
+	}
+	Py_END_ALLOW_THREADS
+
+done:
+	spRelease( buf, 2 );
+	return result;
+}
+
+static PyMethodDef spMethods[] = {
+	{ "add", sp_add, METH_VARARGS, "add(a, b[, out]): elementwise a + b" },
+	{ "sub", sp_sub, METH_VARARGS, "sub(a, b[, out]): elementwise a - b" },
+	{ "mul", sp_mul, METH_VARARGS, "mul(a, b[, out]): elementwise a * b" },
+	{ "div", sp_div, METH_VARARGS, "div(a, b[, out]): elementwise a / b" },
+	{ "fma", sp_fma, METH_VARARGS, "fma(a, b, c[, out]): elementwise a*b + c, rounded once" },
+	{ "sqrt", sp_sqrt, METH_VARARGS, "sqrt(a[, out]): elementwise square root" },
+	{ "dot", sp_dot, METH_VARARGS, "dot(a, b): quire dot product, as a bit pattern" },
+	{ "from_float", sp_from_float, METH_VARARGS, "from_float(x, bits[, out]): float32/float64 buffer to posits" },
+	{ "to_float", sp_to_float, METH_VARARGS, "to_float(a[, out]): posits to a float64 buffer" },
+	{ 0, 0, 0, 0 }
+};
+
+static struct PyModuleDef spModule = {
+	PyModuleDef_HEAD_INIT, "_softposit",
+	"Array operations on posit bit patterns held in buffer-protocol objects.", -1, spMethods
+};
+
+PyMODINIT_FUNC PyInit__softposit( void ){
+	return PyModule_Create( &spModule );
+}
@@ -0,0 +1,73 @@
+#include <math.h>
+#include <stdlib.h>
+#include <time.h>
+#include "softposit.h"
+
+//Dense solves: posit16 factorisation + posit32 refinement versus plain posit32
+//  ./solve_bench [n] [threads]
+
+static double now(){
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + 1e-9*t.tv_nsec;
+}
+
+static double maxError(const posit32_t *x, const double *xTrue, size_t n){
+	double err = 0;
+	size_t i;
+	for (i=0; i<n; i++)
+		err = fmax(err, fabs(convertP32ToDouble(x[i]) - xTrue[i]));
+	return err;
+}
+
+int main(int argc, char **argv) {
+
+	size_t n = (argc>1) ? strtoul(argv[1], 0, 10) : 256, i, j, k;
+	int threads = (argc>2) ? atoi(argv[2]) : 0, steps, spd;
+	double *M = malloc(n*n*sizeof *M), *xTrue = malloc(n*sizeof *xTrue), t0, s;
+	posit32_t *A = malloc(n*n*sizeof *A), *F = malloc(n*n*sizeof *F);
+	posit32_t *b = malloc(n*sizeof *b), *x = malloc(n*sizeof *x);
+	size_t *piv = malloc(n*sizeof *piv);
+
+	srand(1);
+	for (i=0; i<n*n; i++) M[i] = 2.0*rand()/RAND_MAX - 1;
+	for (i=0; i<n; i++) xTrue[i] = 1 + (double)i/n;
+
+	for (spd=0; spd<2; spd++) {
+		//General: M + n*I/4; SPD: M*M^T/n + I
+		for (i=0; i<n; i++) {
+			for (j=0; j<n; j++) {
+				if (spd) {
+					for (s=0, k=0; k<n; k++) s += M[i*n+k]*M[j*n+k];
+					s = s/n + (i==j);
+				}
+				else s = M[i*n+j] + (i==j)*0.25*n;
+				A[i*n+j] = convertDoubleToP32(s);
+			}
+		}
+		for (i=0; i<n; i++) {
+			for (s=0, j=0; j<n; j++) s += convertP32ToDouble(A[i*n+j])*xTrue[j];
+			b[i] = convertDoubleToP32(s);
+		}
+
+		for (i=0; i<n*n; i++) F[i] = A[i];
+		for (i=0; i<n; i++) x[i] = b[i];
+		t0 = now();
+		if (spd) {
+			p32_cholFactor(F, n, n, threads);
+			p32_cholSolve(F, n, n, x);
+		}
+		else {
+			p32_luFactor(F, n, n, piv, threads);
+			p32_luSolve(F, n, n, piv, x);
+		}
+		printf("%s n=%zu posit32:           %8.1f ms, max error %.3g\n", spd ? "Cholesky" : "LU      ",
+			n, 1e3*(now() - t0), maxError(x, xTrue, n));
+
+		t0 = now();
+		steps = spd ? p32_cholSolveRefine(A, n, n, b, x, 20, threads) : p32_luSolveRefine(A, n, n, b, x, 20, threads);
+		printf("%s n=%zu posit16+refinement: %7.1f ms, max error %.3g, %d steps\n", spd ? "Cholesky" : "LU      ",
+			n, 1e3*(now() - t0), maxError(x, xTrue, n), steps);
+	}
+	return 0;
+}
@@ -0,0 +1,98 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "softposit.h"
+
+//Radix sort and argsort against qsort on large random arrays; the default
+//of 100M elements needs about 5 GB for posit64:
+//  ./sort_bench [n] [repeats]
+
+static double now(){
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + 1e-9*t.tv_nsec;
+}
+
+static uint64_t rng = 88172645463325252ULL;
+
+static uint64_t next(){
+	rng ^= rng << 13;
+	rng ^= rng >> 7;
+	rng ^= rng << 17;
+	return rng;
+}
+
+//qsort runs once: at this size it dominates the run time
+#define BENCH(N) \
+static int compare##N(const void *a, const void *b){ \
+	int##N##_t x = ((const posit##N##_t *)a)->v, y = ((const posit##N##_t *)b)->v; \
+	return (x>y) - (x<y); \
+} \
+\
+static void bench##N(size_t n, int repeats){ \
+	posit##N##_t *a, *work; \
+	size_t *idx, i, mismatches = 0; \
+	unsigned char *seen; \
+	double t0, tQsort, tSort = 1e30, tArg = 1e30; \
+	int r; \
+	\
+	a = malloc(n*sizeof *a + 1); \
+	work = malloc(n*sizeof *work + 1); \
+	idx = malloc(n*sizeof *idx + 1); \
+	seen = calloc(n/8 + 1, 1); \
+	if (!a || !work || !idx || !seen) { \
+		printf("posit%-2d n=%zu: out of memory\n", N, n); \
+		free(a); free(work); free(idx); free(seen); \
+		return; \
+	} \
+	/* random patterns, NaR included, plus a run of ties for the argsort check */ \
+	for (i=0; i<n; i++) a[i].v = (uint##N##_t) next(); \
+	for (i=0; i<n/8; i++) a[i].v = a[n/2].v; \
+	\
+	memcpy(work, a, n*sizeof *a); \
+	t0 = now(); \
+	qsort(work, n, sizeof *work, compare##N); \
+	tQsort = now() - t0; \
+	for (r=0; r<repeats; r++) { \
+		memcpy(work, a, n*sizeof *a); \
+		t0 = now(); \
+		p##N##_sort_n(work, n); \
+		t0 = now() - t0; \
+		if (t0<tSort) tSort = t0; \
+		t0 = now(); \
+		p##N##_argsort_n(a, n, idx); \
+		t0 = now() - t0; \
+		if (t0<tArg) tArg = t0; \
+	} \
+	/* sorted, a permutation, equal to the sorted values and stable */ \
+	for (i=0; i<n; i++) { \
+		mismatches += idx[i]>=n || (seen[idx[i]/8]>>(idx[i]%8) & 1) || a[idx[i]].v!=work[i].v; \
+		if (idx[i]<n) seen[idx[i]/8] |= 1 << (idx[i]%8); \
+	} \
+	for (i=1; i<n; i++) \
+		mismatches += (int##N##_t) work[i-1].v > (int##N##_t) work[i].v \
+			|| (work[i-1].v==work[i].v && idx[i-1]>idx[i]); \
+	\
+	printf("posit%-2d n=%zu: qsort %.2f ns/element, sort %.2f ns/element (%.1fx), argsort %.2f ns/element, %zu mismatches\n", \
+		N, n, 1e9*tQsort/n, 1e9*tSort/n, tQsort/tSort, 1e9*tArg/n, mismatches); \
+	free(a); \
+	free(work); \
+	free(idx); \
+	free(seen); \
+}
+
+BENCH(16)
+BENCH(32)
+BENCH(64)
+
+int main(int argc, char **argv){
+	size_t n = (argc>1) ? strtoul(argv[1], 0, 10) : 100000000;
+	int repeats = (argc>2) ? atoi(argv[2]) : 3;
+
+	if (n<1) n = 1;
+	bench16(n, repeats);
+	bench32(n, repeats);
+	bench64(n, repeats);
+	return 0;
+}
@@ -0,0 +1,277 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Batch conversions between int8/int16/int32 arrays and posits with a fused
+| power-of-two scale, for quantised tensors.  iM_to_pN_n stores a*2^scale
+| rounded once; pN_to_iM_n stores a*2^-scale rounded to the nearest
+| integer (ties to even) and saturated to the integer range, NaR giving 0.
+| The scale only moves the posit scale, so it costs nothing in accuracy and
+| quantise/dequantise pairs with the same scale round-trip.  pN_roundToInt_n
+| matches pN_roundToInt.  The AVX2 paths take eight elements per step.
+*----------------------------------------------------------------------------*/
+static inline uint_fast32_t c_intToPX( int_fast32_t a, int scale, int nbits, int es ){
+	uint_fast64_t mag = a<0 ? -(uint_fast64_t) (int_fast64_t) a : (uint_fast64_t) a;
+	int lz;
+
+	if (a==0) return 0;
+	lz = __builtin_clzll( mag );
+	return softposit_packPX( a<0, 63-lz+scale, mag<<lz, false, nbits, es );
+}
+
+static inline int_fast32_t c_pXToInt( uint_fast32_t uiA, int es, int scale, int_fast32_t max ){
+	uint_fast64_t sig, iZ;
+	int_fast32_t s;
+	bool sign;
+
+	if (uiA==0 || uiA==0x80000000) return 0;
+	s = softposit_unpackPX( uiA, es, &sign, &sig );
+	iZ = softposit_roundSigToInt( s-scale, sig );
+	if (sign) return iZ>(uint_fast64_t) max ? -max-1 : -(int_fast64_t) iZ;
+	return iZ>(uint_fast64_t) max ? max : (int_fast32_t) iZ;
+}
+
+static inline int_fast32_t c_loadInt( const void * a, int bytes, size_t i ){
+	if (bytes==1) return ((const int8_t *) a)[i];
+	if (bytes==2) return ((const int16_t *) a)[i];
+	return ((const int32_t *) a)[i];
+}
+
+static inline void c_storeInt( void * z, int bytes, size_t i, int_fast32_t iZ ){
+	if (bytes==1) ((int8_t *) z)[i] = iZ;
+	else if (bytes==2) ((int16_t *) z)[i] = iZ;
+	else ((int32_t *) z)[i] = iZ;
+}
+
+static inline uint_fast32_t c_loadPX( const void * a, int bytes, size_t i ){
+	if (bytes==1) return (uint_fast32_t) ((const uint8_t *) a)[i]<<24;
+	if (bytes==2) return (uint_fast32_t) ((const uint16_t *) a)[i]<<16;
+	return ((const uint32_t *) a)[i];
+}
+
+static inline void c_storePX( void * z, int bytes, size_t i, uint_fast32_t uiZ ){
+	if (bytes==1) ((uint8_t *) z)[i] = uiZ>>24;
+	else if (bytes==2) ((uint16_t *) z)[i] = uiZ>>16;
+	else ((uint32_t *) z)[i] = uiZ;
+}
+
+#ifdef __AVX2__
+static inline __m256i c_loadIntx8( const void * a, int bytes, size_t i ){
+	if (bytes==1) return _mm256_cvtepi8_epi32( _mm_loadl_epi64( (const __m128i *) ((const int8_t *) a + i) ) );
+	if (bytes==2) return _mm256_cvtepi16_epi32( _mm_loadu_si128( (const __m128i *) ((const int16_t *) a + i) ) );
+	return _mm256_loadu_si256( (const __m256i *) ((const int32_t *) a + i) );
+}
+
+//Lanes already in range, so the saturating packs only narrow
+static inline void c_storeIntx8( void * z, int bytes, size_t i, __m256i iZ ){
+	if (bytes==1){
+		iZ = _mm256_packs_epi16( _mm256_packs_epi32( iZ, iZ ), iZ );
+		iZ = _mm256_permutevar8x32_epi32( iZ, _mm256_setr_epi32( 0, 4, 0, 0, 0, 0, 0, 0 ) );
+		_mm_storel_epi64( (__m128i *) ((int8_t *) z + i), _mm256_castsi256_si128( iZ ) );
+	}
+	else if (bytes==2){
+		iZ = _mm256_permute4x64_epi64( _mm256_packs_epi32( iZ, iZ ), 0x08 );
+		_mm_storeu_si128( (__m128i *) ((int16_t *) z + i), _mm256_castsi256_si128( iZ ) );
+	}
+	else _mm256_storeu_si256( (__m256i *) ((int32_t *) z + i), iZ );
+}
+
+static inline __m256i c_loadPXx8( const void * a, int bytes, size_t i ){
+	if (bytes==1)
+		return _mm256_slli_epi32( _mm256_cvtepu8_epi32( _mm_loadl_epi64( (const __m128i *) ((const uint8_t *) a + i) ) ), 24 );
+	if (bytes==2)
+		return _mm256_slli_epi32( _mm256_cvtepu16_epi32( _mm_loadu_si128( (const __m128i *) ((const uint16_t *) a + i) ) ), 16 );
+	return _mm256_loadu_si256( (const __m256i *) ((const uint32_t *) a + i) );
+}
+
+static inline void c_storePXx8( void * z, int bytes, size_t i, __m256i uiZ ){
+	if (bytes==1){
+		uiZ = _mm256_packus_epi32( _mm256_srli_epi32( uiZ, 24 ), uiZ );
+		uiZ = _mm256_packus_epi16( uiZ, uiZ );
+		uiZ = _mm256_permutevar8x32_epi32( uiZ, _mm256_setr_epi32( 0, 4, 0, 0, 0, 0, 0, 0 ) );
+		_mm_storel_epi64( (__m128i *) ((uint8_t *) z + i), _mm256_castsi256_si128( uiZ ) );
+	}
+	else if (bytes==2){
+		uiZ = _mm256_srli_epi32( uiZ, 16 );
+		uiZ = _mm256_permute4x64_epi64( _mm256_packus_epi32( uiZ, uiZ ), 0x08 );
+		_mm_storeu_si128( (__m128i *) ((uint16_t *) z + i), _mm256_castsi256_si128( uiZ ) );
+	}
+	else _mm256_storeu_si256( (__m256i *) ((uint32_t *) z + i), uiZ );
+}
+
+//Nonnegative or negative integers (sign mask) times 2^scale
+static inline __m256i c_intToPXx8( __m256i a, int scale, int nbits, int es ){
+	__m256i sign = _mm256_srai_epi32( a, 31 );
+	__m256i mag = _mm256_sub_epi32( _mm256_xor_si256( a, sign ), sign );
+	__m256i lz = softposit_clzx8( mag );
+	__m256i frac = _mm256_slli_epi32( _mm256_sllv_epi32( mag, lz ), 1 );
+	__m256i s = _mm256_sub_epi32( _mm256_set1_epi32( 31+scale ), lz );
+
+	return _mm256_andnot_si256( _mm256_cmpeq_epi32( a, _mm256_setzero_si256() ),
+			softposit_packPXx8( sign, s, frac, nbits, es ) );
+}
+
+//Magnitudes of a*2^-scale rounded to nearest even, all-ones above 2^31
+static inline __m256i c_roundMagx8( __m256i s, __m256i frac ){
+	__m256i sig = _mm256_or_si256( _mm256_set1_epi32( 0x80000000 ), _mm256_srli_epi32( frac, 1 ) );
+	__m256i e = _mm256_min_epi32( _mm256_max_epi32( s, _mm256_set1_epi32( -1 ) ), _mm256_set1_epi32( 30 ) );
+	__m256i iZ = _mm256_srlv_epi32( sig, _mm256_sub_epi32( _mm256_set1_epi32( 31 ), e ) );
+	__m256i rem = _mm256_xor_si256( _mm256_sllv_epi32( sig, _mm256_add_epi32( e, _mm256_set1_epi32( 1 ) ) ),
+			_mm256_set1_epi32( 0x80000000 ) );
+	__m256i up = _mm256_or_si256( _mm256_cmpgt_epi32( rem, _mm256_setzero_si256() ),
+			_mm256_and_si256( _mm256_cmpeq_epi32( rem, _mm256_setzero_si256() ),
+					_mm256_sub_epi32( _mm256_setzero_si256(), _mm256_and_si256( iZ, _mm256_set1_epi32( 1 ) ) ) ) );
+
+	iZ = _mm256_sub_epi32( iZ, up );
+	iZ = _mm256_or_si256( iZ, _mm256_cmpgt_epi32( s, _mm256_set1_epi32( 30 ) ) );
+	return _mm256_andnot_si256( _mm256_cmpgt_epi32( _mm256_set1_epi32( -1 ), s ), iZ );
+}
+
+static inline __m256i c_pXToIntx8( __m256i uA, int es, int scale, int_fast32_t max ){
+	__m256i special = _mm256_or_si256( _mm256_cmpeq_epi32( uA, _mm256_setzero_si256() ),
+			_mm256_cmpeq_epi32( uA, _mm256_set1_epi32( 0x80000000 ) ) );
+	__m256i sign, frac, s, iZ, lim;
+
+	s = _mm256_sub_epi32( softposit_decodePXx8( uA, es, &sign, &frac ), _mm256_set1_epi32( scale ) );
+	iZ = c_roundMagx8( s, frac );
+	lim = _mm256_sub_epi32( _mm256_set1_epi32( max ), sign );
+	iZ = _mm256_min_epu32( iZ, lim );
+	iZ = _mm256_sub_epi32( _mm256_xor_si256( iZ, sign ), sign );
+	return _mm256_andnot_si256( special, iZ );
+}
+
+//|a| >= 2^30 is already an integer at every width up to 32 bits
+static inline __m256i c_roundToIntPXx8( __m256i uA, int nbits, int es ){
+	__m256i keep = _mm256_or_si256( _mm256_cmpeq_epi32( uA, _mm256_setzero_si256() ),
+			_mm256_cmpeq_epi32( uA, _mm256_set1_epi32( 0x80000000 ) ) );
+	__m256i sign, frac, s, iZ;
+
+	s = softposit_decodePXx8( uA, es, &sign, &frac );
+	keep = _mm256_or_si256( keep, _mm256_cmpgt_epi32( s, _mm256_set1_epi32( 29 ) ) );
+	iZ = c_roundMagx8( s, frac );
+	iZ = _mm256_sub_epi32( _mm256_xor_si256( iZ, sign ), sign );
+	return _mm256_blendv_epi8( c_intToPXx8( iZ, 0, nbits, es ), uA, keep );
+}
+#endif
+
+static inline void c_intToPX_n( const void * a, int bytesA, size_t n, void * z, int bytesZ, int nbits, int es, int scale ){
+	size_t i = 0;
+
+#ifdef __AVX2__
+	for (; i+8<=n; i+=8)
+		c_storePXx8( z, bytesZ, i, c_intToPXx8( c_loadIntx8( a, bytesA, i ), scale, nbits, es ) );
+#endif
+	for (; i<n; i++) c_storePX( z, bytesZ, i, c_intToPX( c_loadInt( a, bytesA, i ), scale, nbits, es ) );
+}
+
+static inline void c_pXToInt_n( const void * a, int bytesA, int es, size_t n, void * z, int bytesZ, int scale ){
+	int_fast32_t max = (int_fast32_t) ((1ULL<<(8*bytesZ-1))-1);
+	size_t i = 0;
+
+#ifdef __AVX2__
+	for (; i+8<=n; i+=8)
+		c_storeIntx8( z, bytesZ, i, c_pXToIntx8( c_loadPXx8( a, bytesA, i ), es, scale, max ) );
+#endif
+	for (; i<n; i++) c_storeInt( z, bytesZ, i, c_pXToInt( c_loadPX( a, bytesA, i ), es, scale, max ) );
+}
+
+#define C_INT_TO_PX_N( M, N, es ) \
+void i##M##_to_p##N##_n( const int##M##_t * a, size_t n, posit##N##_t * z, int scale ){ \
+	c_intToPX_n( a, M/8, n, z, N/8, N, es, scale ); \
+}
+
+#define C_PX_TO_INT_N( N, es, M ) \
+void p##N##_to_i##M##_n( const posit##N##_t * a, size_t n, int##M##_t * z, int scale ){ \
+	c_pXToInt_n( a, N/8, es, n, z, M/8, scale ); \
+}
+
+C_INT_TO_PX_N( 8, 8, 0 )
+C_INT_TO_PX_N( 16, 8, 0 )
+C_INT_TO_PX_N( 32, 8, 0 )
+C_PX_TO_INT_N( 8, 0, 8 )
+C_PX_TO_INT_N( 8, 0, 16 )
+C_PX_TO_INT_N( 8, 0, 32 )
+
+C_INT_TO_PX_N( 8, 16, 1 )
+C_INT_TO_PX_N( 16, 16, 1 )
+C_INT_TO_PX_N( 32, 16, 1 )
+C_PX_TO_INT_N( 16, 1, 8 )
+C_PX_TO_INT_N( 16, 1, 16 )
+C_PX_TO_INT_N( 16, 1, 32 )
+
+C_INT_TO_PX_N( 8, 32, 2 )
+C_INT_TO_PX_N( 16, 32, 2 )
+C_INT_TO_PX_N( 32, 32, 2 )
+C_PX_TO_INT_N( 32, 2, 8 )
+C_PX_TO_INT_N( 32, 2, 16 )
+C_PX_TO_INT_N( 32, 2, 32 )
+
+void p8_roundToInt_n( const posit8_t * a, size_t n, posit8_t * z ){
+	size_t i = 0;
+
+#ifdef __AVX2__
+	for (; i+8<=n; i+=8)
+		c_storePXx8( z, 1, i, c_roundToIntPXx8( c_loadPXx8( a, 1, i ), 8, 0 ) );
+#endif
+	for (; i<n; i++) z[i] = p8_roundToInt( a[i] );
+}
+
+void p16_roundToInt_n( const posit16_t * a, size_t n, posit16_t * z ){
+	size_t i = 0;
+
+#ifdef __AVX2__
+	for (; i+8<=n; i+=8)
+		c_storePXx8( z, 2, i, c_roundToIntPXx8( c_loadPXx8( a, 2, i ), 16, 1 ) );
+#endif
+	for (; i<n; i++) z[i] = p16_roundToInt( a[i] );
+}
+
+void p32_roundToInt_n( const posit32_t * a, size_t n, posit32_t * z ){
+	size_t i = 0;
+
+#ifdef __AVX2__
+	for (; i+8<=n; i+=8)
+		c_storePXx8( z, 4, i, c_roundToIntPXx8( c_loadPXx8( a, 4, i ), 32, 2 ) );
+#endif
+	for (; i<n; i++) z[i] = p32_roundToInt( a[i] );
+}
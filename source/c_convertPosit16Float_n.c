@@ -0,0 +1,419 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Batch conversions between posit16 and float, IEEE half and bfloat16.
+| Every posit16 is exactly a float, so half and bfloat16 go through float
+| (F16C or integer rounding on the way out), and only float to posit16
+| needs its own rounding.  That one is done on the bit patterns with
+| round-to-nearest-even on the posit encoding, the same rule as every other
+| posit conversion: nonzero values never round to zero and never past
+| maxpos, and NaN and infinities become NaR.  Half and bfloat16 values are
+| passed as their 16-bit patterns.
+*----------------------------------------------------------------------------*/
+
+static inline uint_fast16_t c_floatBitsToP16UI( uint32_t uiA ){
+	uint32_t a = uiA & 0x7FFFFFFF, y, regime, body, uiZ;
+	int_fast32_t scale, k, shift;
+	bool sticky;
+
+	if (a==0) return 0;
+	if (a>=0x7F800000) return 0x8000;
+	scale = (int_fast32_t) (a>>23) - 127;
+	if (scale<-28) uiZ = 0x1;
+	else if (scale>27) uiZ = 0x7FFF;
+	else{
+		//Regime, exponent bit and fraction left-aligned below the sign
+		k = scale>>1;
+		y = ((uint32_t) (scale&1)<<31) | ((a&0x7FFFFF)<<8);
+		if (k>=0){
+			regime = 0x7FFFFFFF ^ (0x7FFFFFFF>>(k+1));
+			shift = k+3;
+		}
+		else{
+			regime = 0x40000000>>(-k);
+			shift = 2-k;
+		}
+		body = regime | (y>>shift);
+		sticky = (y<<(32-shift)) || (body&0x7FFF);
+		uiZ = body>>16;
+		uiZ += ((body>>15)&1) & (sticky | (uiZ&1));
+	}
+	return (uiA>>31) ? -uiZ & 0xFFFF : uiZ;
+}
+
+static inline uint32_t c_p16UIToFloatBits( uint_fast16_t uiA ){
+	uint32_t t, a;
+	int_fast32_t k;
+	int run;
+	bool sign = uiA>>15;
+
+	if (uiA==0) return 0;
+	if (uiA==0x8000) return 0x7FC00000;
+	a = sign ? -uiA & 0xFFFF : uiA;
+	t = a<<17;
+	run = __builtin_clz( (t>>31) ? ~t : t );
+	k = (t>>31) ? run-1 : -run;
+	t <<= run+1;
+	return ((uint32_t) sign<<31) | ((uint32_t) (2*k + (t>>31) + 127)<<23) | ((t<<1)>>9);
+}
+
+//Exact, then rounded once into posit16
+static inline uint_fast16_t c_halfBitsToP16UI( uint16_t h ){
+	uint32_t e = (h>>10) & 0x1F, m = h & 0x3FF;
+	union { float f; uint32_t ui; } uA;
+
+	if (e==0x1F) return 0x8000;
+	uA.f = e ? (float) (m|0x400) * (float) (1<<e) * 0x1p-25f : (float) m * 0x1p-24f;
+	return c_floatBitsToP16UI( uA.ui | (uint32_t) (h&0x8000)<<16 );
+}
+
+//Round to nearest even, overflowing to infinity as IEEE conversions do
+static inline uint16_t c_floatBitsToHalf( uint32_t uiA ){
+	uint32_t sign = (uiA>>16) & 0x8000, a = uiA & 0x7FFFFFFF, h, rem, mant;
+	int shift;
+
+	if (a>0x7F800000) return sign | 0x7E00;
+	if (a>=0x477FF000) return sign | 0x7C00;
+	if (a>=0x38800000){
+		h = (a - 0x38000000)>>13;
+		rem = a & 0x1FFF;
+		return sign | (h + ((rem>0x1000) | ((rem==0x1000) & h)));
+	}
+	shift = 126 - (int) (a>>23);
+	if (shift>24) return sign;
+	mant = (a & 0x7FFFFF) | 0x800000;
+	h = mant>>shift;
+	rem = mant & ((1U<<shift)-1);
+	return sign | (h + ((rem>(1U<<(shift-1))) | ((rem==(1U<<(shift-1))) & h)));
+}
+
+static inline uint16_t c_floatBitsToBF16( uint32_t uiA ){
+	return (uiA + 0x7FFF + ((uiA>>16)&1))>>16;
+}
+
+#if defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(__AVX512CD__)
+/*----------------------------------------------------------------------------
+| Sixteen lanes of the scalar routines above, with the special cases and
+| saturation merged in by masks.
+*----------------------------------------------------------------------------*/
+#define C_SET1( a ) _mm512_set1_epi32( a )
+
+static inline __m256i c_floatBitsToP16x16( __m512i uA ){
+	__m512i a = _mm512_and_si512( uA, C_SET1(0x7FFFFFFF) );
+	__m512i scale = _mm512_sub_epi32( _mm512_srli_epi32( a, 23 ), C_SET1(127) );
+	__m512i sc = _mm512_min_epi32( _mm512_max_epi32( scale, C_SET1(-28) ), C_SET1(27) );
+	__m512i k = _mm512_srai_epi32( sc, 1 );
+	__mmask16 kNeg = _mm512_cmplt_epi32_mask( k, _mm512_setzero_si512() );
+	__m512i y = _mm512_or_si512( _mm512_slli_epi32( sc, 31 ),
+			_mm512_slli_epi32( _mm512_and_si512( a, C_SET1(0x7FFFFF) ), 8 ) );
+	__m512i regime = _mm512_mask_blend_epi32( kNeg,
+			_mm512_xor_si512( C_SET1(0x7FFFFFFF), _mm512_srlv_epi32( C_SET1(0x7FFFFFFF), _mm512_add_epi32( k, C_SET1(1) ) ) ),
+			_mm512_srlv_epi32( C_SET1(0x40000000), _mm512_sub_epi32( _mm512_setzero_si512(), k ) ) );
+	__m512i shift = _mm512_mask_blend_epi32( kNeg, _mm512_add_epi32( k, C_SET1(3) ), _mm512_sub_epi32( C_SET1(2), k ) );
+	__m512i body = _mm512_or_si512( regime, _mm512_srlv_epi32( y, shift ) );
+	__mmask16 sticky = _mm512_test_epi32_mask( _mm512_sllv_epi32( y, _mm512_sub_epi32( C_SET1(32), shift ) ), C_SET1(-1) )
+			| _mm512_test_epi32_mask( body, C_SET1(0x7FFF) );
+	__m512i uiZ = _mm512_srli_epi32( body, 16 );
+	__mmask16 up = _mm512_test_epi32_mask( body, C_SET1(0x8000) )
+			& (sticky | _mm512_test_epi32_mask( uiZ, C_SET1(1) ));
+
+	uiZ = _mm512_mask_add_epi32( uiZ, up, uiZ, C_SET1(1) );
+	uiZ = _mm512_mask_mov_epi32( uiZ, _mm512_cmplt_epi32_mask( scale, C_SET1(-28) ), C_SET1(0x1) );
+	uiZ = _mm512_mask_mov_epi32( uiZ, _mm512_cmpgt_epi32_mask( scale, C_SET1(27) ), C_SET1(0x7FFF) );
+	uiZ = _mm512_mask_sub_epi32( uiZ, _mm512_cmplt_epi32_mask( uA, _mm512_setzero_si512() ), _mm512_setzero_si512(), uiZ );
+	uiZ = _mm512_mask_mov_epi32( uiZ, _mm512_cmpeq_epi32_mask( a, _mm512_setzero_si512() ), _mm512_setzero_si512() );
+	uiZ = _mm512_mask_mov_epi32( uiZ, _mm512_cmpgt_epi32_mask( a, C_SET1(0x7F7FFFFF) ), C_SET1(0x8000) );
+	return _mm512_cvtepi32_epi16( uiZ );
+}
+
+static inline __m512i c_p16UIToFloatBitsx16( __m256i p ){
+	__m512i uiA = _mm512_cvtepu16_epi32( p );
+	__mmask16 sign = _mm512_test_epi32_mask( uiA, C_SET1(0x8000) );
+	__m512i a = _mm512_and_si512( _mm512_mask_sub_epi32( uiA, sign, _mm512_setzero_si512(), uiA ), C_SET1(0xFFFF) );
+	__m512i t = _mm512_slli_epi32( a, 17 );
+	__mmask16 regS = _mm512_movepi32_mask( t );
+	__m512i run = _mm512_lzcnt_epi32( _mm512_xor_si512( t, _mm512_srai_epi32( t, 31 ) ) );
+	__m512i k = _mm512_mask_blend_epi32( regS, _mm512_sub_epi32( _mm512_setzero_si512(), run ),
+			_mm512_sub_epi32( run, C_SET1(1) ) );
+	__m512i f;
+
+	t = _mm512_sllv_epi32( t, _mm512_add_epi32( run, C_SET1(1) ) );
+	f = _mm512_add_epi32( _mm512_add_epi32( k, k ), _mm512_add_epi32( _mm512_srli_epi32( t, 31 ), C_SET1(127) ) );
+	f = _mm512_or_si512( _mm512_slli_epi32( f, 23 ), _mm512_srli_epi32( _mm512_slli_epi32( t, 1 ), 9 ) );
+	f = _mm512_mask_or_epi32( f, sign, f, C_SET1(0x80000000) );
+	f = _mm512_mask_mov_epi32( f, _mm512_cmpeq_epi32_mask( uiA, _mm512_setzero_si512() ), _mm512_setzero_si512() );
+	return _mm512_mask_mov_epi32( f, _mm512_cmpeq_epi32_mask( uiA, C_SET1(0x8000) ), C_SET1(0x7FC00000) );
+}
+
+static inline __m256i c_floatBitsToBF16x16( __m512i f ){
+	f = _mm512_add_epi32( f, _mm512_add_epi32( C_SET1(0x7FFF), _mm512_and_si512( _mm512_srli_epi32( f, 16 ), C_SET1(1) ) ) );
+	return _mm512_cvtepi32_epi16( _mm512_srli_epi32( f, 16 ) );
+}
+
+#define C_LANES 16
+#define C_MASK( n, i ) ((n)-(i)>=16 ? (__mmask16) 0xFFFF : (__mmask16) ((1U<<((n)-(i)))-1))
+
+void convertFloatToP16_n( const float * a, size_t n, posit16_t * z ){
+	size_t i;
+	for (i=0; i<n; i+=C_LANES){
+		__mmask16 m = C_MASK( n, i );
+		_mm256_mask_storeu_epi16( z+i, m, c_floatBitsToP16x16( _mm512_maskz_loadu_epi32( m, a+i ) ) );
+	}
+}
+
+void convertP16ToFloat_n( const posit16_t * a, size_t n, float * z ){
+	size_t i;
+	for (i=0; i<n; i+=C_LANES){
+		__mmask16 m = C_MASK( n, i );
+		_mm512_mask_storeu_epi32( z+i, m, c_p16UIToFloatBitsx16( _mm256_maskz_loadu_epi16( m, a+i ) ) );
+	}
+}
+
+void convertHalfToP16_n( const uint16_t * a, size_t n, posit16_t * z ){
+	size_t i;
+	for (i=0; i<n; i+=C_LANES){
+		__mmask16 m = C_MASK( n, i );
+		__m512 f = _mm512_cvtph_ps( _mm256_maskz_loadu_epi16( m, a+i ) );
+		_mm256_mask_storeu_epi16( z+i, m, c_floatBitsToP16x16( _mm512_castps_si512( f ) ) );
+	}
+}
+
+void convertP16ToHalf_n( const posit16_t * a, size_t n, uint16_t * z ){
+	size_t i;
+	for (i=0; i<n; i+=C_LANES){
+		__mmask16 m = C_MASK( n, i );
+		__m512i f = c_p16UIToFloatBitsx16( _mm256_maskz_loadu_epi16( m, a+i ) );
+		_mm256_mask_storeu_epi16( z+i, m, _mm512_cvtps_ph( _mm512_castsi512_ps( f ), _MM_FROUND_TO_NEAREST_INT ) );
+	}
+}
+
+void convertBF16ToP16_n( const uint16_t * a, size_t n, posit16_t * z ){
+	size_t i;
+	for (i=0; i<n; i+=C_LANES){
+		__mmask16 m = C_MASK( n, i );
+		__m512i f = _mm512_slli_epi32( _mm512_cvtepu16_epi32( _mm256_maskz_loadu_epi16( m, a+i ) ), 16 );
+		_mm256_mask_storeu_epi16( z+i, m, c_floatBitsToP16x16( f ) );
+	}
+}
+
+void convertP16ToBF16_n( const posit16_t * a, size_t n, uint16_t * z ){
+	size_t i;
+	for (i=0; i<n; i+=C_LANES){
+		__mmask16 m = C_MASK( n, i );
+		_mm256_mask_storeu_epi16( z+i, m, c_floatBitsToBF16x16( c_p16UIToFloatBitsx16( _mm256_maskz_loadu_epi16( m, a+i ) ) ) );
+	}
+}
+
+#else
+
+#ifdef __AVX2__
+/*----------------------------------------------------------------------------
+| Eight lanes for AVX2.  Without a vector count-leading-zeros the regime run
+| is read from the exponent of the top 16 bits converted to float, which is
+| exact.
+*----------------------------------------------------------------------------*/
+#define C_SET1( a ) _mm256_set1_epi32( a )
+
+static inline __m128i c_pack32To16x8( __m256i a ){
+	a = _mm256_packus_epi32( a, a );
+	return _mm256_castsi256_si128( _mm256_permute4x64_epi64( a, 0x08 ) );
+}
+
+static inline __m128i c_floatBitsToP16x8( __m256i uA ){
+	__m256i zero = _mm256_setzero_si256();
+	__m256i a = _mm256_and_si256( uA, C_SET1(0x7FFFFFFF) );
+	__m256i scale = _mm256_sub_epi32( _mm256_srli_epi32( a, 23 ), C_SET1(127) );
+	__m256i sc = _mm256_min_epi32( _mm256_max_epi32( scale, C_SET1(-28) ), C_SET1(27) );
+	__m256i k = _mm256_srai_epi32( sc, 1 );
+	__m256i kNeg = _mm256_cmpgt_epi32( zero, k );
+	__m256i y = _mm256_or_si256( _mm256_slli_epi32( sc, 31 ),
+			_mm256_slli_epi32( _mm256_and_si256( a, C_SET1(0x7FFFFF) ), 8 ) );
+	__m256i regime = _mm256_blendv_epi8(
+			_mm256_xor_si256( C_SET1(0x7FFFFFFF), _mm256_srlv_epi32( C_SET1(0x7FFFFFFF), _mm256_add_epi32( k, C_SET1(1) ) ) ),
+			_mm256_srlv_epi32( C_SET1(0x40000000), _mm256_sub_epi32( zero, k ) ), kNeg );
+	__m256i shift = _mm256_blendv_epi8( _mm256_add_epi32( k, C_SET1(3) ), _mm256_sub_epi32( C_SET1(2), k ), kNeg );
+	__m256i body = _mm256_or_si256( regime, _mm256_srlv_epi32( y, shift ) );
+	__m256i lost = _mm256_or_si256( _mm256_sllv_epi32( y, _mm256_sub_epi32( C_SET1(32), shift ) ),
+			_mm256_and_si256( body, C_SET1(0x7FFF) ) );
+	__m256i uiZ = _mm256_srli_epi32( body, 16 );
+	__m256i sticky = _mm256_andnot_si256( _mm256_cmpeq_epi32( lost, zero ), C_SET1(1) );
+	__m256i up = _mm256_and_si256( _mm256_srli_epi32( body, 15 ), _mm256_or_si256( sticky, uiZ ) );
+	__m256i neg = _mm256_srai_epi32( uA, 31 );
+
+	uiZ = _mm256_add_epi32( uiZ, _mm256_and_si256( up, C_SET1(1) ) );
+	uiZ = _mm256_blendv_epi8( uiZ, C_SET1(0x1), _mm256_cmpgt_epi32( C_SET1(-28), scale ) );
+	uiZ = _mm256_blendv_epi8( uiZ, C_SET1(0x7FFF), _mm256_cmpgt_epi32( scale, C_SET1(27) ) );
+	uiZ = _mm256_and_si256( _mm256_sub_epi32( _mm256_xor_si256( uiZ, neg ), neg ), C_SET1(0xFFFF) );
+	uiZ = _mm256_andnot_si256( _mm256_cmpeq_epi32( a, zero ), uiZ );
+	uiZ = _mm256_blendv_epi8( uiZ, C_SET1(0x8000), _mm256_cmpgt_epi32( a, C_SET1(0x7F7FFFFF) ) );
+	return c_pack32To16x8( uiZ );
+}
+
+static inline __m256i c_p16UIToFloatBitsx8( __m128i p ){
+	__m256i zero = _mm256_setzero_si256();
+	__m256i uiA = _mm256_cvtepu16_epi32( p );
+	__m256i sign = _mm256_cmpgt_epi32( uiA, C_SET1(0x7FFF) );
+	__m256i a = _mm256_and_si256( _mm256_sub_epi32( _mm256_xor_si256( uiA, sign ), sign ), C_SET1(0xFFFF) );
+	__m256i t = _mm256_slli_epi32( a, 17 );
+	__m256i regS = _mm256_srai_epi32( t, 31 );
+	__m256i top = _mm256_srli_epi32( _mm256_xor_si256( t, regS ), 16 );
+	__m256i run = _mm256_sub_epi32( C_SET1(142),
+			_mm256_srli_epi32( _mm256_castps_si256( _mm256_cvtepi32_ps( top ) ), 23 ) );
+	__m256i k = _mm256_blendv_epi8( _mm256_sub_epi32( zero, run ), _mm256_sub_epi32( run, C_SET1(1) ), regS );
+	__m256i f;
+
+	t = _mm256_sllv_epi32( t, _mm256_add_epi32( run, C_SET1(1) ) );
+	f = _mm256_add_epi32( _mm256_add_epi32( k, k ), _mm256_add_epi32( _mm256_srli_epi32( t, 31 ), C_SET1(127) ) );
+	f = _mm256_or_si256( _mm256_slli_epi32( f, 23 ), _mm256_srli_epi32( _mm256_slli_epi32( t, 1 ), 9 ) );
+	f = _mm256_or_si256( f, _mm256_and_si256( sign, C_SET1(0x80000000) ) );
+	f = _mm256_andnot_si256( _mm256_cmpeq_epi32( uiA, zero ), f );
+	return _mm256_blendv_epi8( f, C_SET1(0x7FC00000), _mm256_cmpeq_epi32( uiA, C_SET1(0x8000) ) );
+}
+
+#endif
+
+union c_ui32_f32 { uint32_t ui; float f; };
+
+void convertFloatToP16_n( const float * a, size_t n, posit16_t * z ){
+	union c_ui32_f32 uA;
+	size_t i = 0;
+
+#ifdef __AVX2__
+	for (; i+8<=n; i+=8)
+		_mm_storeu_si128( (__m128i *) (z+i), c_floatBitsToP16x8( _mm256_loadu_si256( (const __m256i *) (a+i) ) ) );
+#endif
+	for (; i<n; i++){
+		uA.f = a[i];
+		z[i].v = c_floatBitsToP16UI( uA.ui );
+	}
+}
+
+void convertP16ToFloat_n( const posit16_t * a, size_t n, float * z ){
+	union c_ui32_f32 uZ;
+	size_t i = 0;
+
+#ifdef __AVX2__
+	for (; i+8<=n; i+=8)
+		_mm256_storeu_si256( (__m256i *) (z+i), c_p16UIToFloatBitsx8( _mm_loadu_si128( (const __m128i *) (a+i) ) ) );
+#endif
+	for (; i<n; i++){
+		uZ.ui = c_p16UIToFloatBits( a[i].v );
+		z[i] = uZ.f;
+	}
+}
+
+void convertHalfToP16_n( const uint16_t * a, size_t n, posit16_t * z ){
+	size_t i = 0;
+
+#if defined(__AVX2__) && defined(__F16C__)
+	for (; i+8<=n; i+=8){
+		__m256 f = _mm256_cvtph_ps( _mm_loadu_si128( (const __m128i *) (a+i) ) );
+		_mm_storeu_si128( (__m128i *) (z+i), c_floatBitsToP16x8( _mm256_castps_si256( f ) ) );
+	}
+#endif
+	for (; i<n; i++) z[i].v = c_halfBitsToP16UI( a[i] );
+}
+
+void convertP16ToHalf_n( const posit16_t * a, size_t n, uint16_t * z ){
+	size_t i = 0;
+
+#if defined(__AVX2__) && defined(__F16C__)
+	for (; i+8<=n; i+=8){
+		__m256i f = c_p16UIToFloatBitsx8( _mm_loadu_si128( (const __m128i *) (a+i) ) );
+		_mm_storeu_si128( (__m128i *) (z+i), _mm256_cvtps_ph( _mm256_castsi256_ps( f ), _MM_FROUND_TO_NEAREST_INT ) );
+	}
+#endif
+	for (; i<n; i++) z[i] = c_floatBitsToHalf( c_p16UIToFloatBits( a[i].v ) );
+}
+
+void convertBF16ToP16_n( const uint16_t * a, size_t n, posit16_t * z ){
+	size_t i = 0;
+
+#ifdef __AVX2__
+	for (; i+8<=n; i+=8){
+		__m256i f = _mm256_slli_epi32( _mm256_cvtepu16_epi32( _mm_loadu_si128( (const __m128i *) (a+i) ) ), 16 );
+		_mm_storeu_si128( (__m128i *) (z+i), c_floatBitsToP16x8( f ) );
+	}
+#endif
+	for (; i<n; i++) z[i].v = c_floatBitsToP16UI( (uint32_t) a[i]<<16 );
+}
+
+void convertP16ToBF16_n( const posit16_t * a, size_t n, uint16_t * z ){
+	size_t i = 0;
+
+#ifdef __AVX2__
+	for (; i+8<=n; i+=8){
+		__m256i f = c_p16UIToFloatBitsx8( _mm_loadu_si128( (const __m128i *) (a+i) ) );
+		f = _mm256_add_epi32( f, _mm256_add_epi32( C_SET1(0x7FFF), _mm256_and_si256( _mm256_srli_epi32( f, 16 ), C_SET1(1) ) ) );
+		_mm_storeu_si128( (__m128i *) (z+i), c_pack32To16x8( _mm256_srli_epi32( f, 16 ) ) );
+	}
+#endif
+	for (; i<n; i++) z[i] = c_floatBitsToBF16( c_p16UIToFloatBits( a[i].v ) );
+}
+
+#endif
+
+posit16_t convertHalfToP16( uint16_t a ){
+	union ui16_p16 uZ;
+	uZ.ui = c_halfBitsToP16UI( a );
+	return uZ.p;
+}
+
+uint16_t convertP16ToHalf( posit16_t a ){
+	return c_floatBitsToHalf( c_p16UIToFloatBits( a.v ) );
+}
+
+posit16_t convertBF16ToP16( uint16_t a ){
+	union ui16_p16 uZ;
+	uZ.ui = c_floatBitsToP16UI( (uint32_t) a<<16 );
+	return uZ.p;
+}
+
+uint16_t convertP16ToBF16( posit16_t a ){
+	return c_floatBitsToBF16( c_p16UIToFloatBits( a.v ) );
+}
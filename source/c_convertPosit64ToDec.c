@@ -296,7 +296,8 @@ double convertP64ToDouble(posit64_t pA){
 }*/
 
 
-double convertPX2ToDouble(posit_2_t a){
+//Defined in c_convertPosit32ToDec.c; a second copy here broke linking both.
+/*double convertPX2ToDouble(posit_2_t a){
 	union ui32_pX2 uZ;
 	double d32;
 	uZ.p = a;
@@ -357,6 +358,6 @@ double convertPX2ToDouble(posit_2_t a){
 
 	return d32;
 
-}
+}*/
 
 
@@ -0,0 +1,567 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Decimal text to and from posits without stdio or the C locale.  Parsing
+| is correctly rounded: short inputs are converted exactly in 128-bit
+| arithmetic, anything longer in a small fixed-size big integer.  Printing
+| gives the shortest decimal that parses back to the same posit (free-format
+| digit generation over the exact interval of values that round to it),
+| in fixed or scientific notation, whichever is shorter.  Every width goes
+| through the same code on its bit pattern, nbits and es.
+*----------------------------------------------------------------------------*/
+#define C_MAXDIGITS 800     //more than enough to separate any two p64 midpoints
+#define C_MAXDECEXP 80      //|x| >= 1e80 or < 1e-80 lies outside every posit range
+#define C_BIGLIMBS 128
+
+typedef struct { int n; uint32_t d[C_BIGLIMBS]; } c_bigInt;
+
+static const uint64_t c_pow10[20] = {
+	1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+	100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL,
+	1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+	1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+	1000000000000000000ULL, 10000000000000000000ULL
+};
+
+static void c_bigSet( c_bigInt * a, unsigned __int128 v ){
+	a->n = 0;
+	while (v){
+		a->d[a->n++] = (uint32_t) v;
+		v >>= 32;
+	}
+}
+
+static void c_bigMulAdd( c_bigInt * a, uint32_t m, uint32_t c ){
+	uint64_t carry = c;
+	int i;
+
+	for (i=0; i<a->n; i++){
+		carry += (uint64_t) a->d[i] * m;
+		a->d[i] = (uint32_t) carry;
+		carry >>= 32;
+	}
+	if (carry) a->d[a->n++] = (uint32_t) carry;
+}
+
+static void c_bigMulPow5( c_bigInt * a, int k ){
+	for (; k>=13; k-=13) c_bigMulAdd( a, 1220703125, 0 );
+	if (k) c_bigMulAdd( a, (uint32_t) (c_pow10[k]>>k), 0 );
+}
+
+static void c_bigShl( c_bigInt * a, int bits ){
+	int words = bits>>5, i;
+
+	bits &= 31;
+	if (a->n==0) return;
+	if (bits){
+		a->d[a->n] = 0;
+		for (i=a->n; i>0; i--) a->d[i] = (a->d[i]<<bits) | (a->d[i-1]>>(32-bits));
+		a->d[0] <<= bits;
+		if (a->d[a->n]) a->n++;
+	}
+	if (words){
+		for (i=a->n-1; i>=0; i--) a->d[i+words] = a->d[i];
+		for (i=0; i<words; i++) a->d[i] = 0;
+		a->n += words;
+	}
+}
+
+static void c_bigShr1( c_bigInt * a ){
+	int i;
+
+	for (i=0; i<a->n-1; i++) a->d[i] = (a->d[i]>>1) | (a->d[i+1]<<31);
+	if (a->n){
+		a->d[a->n-1] >>= 1;
+		if (a->d[a->n-1]==0) a->n--;
+	}
+}
+
+static void c_bigMulPow10( c_bigInt * a, int k ){
+	c_bigMulPow5( a, k );
+	c_bigShl( a, k );
+}
+
+static int c_bigBits( const c_bigInt * a ){
+	return a->n ? 32*a->n - __builtin_clz( a->d[a->n-1] ) : 0;
+}
+
+static int c_bigCmp( const c_bigInt * a, const c_bigInt * b ){
+	int i;
+
+	if (a->n!=b->n) return (a->n>b->n) ? 1 : -1;
+	for (i=a->n-1; i>=0; i--)
+		if (a->d[i]!=b->d[i]) return (a->d[i]>b->d[i]) ? 1 : -1;
+	return 0;
+}
+
+//a -= b, for a >= b
+static void c_bigSub( c_bigInt * a, const c_bigInt * b ){
+	int64_t borrow = 0;
+	int i;
+
+	for (i=0; i<a->n; i++){
+		borrow += (int64_t) a->d[i] - (i<b->n ? b->d[i] : 0);
+		a->d[i] = (uint32_t) borrow;
+		borrow >>= 32;
+	}
+	while (a->n && a->d[a->n-1]==0) a->n--;
+}
+
+static void c_bigAdd( c_bigInt * z, const c_bigInt * a, const c_bigInt * b ){
+	uint64_t carry = 0;
+	int i, n = (a->n>b->n) ? a->n : b->n;
+
+	for (i=0; i<n; i++){
+		carry += (uint64_t) (i<a->n ? a->d[i] : 0) + (i<b->n ? b->d[i] : 0);
+		z->d[i] = (uint32_t) carry;
+		carry >>= 32;
+	}
+	z->n = n;
+	if (carry) z->d[z->n++] = (uint32_t) carry;
+}
+
+//Top 64 bits, left-aligned, and whether any bit below them is set
+static uint_fast64_t c_bigTop64( const c_bigInt * a, bool * sticky ){
+	unsigned __int128 top = 0;
+	int i;
+
+	for (i=a->n-1; i>=a->n-3; i--) top = (top<<32) | (i>=0 ? a->d[i] : 0);
+	top <<= 32 + __builtin_clz( a->d[a->n-1] );
+	*sticky = (uint64_t) top!=0;
+	for (i=a->n-4; i>=0; i--) *sticky |= a->d[i]!=0;
+	return (uint_fast64_t) (top>>64);
+}
+
+//Normalises w so its leading one is at bit 127; returns that bit's index
+static int_fast32_t c_wideTop( unsigned __int128 w, uint_fast64_t * sig, bool * sticky ){
+	uint_fast64_t hi = (uint_fast64_t) (w>>64);
+	int lz = hi ? __builtin_clzll(hi) : 64 + __builtin_clzll((uint64_t) w);
+
+	w <<= lz;
+	*sig = (uint_fast64_t) (w>>64);
+	*sticky = (uint64_t) w!=0;
+	return 127-lz;
+}
+
+/*----------------------------------------------------------------------------
+| Scale and top 64 bits (plus sticky) of digits * 10^exp10, exactly.
+*----------------------------------------------------------------------------*/
+static int_fast32_t c_decimalToBinary(
+	const uint8_t * digits, int nDigits, int_fast32_t exp10, uint_fast64_t * sig, bool * sticky ){
+
+	c_bigInt num, den;
+	unsigned __int128 wide = 0;
+	int_fast32_t scale;
+	int i, j, shift;
+
+	if (nDigits<=19 && exp10>-20 && exp10<20){
+		uint64_t d = 0, rem;
+		int lz;
+
+		for (i=0; i<nDigits; i++) d = d*10 + digits[i];
+		if (exp10>=0) return c_wideTop( (unsigned __int128) d * c_pow10[exp10], sig, sticky );
+		lz = __builtin_clzll(d);
+		wide = (unsigned __int128) (d<<lz) << 64;
+		rem = (uint64_t) (wide % c_pow10[-exp10]);
+		scale = c_wideTop( wide / c_pow10[-exp10], sig, sticky ) - 64 - lz;
+		*sticky |= rem!=0;
+		return scale;
+	}
+
+	c_bigSet( &num, 0 );
+	for (i=0; i<nDigits; i+=9){
+		uint32_t chunk = 0;
+		for (j=i; j<i+9 && j<nDigits; j++) chunk = chunk*10 + digits[j];
+		c_bigMulAdd( &num, (uint32_t) c_pow10[j-i], chunk );
+	}
+	if (exp10>=0){
+		c_bigMulPow5( &num, exp10 );
+		*sig = c_bigTop64( &num, sticky );
+		return c_bigBits( &num ) - 1 + exp10;
+	}
+
+	//Long division to a quotient of 65 or 66 bits; 10^-k = 5^-k * 2^-k
+	c_bigSet( &den, 1 );
+	c_bigMulPow5( &den, -exp10 );
+	shift = 65 - (c_bigBits( &num ) - c_bigBits( &den ));
+	if (shift>0) c_bigShl( &num, shift );
+	else c_bigShl( &den, -shift );
+	c_bigShl( &den, 65 );
+	for (i=65; i>=0; i--){
+		if (c_bigCmp( &num, &den )>=0){
+			c_bigSub( &num, &den );
+			wide |= (unsigned __int128) 1<<i;
+		}
+		c_bigShr1( &den );
+	}
+	scale = c_wideTop( wide, sig, sticky ) - shift + exp10;
+	*sticky |= num.n!=0;
+	return scale;
+}
+
+static bool c_matchWord( const char ** p, const char * last, const char * word ){
+	const char * q = *p;
+
+	for (; *word; word++, q++)
+		if (q==last || (*q|0x20)!=*word) return 0;
+	*p = q;
+	return 1;
+}
+
+static inline bool c_isSeparator( char c ){
+	return c==',' || c==';' || c==' ' || c=='\t' || c=='\n' || c=='\r';
+}
+
+/*----------------------------------------------------------------------------
+| Parses [+-]digits[.digits][(e|E)[+-]digits] or, in any case, NaR, NaN, inf
+| or infinity (all giving NaR) into an nbits-wide pattern.  Returns the end
+| of the number, or first if there is none.
+*----------------------------------------------------------------------------*/
+const char * softposit_parsePosit( const char * first, const char * last, int nbits, int es, uint_fast64_t * uiZ ){
+	const char * p = first, * q;
+	uint8_t digits[C_MAXDIGITS+1];
+	int nDigits = 0, nSeen = 0;
+	int_fast32_t exp10 = 0, e = 0, scale, decExp;
+	uint_fast64_t sig = 0x8000000000000000ULL, mag;
+	bool sign = 0, expSign = 0, sticky = 0, dropped = 0, point = 0;
+
+	if (p<last && (*p=='-' || *p=='+')) sign = *p++=='-';
+	q = p;
+	if (c_matchWord( &q, last, "nar" ) || c_matchWord( &q, last, "nan" )
+			|| c_matchWord( &q, last, "infinity" ) || c_matchWord( &q, last, "inf" )){
+		*uiZ = 1ULL<<(nbits-1);
+		return q;
+	}
+	for (; p<last; p++){
+		if (*p=='.' && !point){
+			point = 1;
+			continue;
+		}
+		if (*p<'0' || *p>'9') break;
+		nSeen++;
+		if (nDigits==0 && *p=='0'){
+			exp10 -= point;
+		}
+		else if (nDigits<C_MAXDIGITS){
+			digits[nDigits++] = *p-'0';
+			exp10 -= point;
+		}
+		else{
+			dropped |= *p!='0';
+			exp10 += !point;
+		}
+	}
+	if (nSeen==0) return first;
+	if (p<last && (*p=='e' || *p=='E')){
+		q = p+1;
+		if (q<last && (*q=='-' || *q=='+')) expSign = *q++=='-';
+		if (q<last && *q>='0' && *q<='9'){
+			for (; q<last && *q>='0' && *q<='9'; q++)
+				if (e<100000) e = e*10 + (*q-'0');
+			exp10 += expSign ? -e : e;
+			p = q;
+		}
+	}
+
+	//A nonzero digit past the kept ones only matters as a sticky digit
+	if (dropped){
+		digits[nDigits++] = 1;
+		exp10--;
+	}
+	else while (nDigits && digits[nDigits-1]==0){
+		nDigits--;
+		exp10++;
+	}
+	if (nDigits==0){
+		*uiZ = 0;
+		return p;
+	}
+	decExp = nDigits + exp10;
+	if (decExp>C_MAXDECEXP) scale = 1<<20;
+	else if (decExp<-C_MAXDECEXP) scale = -(1<<20);
+	else scale = c_decimalToBinary( digits, nDigits, exp10, &sig, &sticky );
+
+	mag = softposit_roundPackMagPX( scale, sig, sticky, nbits, es );
+	*uiZ = sign ? -mag & (~0ULL>>(64-nbits)) : mag;
+	return p;
+}
+
+/*----------------------------------------------------------------------------
+| Exact value f*2^e of a magnitude pattern of up to 65 bits; midpoints
+| between neighbouring nbits posits are the odd patterns of nbits+1.
+*----------------------------------------------------------------------------*/
+static void c_decodeExact( unsigned __int128 mag, int nbits, int es, c_bigInt * f, int_fast32_t * e ){
+	unsigned __int128 t = mag << (129-nbits), x;
+	bool regS = t>>127;
+	int_fast32_t k, run, tz;
+	uint_fast64_t hi;
+
+	x = regS ? ~t : t;
+	hi = (uint_fast64_t) (x>>64);
+	run = hi ? __builtin_clzll(hi) : 64 + __builtin_clzll((uint64_t) x);
+	k = regS ? run-1 : -run;
+	t = (run<127) ? t<<(run+1) : 0;
+	*e = k*(1<<es) + (es ? (int_fast32_t) (t>>(128-es)) : 0) - 127;
+	t = ((unsigned __int128) 1<<127) | ((t<<es)>>1);
+	hi = (uint_fast64_t) t;
+	tz = hi ? __builtin_ctzll(hi) : 64 + __builtin_ctzll((uint64_t) (t>>64));
+	c_bigSet( f, t>>tz );
+	*e += tz;
+}
+
+//(a+b) compared with c*10^k, with a power of ten on the smaller side
+static int c_bigCmpScaled( const c_bigInt * a, const c_bigInt * b, const c_bigInt * c, int_fast32_t k ){
+	c_bigInt lhs, rhs = *c;
+
+	c_bigAdd( &lhs, a, b );
+	if (k>=0) c_bigMulPow10( &rhs, k );
+	else c_bigMulPow10( &lhs, -k );
+	return c_bigCmp( &lhs, &rhs );
+}
+
+/*----------------------------------------------------------------------------
+| Shortest digits d1 d2 ... dn with 0.d1d2...dn * 10^k rounding back to the
+| magnitude pattern mag (free-format generation after Steele & White and
+| Burger & Dybvig).  The interval is bounded by the two neighbouring
+| midpoints, closed when mag is even since ties round to even; minpos and
+| maxpos, which absorb everything beyond them, use their inner gap on both
+| sides, except that minpos never reaches down to zero, which does not round
+| to it.
+*----------------------------------------------------------------------------*/
+static int c_shortestDigits( uint_fast64_t mag, int nbits, int es, char * digits, int_fast32_t * k10 ){
+	c_bigInt r, s, mp, mm, lo, hi, t;
+	int_fast32_t e, eLo = 0, eHi = 0, eMin, k;
+	bool hasLo = mag>1, hasHi = mag<(~0ULL>>(65-nbits));
+	bool inclusive = !(mag&1), tc1, tc2;
+	int n = 0, d, c;
+
+	c_decodeExact( mag, nbits, es, &r, &e );
+	if (hasLo) c_decodeExact( ((unsigned __int128) mag<<1) - 1, nbits+1, es, &lo, &eLo );
+	if (hasHi) c_decodeExact( ((unsigned __int128) mag<<1) + 1, nbits+1, es, &hi, &eHi );
+	eMin = e;
+	if (hasLo && eLo<eMin) eMin = eLo;
+	if (hasHi && eHi<eMin) eMin = eHi;
+	c_bigShl( &r, e-eMin );
+	if (hasLo){
+		c_bigShl( &lo, eLo-eMin );
+		mm = r;
+		c_bigSub( &mm, &lo );
+	}
+	if (hasHi){
+		c_bigShl( &hi, eHi-eMin );
+		mp = hi;
+		c_bigSub( &mp, &r );
+	}
+	if (!hasLo && !hasHi) mp = r;    //2-bit posits: 1 takes every positive value
+	if (!hasLo){
+		mm = mp;
+		//minpos is odd, so the interval is open and stays above zero
+		if (c_bigCmp( &mm, &r )>0) mm = r;
+	}
+	if (!hasHi) mp = mm;
+	c_bigSet( &s, 1 );
+	if (eMin<0) c_bigShl( &s, -eMin );
+	else{
+		c_bigShl( &r, eMin );
+		c_bigShl( &mp, eMin );
+		c_bigShl( &mm, eMin );
+	}
+
+	//Smallest k with the upper bound below 10^k
+	k = (int_fast32_t) ((c_bigBits( &r ) - c_bigBits( &s )) * 0.30102999566398120);
+	while ((c = c_bigCmpScaled( &r, &mp, &s, k ))>0 || (inclusive && c==0)) k++;
+	while ((c = c_bigCmpScaled( &r, &mp, &s, k-1 ))<0 || (!inclusive && c==0)) k--;
+	if (k>=0) c_bigMulPow10( &s, k );
+	else{
+		c_bigMulPow10( &r, -k );
+		c_bigMulPow10( &mp, -k );
+		c_bigMulPow10( &mm, -k );
+	}
+
+	for (;;){
+		c_bigMulAdd( &r, 10, 0 );
+		c_bigMulAdd( &mp, 10, 0 );
+		c_bigMulAdd( &mm, 10, 0 );
+		for (d=0; c_bigCmp( &r, &s )>=0; d++) c_bigSub( &r, &s );
+		c = c_bigCmp( &r, &mm );
+		tc1 = inclusive ? c<=0 : c<0;
+		c_bigAdd( &t, &r, &mp );
+		c = c_bigCmp( &t, &s );
+		tc2 = inclusive ? c>=0 : c>0;
+		if (!tc1 && !tc2){
+			digits[n++] = '0'+d;
+			continue;
+		}
+		if (tc1 && tc2){
+			c_bigAdd( &t, &r, &r );
+			c = c_bigCmp( &t, &s );
+			d += (c>0) || (c==0 && (d&1));
+		}
+		else d += tc2;
+		digits[n++] = '0'+d;
+		break;
+	}
+	*k10 = k;
+	return n;
+}
+
+static char * c_formatPosit( char * first, char * last, uint_fast64_t uiA, int nbits, int es ){
+	char digits[40], buf[64], * p = buf;
+	uint_fast64_t mag;
+	int_fast32_t k, x;
+	int n, i, fixedLen, sciLen;
+	bool sign = uiA>>(nbits-1);
+
+	if (uiA==0) *p++ = '0';
+	else if (uiA==1ULL<<(nbits-1)){
+		*p++ = 'N';
+		*p++ = 'a';
+		*p++ = 'R';
+	}
+	else{
+		mag = sign ? -uiA & (~0ULL>>(64-nbits)) : uiA;
+		n = c_shortestDigits( mag, nbits, es, digits, &k );
+		x = k-1;
+		fixedLen = (k<=0) ? n+2-k : (k<n) ? n+1 : k;
+		sciLen = n + (n>1) + 2 + ((x>=100 || x<=-100) ? 3 : 2);
+		if (sign) *p++ = '-';
+		if (fixedLen<=sciLen){
+			if (k<=0){
+				*p++ = '0';
+				*p++ = '.';
+				for (i=0; i<-k; i++) *p++ = '0';
+				for (i=0; i<n; i++) *p++ = digits[i];
+			}
+			else{
+				for (i=0; i<n || i<k; i++){
+					if (i==k) *p++ = '.';
+					*p++ = (i<n) ? digits[i] : '0';
+				}
+			}
+		}
+		else{
+			*p++ = digits[0];
+			if (n>1) *p++ = '.';
+			for (i=1; i<n; i++) *p++ = digits[i];
+			*p++ = 'e';
+			*p++ = (x<0) ? '-' : '+';
+			if (x<0) x = -x;
+			if (x>=100) *p++ = '0' + x/100;
+			*p++ = '0' + (x/10)%10;
+			*p++ = '0' + x%10;
+		}
+	}
+	if (last-first < p-buf) return 0;
+	for (i=0; i<p-buf; i++) first[i] = buf[i];
+	return first + (p-buf);
+}
+
+/*----------------------------------------------------------------------------
+| Batch forms for delimited text (commas, semicolons or whitespace).  Parsing
+| stops before a number that touches the end of the buffer unless final is
+| set, so a file can be fed through in chunks, each continuing from *next.
+| Fields that are not numbers become NaR.  Formatting writes the values with
+| sep between them, none after the last, until the buffer or the input runs
+| out; a caller continuing a list in a new call writes the separator first.
+*----------------------------------------------------------------------------*/
+#define C_POSIT_CHARS( pN, positN_t, nbits, es ) \
+	const char * pN##_from_chars( const char * first, const char * last, positN_t * a ){ \
+		uint_fast64_t uiZ; \
+		const char * end = softposit_parsePosit( first, last, nbits, es, &uiZ ); \
+		if (end!=first) a->v = uiZ; \
+		return end; \
+	} \
+	char * pN##_to_chars( char * first, char * last, positN_t a ){ \
+		return c_formatPosit( first, last, a.v, nbits, es ); \
+	} \
+	size_t pN##_from_chars_n( const char * first, const char * last, positN_t * z, size_t n, \
+			bool final, const char ** next ){ \
+		const char * p = first, * end; \
+		uint_fast64_t uiZ; \
+		size_t i = 0; \
+		while (i<n){ \
+			while (p<last && c_isSeparator(*p)) p++; \
+			for (end=p; end<last && !c_isSeparator(*end); end++); \
+			if (p==last || (end==last && !final)) break; \
+			if (softposit_parsePosit( p, end, nbits, es, &uiZ )!=end) uiZ = 1ULL<<(nbits-1); \
+			z[i++].v = uiZ; \
+			p = end; \
+		} \
+		*next = p; \
+		return i; \
+	} \
+	size_t pN##_to_chars_n( char * first, char * last, const positN_t * a, size_t n, \
+			char sep, char ** next ){ \
+		char * p = first, * end; \
+		size_t i; \
+		for (i=0; i<n; i++){ \
+			if (i && p==last) break; \
+			end = c_formatPosit( p + (i>0), last, a[i].v, nbits, es ); \
+			if (!end) break; \
+			if (i) *p = sep; \
+			p = end; \
+		} \
+		*next = p; \
+		return i; \
+	}
+
+C_POSIT_CHARS( p8, posit8_t, 8, 0 )
+C_POSIT_CHARS( p16, posit16_t, 16, 1 )
+C_POSIT_CHARS( p32, posit32_t, 32, 2 )
+C_POSIT_CHARS( p64, posit64_t, 64, 2 )
+
+const char * pX2_from_chars( const char * first, const char * last, posit_2_t * a, int x ){
+	uint_fast64_t uiZ;
+	const char * end;
+
+	if (x<2 || x>32) return first;
+	end = softposit_parsePosit( first, last, x, 2, &uiZ );
+	if (end!=first) a->v = (uint32_t) uiZ<<(32-x);
+	return end;
+}
+
+char * pX2_to_chars( char * first, char * last, posit_2_t a, int x ){
+	if (x<2 || x>32) return 0;
+	return c_formatPosit( first, last, a.v>>(32-x), x, 2 );
+}
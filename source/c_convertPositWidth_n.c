@@ -0,0 +1,160 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Batch conversions between every pair of posit formats: posit8, posit16,
+| posit32 and the dynamic-width pX0/pX1/pX2.  Each element is decoded and
+| rounded once (to nearest even, saturating at maxpos and minpos) exactly
+| as softposit_convertPX does; the AVX2 path handles eight elements per
+| step with softposit_decodePXx8/packPXx8.  Invalid pX widths give NaR.
+*----------------------------------------------------------------------------*/
+static inline uint_fast32_t c_loadPX( const void * a, int bytes, size_t i ){
+	if (bytes==1) return (uint_fast32_t) ((const uint8_t *) a)[i]<<24;
+	if (bytes==2) return (uint_fast32_t) ((const uint16_t *) a)[i]<<16;
+	return ((const uint32_t *) a)[i];
+}
+
+static inline void c_storePX( void * z, int bytes, size_t i, uint_fast32_t uiZ ){
+	if (bytes==1) ((uint8_t *) z)[i] = uiZ>>24;
+	else if (bytes==2) ((uint16_t *) z)[i] = uiZ>>16;
+	else ((uint32_t *) z)[i] = uiZ;
+}
+
+#ifdef __AVX2__
+static inline __m256i c_loadPXx8( const void * a, int bytes, size_t i ){
+	if (bytes==1)
+		return _mm256_slli_epi32( _mm256_cvtepu8_epi32( _mm_loadl_epi64( (const __m128i *) ((const uint8_t *) a + i) ) ), 24 );
+	if (bytes==2)
+		return _mm256_slli_epi32( _mm256_cvtepu16_epi32( _mm_loadu_si128( (const __m128i *) ((const uint16_t *) a + i) ) ), 16 );
+	return _mm256_loadu_si256( (const __m256i *) ((const uint32_t *) a + i) );
+}
+
+static inline void c_storePXx8( void * z, int bytes, size_t i, __m256i uiZ ){
+	if (bytes==1){
+		uiZ = _mm256_packus_epi32( _mm256_srli_epi32( uiZ, 24 ), uiZ );
+		uiZ = _mm256_packus_epi16( uiZ, uiZ );
+		uiZ = _mm256_permutevar8x32_epi32( uiZ, _mm256_setr_epi32( 0, 4, 0, 0, 0, 0, 0, 0 ) );
+		_mm_storel_epi64( (__m128i *) ((uint8_t *) z + i), _mm256_castsi256_si128( uiZ ) );
+	}
+	else if (bytes==2){
+		uiZ = _mm256_srli_epi32( uiZ, 16 );
+		uiZ = _mm256_permute4x64_epi64( _mm256_packus_epi32( uiZ, uiZ ), 0x08 );
+		_mm_storeu_si128( (__m128i *) ((uint16_t *) z + i), _mm256_castsi256_si128( uiZ ) );
+	}
+	else _mm256_storeu_si256( (__m256i *) ((uint32_t *) z + i), uiZ );
+}
+
+static inline __m256i c_convertPXx8( __m256i uA, int esA, int nbitsZ, int esZ ){
+	__m256i special = _mm256_or_si256( _mm256_cmpeq_epi32( uA, _mm256_setzero_si256() ),
+			_mm256_cmpeq_epi32( uA, _mm256_set1_epi32( 0x80000000 ) ) );
+	__m256i sign, frac, scale;
+
+	scale = softposit_decodePXx8( uA, esA, &sign, &frac );
+	return _mm256_blendv_epi8( softposit_packPXx8( sign, scale, frac, nbitsZ, esZ ), uA, special );
+}
+#endif
+
+static inline void c_convertPX_n( const void * a, int bytesA, int esA, size_t n,
+		void * z, int bytesZ, int nbitsZ, int esZ ){
+	size_t i = 0;
+
+	if (nbitsZ<2 || nbitsZ>32){
+		for (; i<n; i++) c_storePX( z, bytesZ, i, 0x80000000 );
+		return;
+	}
+#ifdef __AVX2__
+	for (; i+8<=n; i+=8)
+		c_storePXx8( z, bytesZ, i, c_convertPXx8( c_loadPXx8( a, bytesA, i ), esA, nbitsZ, esZ ) );
+#endif
+	for (; i<n; i++)
+		c_storePX( z, bytesZ, i, softposit_convertPX( c_loadPX( a, bytesA, i ), esA, nbitsZ, esZ ) );
+}
+
+#define C_CONVERT_N( name, typeA, bytesA, esA, typeZ, bytesZ, nbitsZ, esZ ) \
+void name##_n( const typeA * a, size_t n, typeZ * z ){ \
+	c_convertPX_n( a, bytesA, esA, n, z, bytesZ, nbitsZ, esZ ); \
+}
+
+#define C_CONVERT_X_N( name, typeA, bytesA, esA, typeZ, esZ ) \
+void name##_n( const typeA * a, size_t n, typeZ * z, int x ){ \
+	c_convertPX_n( a, bytesA, esA, n, z, 4, x, esZ ); \
+}
+
+C_CONVERT_N( p8_to_p16, posit8_t, 1, 0, posit16_t, 2, 16, 1 )
+C_CONVERT_N( p8_to_p32, posit8_t, 1, 0, posit32_t, 4, 32, 2 )
+C_CONVERT_X_N( p8_to_pX0, posit8_t, 1, 0, posit_0_t, 0 )
+C_CONVERT_X_N( p8_to_pX1, posit8_t, 1, 0, posit_1_t, 1 )
+C_CONVERT_X_N( p8_to_pX2, posit8_t, 1, 0, posit_2_t, 2 )
+
+C_CONVERT_N( p16_to_p8, posit16_t, 2, 1, posit8_t, 1, 8, 0 )
+C_CONVERT_N( p16_to_p32, posit16_t, 2, 1, posit32_t, 4, 32, 2 )
+C_CONVERT_X_N( p16_to_pX0, posit16_t, 2, 1, posit_0_t, 0 )
+C_CONVERT_X_N( p16_to_pX1, posit16_t, 2, 1, posit_1_t, 1 )
+C_CONVERT_X_N( p16_to_pX2, posit16_t, 2, 1, posit_2_t, 2 )
+
+C_CONVERT_N( p32_to_p8, posit32_t, 4, 2, posit8_t, 1, 8, 0 )
+C_CONVERT_N( p32_to_p16, posit32_t, 4, 2, posit16_t, 2, 16, 1 )
+C_CONVERT_X_N( p32_to_pX0, posit32_t, 4, 2, posit_0_t, 0 )
+C_CONVERT_X_N( p32_to_pX1, posit32_t, 4, 2, posit_1_t, 1 )
+C_CONVERT_X_N( p32_to_pX2, posit32_t, 4, 2, posit_2_t, 2 )
+
+C_CONVERT_N( pX0_to_p8, posit_0_t, 4, 0, posit8_t, 1, 8, 0 )
+C_CONVERT_N( pX0_to_p16, posit_0_t, 4, 0, posit16_t, 2, 16, 1 )
+C_CONVERT_N( pX0_to_p32, posit_0_t, 4, 0, posit32_t, 4, 32, 2 )
+C_CONVERT_X_N( pX0_to_pX0, posit_0_t, 4, 0, posit_0_t, 0 )
+C_CONVERT_X_N( pX0_to_pX1, posit_0_t, 4, 0, posit_1_t, 1 )
+C_CONVERT_X_N( pX0_to_pX2, posit_0_t, 4, 0, posit_2_t, 2 )
+
+C_CONVERT_N( pX1_to_p8, posit_1_t, 4, 1, posit8_t, 1, 8, 0 )
+C_CONVERT_N( pX1_to_p16, posit_1_t, 4, 1, posit16_t, 2, 16, 1 )
+C_CONVERT_N( pX1_to_p32, posit_1_t, 4, 1, posit32_t, 4, 32, 2 )
+C_CONVERT_X_N( pX1_to_pX0, posit_1_t, 4, 1, posit_0_t, 0 )
+C_CONVERT_X_N( pX1_to_pX1, posit_1_t, 4, 1, posit_1_t, 1 )
+C_CONVERT_X_N( pX1_to_pX2, posit_1_t, 4, 1, posit_2_t, 2 )
+
+C_CONVERT_N( pX2_to_p8, posit_2_t, 4, 2, posit8_t, 1, 8, 0 )
+C_CONVERT_N( pX2_to_p16, posit_2_t, 4, 2, posit16_t, 2, 16, 1 )
+C_CONVERT_N( pX2_to_p32, posit_2_t, 4, 2, posit32_t, 4, 32, 2 )
+C_CONVERT_X_N( pX2_to_pX0, posit_2_t, 4, 2, posit_0_t, 0 )
+C_CONVERT_X_N( pX2_to_pX1, posit_2_t, 4, 2, posit_1_t, 1 )
+C_CONVERT_X_N( pX2_to_pX2, posit_2_t, 4, 2, posit_2_t, 2 )
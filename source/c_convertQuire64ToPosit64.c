@@ -0,0 +1,78 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include "platform.h"
+#include "internals.h"
+
+//Rounding and saturation count into the statistics bucket stat
+posit64_t softposit_roundQ64ToP64( quire64_t qA, int stat ){
+	union ui64_p64 uZ;
+	uint_fast64_t sig, sticky = 0;
+	int i, j, lz;
+	bool sign;
+
+	if (isNaRQ64( qA )){
+		uZ.ui = 0x8000000000000000ULL;
+		return uZ.p;
+	}
+	sign = qA.v[0]>>63;
+	if (sign) qA = q64_TwosComplement( qA );
+
+	for (i=0; i<16 && !qA.v[i]; i++);
+	if (i==16){
+		uZ.ui = 0;
+		return uZ.p;
+	}
+	lz = __builtin_clzll( qA.v[i] );
+	sig = qA.v[i]<<lz;
+	if (i<15){
+		if (lz) sig |= qA.v[i+1]>>(64-lz);
+		sticky = qA.v[i+1]<<lz;
+		for (j=i+2; j<16; j++) sticky |= qA.v[j];
+	}
+	//The leading one is bit (15-i)*64 + 63-lz, counting from the right
+	uZ.ui = softposit_roundPackMagPXAt( (15-i)*64 + 63 - lz - 496, sig, sticky!=0, 64, 2, stat );
+	if (sign) uZ.ui = -uZ.ui;
+	return uZ.p;
+}
+
+posit64_t q64_to_p64( quire64_t qA ){
+	return softposit_roundQ64ToP64( qA, softposit_stat_pX );
+}
@@ -153,3 +153,26 @@ int64_t pX2_int( posit_2_t pA ){
 
 }
 
+int64_t p64_int( posit64_t pA ){
+	union ui64_p64 uA;
+	uint_fast64_t uiA, sig;
+	int_fast64_t iZ;
+	int_fast32_t scale;
+	bool sign;
+
+	uA.p = pA;
+	uiA = uA.ui;
+
+	if (uiA==0x8000000000000000) return 0x8000000000000000;
+
+	sign = uiA>>63;
+	if (sign) uiA = -uiA;
+
+	if (uiA < 0x4000000000000000) return 0;
+	scale = softposit_decodeMagPX( uiA, 2, &sig );
+	iZ = (scale<63) ? (int_fast64_t) (sig >> (63-scale)) : 0x7FFFFFFFFFFFFFFF;
+
+	if (sign) iZ = -iZ;
+	return iZ;
+}
+
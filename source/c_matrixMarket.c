@@ -0,0 +1,205 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Matrix Market coordinate files (real, integer or pattern; general,
+| symmetric or skew-symmetric) read straight into CSR with posit values.
+| Each value is rounded once from its decimal text, symmetric entries are
+| mirrored, and columns come out ascending within each row.
+*----------------------------------------------------------------------------*/
+typedef struct {
+	const char * p, * last;
+} c_mmCursor;
+
+static bool c_mmWord( c_mmCursor * c, const char * word ){
+	const char * q = c->p;
+
+	while (q<c->last && (*q==' ' || *q=='\t')) q++;
+	for (; *word; word++, q++)
+		if (q==c->last || (*q|0x20)!=*word) return 0;
+	if (q<c->last && *q!=' ' && *q!='\t' && *q!='\r' && *q!='\n') return 0;
+	c->p = q;
+	return 1;
+}
+
+static const char * c_mmToken( c_mmCursor * c, const char ** end ){
+	const char * q = c->p, * start;
+
+	while (q<c->last && (*q==' ' || *q=='\t' || *q=='\r' || *q=='\n')) q++;
+	start = q;
+	while (q<c->last && *q!=' ' && *q!='\t' && *q!='\r' && *q!='\n') q++;
+	c->p = *end = q;
+	return start;
+}
+
+static bool c_mmUint( c_mmCursor * c, uint64_t * v ){
+	const char * end, * q = c_mmToken( c, &end );
+
+	if (q==end) return 0;
+	for (*v=0; q<end; q++){
+		if (*q<'0' || *q>'9') return 0;
+		*v = *v*10 + (*q-'0');
+	}
+	return 1;
+}
+
+static void c_mmNextLine( c_mmCursor * c ){
+	while (c->p<c->last && *c->p!='\n') c->p++;
+	if (c->p<c->last) c->p++;
+}
+
+static void c_mmStore( void * val, uint64_t i, uint_fast64_t ui, int nbits ){
+	switch (nbits){
+		case 8: ((uint8_t *) val)[i] = (uint8_t) ui; break;
+		case 16: ((uint16_t *) val)[i] = (uint16_t) ui; break;
+		case 32: ((uint32_t *) val)[i] = (uint32_t) ui; break;
+		default: ((uint64_t *) val)[i] = ui; break;
+	}
+}
+
+int softposit_readMatrixMarketCSR( const char * path, int nbits, int es, uint64_t * rows, uint64_t * cols,
+		uint64_t * nnz, uint64_t ** rowPtrOut, uint32_t ** colIdxOut, void ** valOut ){
+
+	c_mmCursor c;
+	void * map, * val = 0;
+	size_t mapBytes;
+	uint64_t m, n, entries, capacity, count = 0, i, r, j, * rowPtr = 0;
+	uint32_t * rowOf = 0, * colOf = 0, * colIdx = 0, * order = 0, * byCol = 0;
+	uint_fast64_t ui, * valOf = 0, one = 1ULL<<(nbits-2), mask = ~0ULL>>(64-nbits);
+	const char * tok, * end;
+	bool pattern, symmetric, skew;
+	int bytes = nbits/8, rc = -1;
+
+	map = softposit_mapFile( path, &mapBytes );
+	if (!map) return -1;
+	c.p = map;
+	c.last = c.p + mapBytes;
+	errno = EINVAL;
+
+	if (!c_mmWord( &c, "%%matrixmarket" ) || !c_mmWord( &c, "matrix" ) || !c_mmWord( &c, "coordinate" )) goto done;
+	pattern = c_mmWord( &c, "pattern" );
+	if (!pattern && !c_mmWord( &c, "real" ) && !c_mmWord( &c, "integer" )) goto done;
+	skew = c_mmWord( &c, "skew-symmetric" );
+	symmetric = skew || c_mmWord( &c, "symmetric" );
+	if (!symmetric && !c_mmWord( &c, "general" )) goto done;
+	do c_mmNextLine( &c ); while (c.p<c.last && *c.p=='%');
+	if (!c_mmUint( &c, &m ) || !c_mmUint( &c, &n ) || !c_mmUint( &c, &entries )
+			|| m>=UINT32_MAX || n>=UINT32_MAX || entries>=UINT32_MAX/2) goto done;
+
+	capacity = symmetric ? 2*entries : entries;
+	rowOf = malloc( capacity*sizeof *rowOf + 1 );
+	colOf = malloc( capacity*sizeof *colOf + 1 );
+	valOf = malloc( capacity*sizeof *valOf + 1 );
+	if (!rowOf || !colOf || !valOf){
+		errno = ENOMEM;
+		goto done;
+	}
+	for (i=0; i<entries; i++){
+		if (!c_mmUint( &c, &r ) || !c_mmUint( &c, &j ) || r<1 || r>m || j<1 || j>n) goto done;
+		if (pattern) ui = one;
+		else{
+			tok = c_mmToken( &c, &end );
+			if (tok==end || softposit_parsePosit( tok, end, nbits, es, &ui )!=end) goto done;
+		}
+		rowOf[count] = (uint32_t) (r-1);
+		colOf[count] = (uint32_t) (j-1);
+		valOf[count++] = ui;
+		if (symmetric && r!=j){
+			rowOf[count] = (uint32_t) (j-1);
+			colOf[count] = (uint32_t) (r-1);
+			valOf[count++] = skew ? -ui & mask : ui;
+		}
+	}
+
+	//Counting sort by column, then stably by row
+	rowPtr = calloc( ((m>n) ? m : n) + 1, sizeof *rowPtr );
+	order = malloc( count*sizeof *order + 1 );
+	byCol = malloc( count*sizeof *byCol + 1 );
+	colIdx = malloc( count*sizeof *colIdx + 1 );
+	val = malloc( count*bytes + 1 );
+	if (!rowPtr || !order || !byCol || !colIdx || !val){
+		errno = ENOMEM;
+		goto done;
+	}
+	for (i=0; i<count; i++) rowPtr[colOf[i]+1]++;
+	for (i=0; i<n; i++) rowPtr[i+1] += rowPtr[i];
+	for (i=0; i<count; i++) byCol[rowPtr[colOf[i]]++] = (uint32_t) i;
+	memset( rowPtr, 0, (((m>n) ? m : n) + 1)*sizeof *rowPtr );
+	for (i=0; i<count; i++) rowPtr[rowOf[i]+1]++;
+	for (i=0; i<m; i++) rowPtr[i+1] += rowPtr[i];
+	for (i=0; i<count; i++) order[rowPtr[rowOf[byCol[i]]]++] = byCol[i];
+	for (i=m; i>0; i--) rowPtr[i] = rowPtr[i-1];
+	rowPtr[0] = 0;
+	for (i=0; i<count; i++){
+		colIdx[i] = colOf[order[i]];
+		c_mmStore( val, i, valOf[order[i]], nbits );
+	}
+
+	*rows = m;
+	*cols = n;
+	*nnz = count;
+	*rowPtrOut = rowPtr;
+	*colIdxOut = colIdx;
+	*valOut = val;
+	rowPtr = 0;
+	colIdx = 0;
+	val = 0;
+	rc = 0;
+
+done:
+	free( rowOf );
+	free( colOf );
+	free( valOf );
+	free( order );
+	free( byCol );
+	free( rowPtr );
+	free( colIdx );
+	free( val );
+	munmap( map, mapBytes );
+	return rc;
+}
@@ -0,0 +1,327 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| NumPy .npy files, format versions 1 to 3.  Posit arrays travel as unsigned
+| integers of their width ('u1', 'u2', 'u4', 'u8'), so loading one is a
+| mapping of the file and a cast.  float32 and float64 files are converted
+| into caller-provided posit arrays instead.
+*----------------------------------------------------------------------------*/
+#define C_NPY_ALIGN 64
+
+static bool c_nativeBigEndian( void ){
+	const uint16_t probe = 1;
+	return *(const uint8_t *) &probe==0;
+}
+
+//Position just past "'key':" (or the double-quoted form) and any blanks
+static const char * c_npyFindKey( const char * p, const char * last, const char * key ){
+	size_t n = strlen( key );
+
+	for (; p+n+3<=last; p++){
+		if ((*p=='\'' || *p=='"') && p[n+1]==*p && memcmp( p+1, key, n )==0){
+			for (p+=n+2; p<last && (*p==' ' || *p==':'); p++);
+			return p;
+		}
+	}
+	return 0;
+}
+
+//Decimal digits at *q, advancing past them; -1 if the value overflows
+static int c_npyParseUint( const char ** q, const char * last, uint64_t * v ){
+	*v = 0;
+	for (; *q<last && **q>='0' && **q<='9'; (*q)++){
+		if (__builtin_mul_overflow( *v, 10, v ) || __builtin_add_overflow( *v, (uint64_t) (**q-'0'), v ))
+			return -1;
+	}
+	return 0;
+}
+
+static int c_npyParseHeader( positNpy_t * t, const char * p, const char * last, bool * swap ){
+	const char * q;
+	char order;
+	uint64_t dim;
+
+	q = c_npyFindKey( p, last, "descr" );
+	if (!q || q+4>last || (*q!='\'' && *q!='"')) return -1;
+	order = q[1];
+	t->kind = q[2];
+	q += 3;
+	if (c_npyParseUint( &q, last, &dim ) || (dim!=1 && dim!=2 && dim!=4 && dim!=8)) return -1;
+	t->itemBytes = (uint8_t) dim;
+	*swap = t->itemBytes>1 && ((order=='<' && c_nativeBigEndian()) || (order=='>' && !c_nativeBigEndian()));
+
+	q = c_npyFindKey( p, last, "fortran_order" );
+	if (!q) return -1;
+	t->fortranOrder = q<last && *q=='T';
+
+	q = c_npyFindKey( p, last, "shape" );
+	if (!q || q==last || *q++!='(') return -1;
+	t->rank = 0;
+	t->count = 1;
+	for (;;){
+		while (q<last && (*q==' ' || *q==',')) q++;
+		if (q==last) return -1;
+		if (*q==')') break;
+		if (*q<'0' || *q>'9' || t->rank==SOFTPOSIT_TENSOR_MAXRANK) return -1;
+		if (c_npyParseUint( &q, last, &dim ) || __builtin_mul_overflow( t->count, dim, &t->count )) return -1;
+		t->shape[t->rank++] = dim;
+	}
+	return 0;
+}
+
+int positNpy_open( positNpy_t * t, const char * path ){
+	const uint8_t * h;
+	uint64_t headerLen, offset;
+	bool swap;
+
+	memset( t, 0, sizeof *t );
+	t->map = softposit_mapFile( path, &t->mapBytes );
+	if (!t->map) return -1;
+	h = t->map;
+	if (t->mapBytes<10 || memcmp( h, "\x93NUMPY", 6 ) || h[6]<1 || h[6]>3) goto invalid;
+	if (h[6]==1){
+		headerLen = h[8] | h[9]<<8;
+		offset = 10;
+	}
+	else{
+		if (t->mapBytes<12) goto invalid;
+		headerLen = h[8] | h[9]<<8 | (uint32_t) h[10]<<16 | (uint32_t) h[11]<<24;
+		offset = 12;
+	}
+	if (headerLen>t->mapBytes-offset
+			|| c_npyParseHeader( t, (const char *) h + offset, (const char *) h + offset + headerLen, &swap ))
+		goto invalid;
+	offset += headerLen;
+	if (t->count>(t->mapBytes-offset)/t->itemBytes) goto invalid;
+	t->data = h + offset;
+	if (swap) softposit_swapWords( (void *) t->data, t->count, t->itemBytes );
+	return 0;
+
+invalid:
+	positNpy_close( t );
+	errno = EINVAL;
+	return -1;
+}
+
+void positNpy_close( positNpy_t * t ){
+	if (t->map) munmap( t->map, t->mapBytes );
+	memset( t, 0, sizeof *t );
+}
+
+//Zero-copy views of integer payloads of the matching width, else NULL
+const posit8_t * positNpy_p8( const positNpy_t * t ){
+	return ((t->kind=='u' || t->kind=='i') && t->itemBytes==1) ? t->data : 0;
+}
+const posit16_t * positNpy_p16( const positNpy_t * t ){
+	return ((t->kind=='u' || t->kind=='i') && t->itemBytes==2) ? t->data : 0;
+}
+const posit32_t * positNpy_p32( const positNpy_t * t ){
+	return ((t->kind=='u' || t->kind=='i') && t->itemBytes==4) ? t->data : 0;
+}
+const posit64_t * positNpy_p64( const positNpy_t * t ){
+	return ((t->kind=='u' || t->kind=='i') && t->itemBytes==8) ? t->data : 0;
+}
+
+/*----------------------------------------------------------------------------
+| Floating-point payloads.  p16 from float32 goes through the vector kernel;
+| everything else is rounded once from the exact double through the shared
+| posit packer (float32 widens to double exactly), which keeps this file
+| clear of the per-width decimal conversion objects.
+*----------------------------------------------------------------------------*/
+static uint_fast64_t c_doubleToPositUI( uint64_t bits, int nbits, int es ){
+	int_fast32_t exp = (bits>>52) & 0x7FF;
+	uint_fast64_t sig = bits<<11, mag;
+	bool sign = bits>>63;
+
+	if (exp==0x7FF) return 1ULL<<(nbits-1);
+	if (exp==0){
+		if (!(bits<<1)) return 0;
+		exp = -1022 - __builtin_clzll( sig );
+		sig <<= __builtin_clzll( sig );
+	}
+	else{
+		exp -= 1023;
+		sig |= 0x8000000000000000ULL;
+	}
+	mag = softposit_roundPackMagPX( exp, sig, 0, nbits, es );
+	return sign ? -mag & (~0ULL>>(64-nbits)) : mag;
+}
+
+static int c_npyConvert( const positNpy_t * t, void * z, int nbits, int es ){
+	const uint8_t * p = t->data;
+	uint64_t i, bits;
+	double d;
+	float f;
+
+	if (t->kind!='f' || (t->itemBytes!=4 && t->itemBytes!=8)){
+		errno = EINVAL;
+		return -1;
+	}
+	for (i=0; i<t->count; i++){
+		if (t->itemBytes==4){
+			memcpy( &f, p + 4*i, 4 );
+			d = f;
+		}
+		else memcpy( &d, p + 8*i, 8 );
+		memcpy( &bits, &d, 8 );
+		bits = c_doubleToPositUI( bits, nbits, es );
+		switch (nbits){
+			case 8: ((uint8_t *) z)[i] = (uint8_t) bits; break;
+			case 16: ((uint16_t *) z)[i] = (uint16_t) bits; break;
+			case 32: ((uint32_t *) z)[i] = (uint32_t) bits; break;
+			default: ((uint64_t *) z)[i] = bits; break;
+		}
+	}
+	return 0;
+}
+
+int positNpy_toP8( const positNpy_t * t, posit8_t * z ){
+	return c_npyConvert( t, z, 8, 0 );
+}
+
+int positNpy_toP16( const positNpy_t * t, posit16_t * z ){
+	if (t->kind=='f' && t->itemBytes==4){
+		convertFloatToP16_n( t->data, t->count, z );
+		return 0;
+	}
+	return c_npyConvert( t, z, 16, 1 );
+}
+
+int positNpy_toP32( const positNpy_t * t, posit32_t * z ){
+	return c_npyConvert( t, z, 32, 2 );
+}
+
+int positNpy_toP64( const positNpy_t * t, posit64_t * z ){
+	return c_npyConvert( t, z, 64, 2 );
+}
+
+static char * c_npyPutString( char * p, const char * s ){
+	while (*s) *p++ = *s++;
+	return p;
+}
+
+static char * c_npyPutUint( char * p, uint64_t v ){
+	char digits[20];
+	int n = 0;
+
+	do{
+		digits[n++] = '0' + v%10;
+		v /= 10;
+	} while (v);
+	while (n) *p++ = digits[--n];
+	return p;
+}
+
+/*----------------------------------------------------------------------------
+| Writes count = product of shape words of itemBytes each as an unsigned
+| integer array in C order, in the native byte order, padding the header
+| so the payload is 64-byte aligned.
+*----------------------------------------------------------------------------*/
+int positNpy_write( const char * path, const void * data, int itemBytes, int rank, const uint64_t * shape ){
+	char h[12 + 64 + 21*SOFTPOSIT_TENSOR_MAXRANK + C_NPY_ALIGN], * p;
+	uint64_t count = 1, headerLen, total, done;
+	const uint8_t * src = data;
+	ssize_t n;
+	int fd, i, prefix;
+
+	if ((itemBytes!=1 && itemBytes!=2 && itemBytes!=4 && itemBytes!=8)
+			|| rank<0 || rank>SOFTPOSIT_TENSOR_MAXRANK){
+		errno = EINVAL;
+		return -1;
+	}
+	//Version 1 has a 16-bit header length, which this header always fits
+	prefix = 10;
+	p = h + prefix;
+	p = c_npyPutString( p, "{'descr': '" );
+	*p++ = (itemBytes==1) ? '|' : c_nativeBigEndian() ? '>' : '<';
+	*p++ = 'u';
+	*p++ = '0' + itemBytes;
+	p = c_npyPutString( p, "', 'fortran_order': False, 'shape': (" );
+	for (i=0; i<rank; i++){
+		if (i) p = c_npyPutString( p, ", " );
+		p = c_npyPutUint( p, shape[i] );
+		if (__builtin_mul_overflow( count, shape[i], &count )){
+			errno = EINVAL;
+			return -1;
+		}
+	}
+	if (__builtin_mul_overflow( count, (uint64_t) itemBytes, &total )){
+		errno = EINVAL;
+		return -1;
+	}
+	if (rank==1) *p++ = ',';
+	p = c_npyPutString( p, "), }" );
+	while ((p-h+1)%C_NPY_ALIGN) *p++ = ' ';
+	*p++ = '\n';
+	headerLen = p - h - prefix;
+	memcpy( h, "\x93NUMPY\x01\x00", 8 );
+	h[8] = (char) headerLen;
+	h[9] = (char) (headerLen>>8);
+
+	fd = open( path, O_WRONLY|O_CREAT|O_TRUNC, 0644 );
+	if (fd<0) return -1;
+	total = p - h;
+	for (done=0; done<total; done+=n){
+		n = write( fd, h + done, total - done );
+		if (n<0 && errno!=EINTR) goto fail;
+		if (n<0) n = 0;
+	}
+	total = count*itemBytes;
+	for (done=0; done<total; done+=n){
+		n = write( fd, src + done, total - done );
+		if (n<0 && errno!=EINTR) goto fail;
+		if (n<0) n = 0;
+	}
+	return close( fd ) ? -1 : 0;
+
+fail:
+	close( fd );
+	return -1;
+}
@@ -0,0 +1,368 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Each part of a scan fills its own profile and the parts are merged at the
+| end, so the histograms need no atomics.  posit8/posit16 data is first
+| counted by bit pattern and each pattern decoded once; wider data is
+| decoded eight lanes at a time and binned per element.
+*----------------------------------------------------------------------------*/
+#define C_PROFILE_MINPART 65536
+
+enum { c_profileKindPattern, c_profileKindP32, c_profileKindP64, c_profileKindFloat, c_profileKindDouble };
+
+typedef struct {
+	const void * a;
+	size_t n;
+	int kind, nbits, es;
+	positProfile_t * parts;
+} c_profileTask;
+
+static inline int c_regimeBits( int_fast32_t scale, int nbits, int es ){
+	int_fast32_t kA = scale>>es;
+	int regA = (kA>=0) ? kA+2 : 1-kA;
+
+	return (regA>nbits-1) ? nbits-1 : regA;
+}
+
+static inline void c_profileAdd( positProfile_t * prof, int_fast32_t scale, int fracBits, uint64_t w ){
+	int i = scale + SOFTPOSIT_PROFILE_SCALEBIAS;
+
+	prof->scale[i] += w;
+	if (fracBits>prof->scaleFracBits[i]) prof->scaleFracBits[i] = fracBits;
+	prof->fracBits[fracBits] += w;
+}
+
+//A posit left-aligned in 32 bits
+static inline void c_profilePX( positProfile_t * prof, uint_fast32_t uiA, int nbits, int es, uint64_t w ){
+	uint_fast64_t sig;
+	int_fast32_t scale;
+	bool sign;
+
+	if (uiA==0) prof->zeros += w;
+	else if (uiA==0x80000000) prof->nars += w;
+	else{
+		scale = softposit_unpackPX( uiA, es, &sign, &sig );
+		c_profileAdd( prof, scale, 63-__builtin_ctzll( sig ), w );
+		prof->regime[c_regimeBits( scale, nbits, es )] += w;
+	}
+}
+
+static inline void c_profileP64( positProfile_t * prof, uint_fast64_t uiA ){
+	uint_fast64_t sig;
+	int_fast32_t scale;
+	bool sign;
+
+	if (uiA==0) prof->zeros++;
+	else if (uiA==0x8000000000000000ULL) prof->nars++;
+	else{
+		scale = softposit_unpackP64( uiA, &sign, &sig );
+		c_profileAdd( prof, scale, 63-__builtin_ctzll( sig ), 1 );
+		prof->regime[c_regimeBits( scale, 64, 2 )]++;
+	}
+}
+
+//Binary floats with mantissa width m and exponent bias; NaN and infinities count as NaR
+static inline void c_profileBinary( positProfile_t * prof, uint_fast64_t uiA, int m, int expMax, int bias ){
+	uint_fast64_t mant = uiA & ((1ULL<<m)-1);
+	int expA = (int) (uiA>>m) & expMax, top;
+
+	if (expA==expMax) prof->nars++;
+	else if (expA==0 && mant==0) prof->zeros++;
+	else if (expA==0){
+		top = 63-__builtin_clzll( mant );
+		c_profileAdd( prof, top+1-bias-m, top-__builtin_ctzll( mant ), 1 );
+	}
+	else c_profileAdd( prof, expA-bias, mant ? m-__builtin_ctzll( mant ) : 0, 1 );
+}
+
+#ifdef __AVX2__
+//Bins eight decoded lanes selected by mask; regime is 0 for float data
+static inline void c_profileLanes( positProfile_t * prof, __m256i scale, __m256i fracBits,
+	__m256i regime, int mask, bool posit ){
+
+	int32_t s[8], f[8], r[8];
+	int i;
+
+	_mm256_storeu_si256( (__m256i *) s, scale );
+	_mm256_storeu_si256( (__m256i *) f, fracBits );
+	_mm256_storeu_si256( (__m256i *) r, regime );
+	for (; mask; mask&=mask-1){
+		i = __builtin_ctz( mask );
+		c_profileAdd( prof, s[i], f[i], 1 );
+		if (posit) prof->regime[r[i]]++;
+	}
+}
+
+//Bits up to the last one of a left-aligned fraction: clz of its lowest set bit, plus one
+static inline __m256i c_fracBitsx8( __m256i frac ){
+	__m256i zero = _mm256_setzero_si256();
+	__m256i low = _mm256_and_si256( frac, _mm256_sub_epi32( zero, frac ) );
+
+	return _mm256_andnot_si256( _mm256_cmpeq_epi32( frac, zero ),
+			_mm256_add_epi32( softposit_clzx8( low ), _mm256_set1_epi32( 1 ) ) );
+}
+
+static size_t c_profileP32x8( positProfile_t * prof, const uint32_t * a, size_t n, int nbits, int es ){
+	__m256i zero = _mm256_setzero_si256(), nar = _mm256_set1_epi32( 0x80000000 );
+	__m256i uA, sign, frac, scale, kA, regime;
+	int zeros, nars;
+	size_t i;
+
+	for (i=0; i+8<=n; i+=8){
+		uA = _mm256_loadu_si256( (const __m256i *) (a+i) );
+		zeros = _mm256_movemask_ps( _mm256_castsi256_ps( _mm256_cmpeq_epi32( uA, zero ) ) );
+		nars = _mm256_movemask_ps( _mm256_castsi256_ps( _mm256_cmpeq_epi32( uA, nar ) ) );
+		prof->zeros += __builtin_popcount( zeros );
+		prof->nars += __builtin_popcount( nars );
+		scale = softposit_decodePXx8( uA, es, &sign, &frac );
+		kA = _mm256_srav_epi32( scale, _mm256_set1_epi32( es ) );
+		regime = _mm256_blendv_epi8( _mm256_add_epi32( kA, _mm256_set1_epi32( 2 ) ),
+				_mm256_sub_epi32( _mm256_set1_epi32( 1 ), kA ), _mm256_cmpgt_epi32( zero, kA ) );
+		regime = _mm256_min_epi32( regime, _mm256_set1_epi32( nbits-1 ) );
+		c_profileLanes( prof, scale, c_fracBitsx8( frac ), regime, 0xFF & ~(zeros | nars), true );
+	}
+	return i;
+}
+
+//Subnormal lanes go through the scalar path
+static size_t c_profileFloatx8( positProfile_t * prof, const uint32_t * a, size_t n ){
+	__m256i zero = _mm256_setzero_si256();
+	__m256i uA, expA, mant, fracBits;
+	int special, zeros, sub, i;
+	size_t j;
+
+	for (j=0; j+8<=n; j+=8){
+		uA = _mm256_loadu_si256( (const __m256i *) (a+j) );
+		expA = _mm256_and_si256( _mm256_srli_epi32( uA, 23 ), _mm256_set1_epi32( 0xFF ) );
+		mant = _mm256_and_si256( uA, _mm256_set1_epi32( 0x7FFFFF ) );
+		special = _mm256_movemask_ps( _mm256_castsi256_ps( _mm256_cmpeq_epi32( expA, _mm256_set1_epi32( 0xFF ) ) ) );
+		zeros = _mm256_movemask_ps( _mm256_castsi256_ps( _mm256_cmpeq_epi32( _mm256_or_si256( expA, mant ), zero ) ) );
+		sub = _mm256_movemask_ps( _mm256_castsi256_ps( _mm256_cmpeq_epi32( expA, zero ) ) ) & ~zeros;
+		prof->nars += __builtin_popcount( special );
+		prof->zeros += __builtin_popcount( zeros );
+		for (i=sub; i; i&=i-1) c_profileBinary( prof, a[j+__builtin_ctz( i )], 23, 0xFF, 127 );
+		fracBits = c_fracBitsx8( _mm256_slli_epi32( mant, 9 ) );
+		c_profileLanes( prof, _mm256_sub_epi32( expA, _mm256_set1_epi32( 127 ) ), fracBits,
+				zero, 0xFF & ~(special | zeros | sub), false );
+	}
+	return j;
+}
+#endif
+
+static void c_profilePart( void * arg, int part, int nParts ){
+	c_profileTask * t = arg;
+	positProfile_t * prof = &t->parts[part];
+	size_t i = t->n*part/nParts, i1 = t->n*(part+1)/nParts;
+	uint64_t * counts;
+
+	prof->count += i1-i;
+	switch (t->kind){
+	case c_profileKindPattern:{
+		const uint8_t * a8 = t->a;
+		const uint16_t * a16 = t->a;
+		size_t nPatterns = (size_t) 1<<t->nbits, j;
+
+		counts = calloc( nPatterns, sizeof(uint64_t) );
+		if (!counts){
+			for (; i<i1; i++) c_profilePX( prof,
+					(t->nbits==8) ? (uint_fast32_t) a8[i]<<24 : (uint_fast32_t) a16[i]<<16, t->nbits, t->es, 1 );
+			break;
+		}
+		if (t->nbits==8) for (; i<i1; i++) counts[a8[i]]++;
+		else for (; i<i1; i++) counts[a16[i]]++;
+		for (j=0; j<nPatterns; j++)
+			if (counts[j]) c_profilePX( prof, (uint_fast32_t) j<<(32-t->nbits), t->nbits, t->es, counts[j] );
+		free( counts );
+		break;
+	}
+	case c_profileKindP32:{
+		const uint32_t * a = t->a;
+#ifdef __AVX2__
+		i += c_profileP32x8( prof, a+i, i1-i, t->nbits, t->es );
+#endif
+		for (; i<i1; i++) c_profilePX( prof, a[i], t->nbits, t->es, 1 );
+		break;
+	}
+	case c_profileKindP64:{
+		const uint64_t * a = t->a;
+		for (; i<i1; i++) c_profileP64( prof, a[i] );
+		break;
+	}
+	case c_profileKindFloat:{
+		const uint32_t * a = t->a;
+#ifdef __AVX2__
+		i += c_profileFloatx8( prof, a+i, i1-i );
+#endif
+		for (; i<i1; i++) c_profileBinary( prof, a[i], 23, 0xFF, 127 );
+		break;
+	}
+	default:{
+		const uint64_t * a = t->a;
+		for (; i<i1; i++) c_profileBinary( prof, a[i], 52, 0x7FF, 1023 );
+	}
+	}
+}
+
+static void c_profileRun( const void * a, size_t n, positProfile_t * prof, int kind, int nbits, int es, int nThreads ){
+	c_profileTask t = { a, n, kind, nbits, es, 0 };
+	int nParts = softposit_threadCount( nThreads ), i;
+
+	if ((size_t) nParts > n/C_PROFILE_MINPART) nParts = (n/C_PROFILE_MINPART) ? (int) (n/C_PROFILE_MINPART) : 1;
+	if (nParts>1) t.parts = calloc( nParts, sizeof(positProfile_t) );
+	if (!t.parts){
+		t.parts = prof;
+		c_profilePart( &t, 0, 1 );
+		return;
+	}
+	softposit_parallelRun( nParts, c_profilePart, &t );
+	for (i=0; i<nParts; i++) positProfile_merge( prof, &t.parts[i] );
+	free( t.parts );
+}
+
+void positProfile_init( positProfile_t * prof ){
+	memset( prof, 0, sizeof(positProfile_t) );
+}
+
+void positProfile_merge( positProfile_t * prof, const positProfile_t * a ){
+	int i;
+
+	prof->count += a->count;
+	prof->zeros += a->zeros;
+	prof->nars += a->nars;
+	for (i=0; i<65; i++){
+		prof->regime[i] += a->regime[i];
+		prof->fracBits[i] += a->fracBits[i];
+	}
+	for (i=0; i<SOFTPOSIT_PROFILE_NSCALES; i++){
+		prof->scale[i] += a->scale[i];
+		if (a->scaleFracBits[i]>prof->scaleFracBits[i]) prof->scaleFracBits[i] = a->scaleFracBits[i];
+	}
+}
+
+void positProfile_p8_n( const posit8_t * a, size_t n, positProfile_t * prof, int nThreads ){
+	c_profileRun( a, n, prof, c_profileKindPattern, 8, 0, nThreads );
+}
+
+void positProfile_p16_n( const posit16_t * a, size_t n, positProfile_t * prof, int nThreads ){
+	c_profileRun( a, n, prof, c_profileKindPattern, 16, 1, nThreads );
+}
+
+void positProfile_p32_n( const posit32_t * a, size_t n, positProfile_t * prof, int nThreads ){
+	c_profileRun( a, n, prof, c_profileKindP32, 32, 2, nThreads );
+}
+
+void positProfile_p64_n( const posit64_t * a, size_t n, positProfile_t * prof, int nThreads ){
+	c_profileRun( a, n, prof, c_profileKindP64, 64, 2, nThreads );
+}
+
+void positProfile_pX0_n( const posit_0_t * a, size_t n, positProfile_t * prof, int nThreads, int x ){
+	c_profileRun( a, n, prof, c_profileKindP32, x, 0, nThreads );
+}
+
+void positProfile_pX1_n( const posit_1_t * a, size_t n, positProfile_t * prof, int nThreads, int x ){
+	c_profileRun( a, n, prof, c_profileKindP32, x, 1, nThreads );
+}
+
+void positProfile_pX2_n( const posit_2_t * a, size_t n, positProfile_t * prof, int nThreads, int x ){
+	c_profileRun( a, n, prof, c_profileKindP32, x, 2, nThreads );
+}
+
+void positProfile_float_n( const float * a, size_t n, positProfile_t * prof, int nThreads ){
+	c_profileRun( a, n, prof, c_profileKindFloat, 0, 0, nThreads );
+}
+
+void positProfile_double_n( const double * a, size_t n, positProfile_t * prof, int nThreads ){
+	c_profileRun( a, n, prof, c_profileKindDouble, 0, 0, nThreads );
+}
+
+/*----------------------------------------------------------------------------
+| Worst relative error of rounding a value of the given scale with fracBits
+| significant fraction bits to nbits and es: zero if it fits, half an ulp
+| if only fraction bits are lost, and 1 when it saturates or loses exponent
+| bits.
+*----------------------------------------------------------------------------*/
+static double c_profileError( int_fast32_t scale, int fracBits, int nbits, int es ){
+	int_fast32_t kA = scale>>es, maxScale = (int_fast32_t) (nbits-2)<<es;
+	int regA = (kA>=0) ? kA+2 : 1-kA, rest, expBits, frac;
+
+	if (regA>nbits-1) return (fracBits==0 && scale==maxScale) ? 0 : 1;
+	rest = nbits-1-regA;
+	expBits = (rest<es) ? rest : es;
+	frac = rest-expBits;
+	if (expBits<es) return (fracBits==0 && !(scale & ((1<<(es-expBits))-1))) ? 0 : 1;
+	return (fracBits<=frac) ? 0 : ldexp( 1, -(frac+1) );
+}
+
+static uint64_t c_profileCovered( const positProfile_t * prof, int nbits, int es, double maxRelErr ){
+	uint64_t covered = 0;
+	int i;
+
+	for (i=0; i<SOFTPOSIT_PROFILE_NSCALES; i++)
+		if (prof->scale[i] && c_profileError( i-SOFTPOSIT_PROFILE_SCALEBIAS, prof->scaleFracBits[i], nbits, es )<=maxRelErr)
+			covered += prof->scale[i];
+	return covered;
+}
+
+int positProfile_recommend( const positProfile_t * prof, double maxRelErr, double coverage, int * nbits, int * es ){
+	uint64_t nonzero = prof->count - prof->zeros - prof->nars;
+	int n, e;
+
+	for (n=2; n<=32; n++)
+		for (e=0; e<=2; e++)
+			if (c_profileCovered( prof, n, e, maxRelErr )>=coverage*nonzero){
+				*nbits = n;
+				*es = e;
+				return 0;
+			}
+	if (c_profileCovered( prof, 64, 2, maxRelErr )>=coverage*nonzero){
+		*nbits = 64;
+		*es = 2;
+		return 0;
+	}
+	return -1;
+}
@@ -0,0 +1,398 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Posit tensor file, version 1.  All header fields are little-endian; the
+| payload is in the byte order recorded in the header.
+|
+|   offset  size  field
+|        0     8  magic "SPTENSOR"
+|        8     2  version (1)
+|       10     1  nbits: 8, 16, 32 or 64, or 2..32 for the dynamic formats
+|       11     1  es
+|       12     1  bytes per stored word: 1 for p8, 2 for p16, 8 for 64 bits,
+|                 otherwise 4 (dynamic formats are left-aligned in 32 bits)
+|       13     1  payload byte order: 0 little-endian, 1 big-endian
+|       14     1  rank, at most SOFTPOSIT_TENSOR_MAXRANK
+|       15     1  reserved, 0
+|       16    64  shape[8], unused dimensions 0
+|       80    64  strides[8] in words, unused dimensions 0
+|      144     8  payload offset (a multiple of 64)
+|      152     8  payload words
+|      160     8  quire block offset (a multiple of 64, 0 if none)
+|      168     8  quire block count
+|      176     8  bytes per quire block: 4 (q8), 16 (q16) or 64 (q32, qX)
+|      184    72  reserved, 0
+|      256        payload, then the quire blocks
+|
+| The payload holds exactly the words addressed by the strides, which are
+| non-negative; the default is C order, fully packed.  Quires are stored as
+| their 32- or 64-bit words in the payload byte order, in their in-memory
+| word order.  The writer streams the payload with plain writes and fills in
+| the header on close; the reader maps the file, so views are zero-copy
+| unless the byte order differs, in which case the mapping is private and
+| swapped in place once.
+*----------------------------------------------------------------------------*/
+#define C_TENSOR_HEADER 256
+#define C_TENSOR_ALIGN 64
+
+static void c_put16( uint8_t * p, uint_fast16_t v ){
+	p[0] = (uint8_t) v;
+	p[1] = (uint8_t) (v>>8);
+}
+
+static void c_put64( uint8_t * p, uint64_t v ){
+	int i;
+
+	for (i=0; i<8; i++) p[i] = (uint8_t) (v>>(8*i));
+}
+
+static uint64_t c_get64( const uint8_t * p ){
+	uint64_t v = 0;
+	int i;
+
+	for (i=7; i>=0; i--) v = (v<<8) | p[i];
+	return v;
+}
+
+//Only the fixed formats are stored at their own width; pX words keep their
+//32-bit left-aligned layout whatever x is
+static int c_wordBytes( int nbits, int es ){
+	if (nbits==8 && es==0) return 1;
+	if (nbits==16 && es==1) return 2;
+	return (nbits==64) ? 8 : 4;
+}
+
+static uint64_t c_alignUp( uint64_t n ){
+	return (n + C_TENSOR_ALIGN-1) & ~(uint64_t) (C_TENSOR_ALIGN-1);
+}
+
+static bool c_nativeBigEndian( void ){
+	const uint16_t probe = 1;
+	return *(const uint8_t *) &probe==0;
+}
+
+//Words addressed by shape and strides (0 for an empty tensor); -1 if a
+//stride is negative or the span does not fit in 64 bits
+static int c_tensorSpan( int rank, const uint64_t * shape, const int64_t * strides, uint64_t * span ){
+	uint64_t extent;
+	int i;
+
+	*span = 1;
+	for (i=0; i<rank; i++) if (strides[i]<0) return -1;
+	for (i=0; i<rank; i++){
+		if (shape[i]==0){
+			*span = 0;
+			return 0;
+		}
+	}
+	for (i=0; i<rank; i++){
+		if (__builtin_mul_overflow( shape[i]-1, (uint64_t) strides[i], &extent )
+				|| __builtin_add_overflow( *span, extent, span )) return -1;
+	}
+	return 0;
+}
+
+void softposit_swapWords( void * p, uint64_t words, int bytes ){
+	uint64_t i;
+
+	switch (bytes){
+		case 2:
+			for (i=0; i<words; i++) ((uint16_t *) p)[i] = __builtin_bswap16( ((uint16_t *) p)[i] );
+			break;
+		case 4:
+			for (i=0; i<words; i++) ((uint32_t *) p)[i] = __builtin_bswap32( ((uint32_t *) p)[i] );
+			break;
+		case 8:
+			for (i=0; i<words; i++) ((uint64_t *) p)[i] = __builtin_bswap64( ((uint64_t *) p)[i] );
+			break;
+	}
+}
+
+//Private and writable so a foreign byte order can be fixed up in place
+void * softposit_mapFile( const char * path, size_t * bytes ){
+	struct stat st;
+	void * map;
+	int fd;
+
+	fd = open( path, O_RDONLY );
+	if (fd<0) return 0;
+	if (fstat( fd, &st ) || st.st_size==0){
+		close( fd );
+		errno = EINVAL;
+		return 0;
+	}
+	map = mmap( 0, st.st_size, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0 );
+	close( fd );
+	if (map==MAP_FAILED) return 0;
+	*bytes = st.st_size;
+	return map;
+}
+
+static int c_writeAll( int fd, const void * buf, size_t n ){
+	const uint8_t * p = buf;
+	ssize_t done;
+
+	while (n){
+		done = write( fd, p, n );
+		if (done<0){
+			if (errno==EINTR) continue;
+			return -1;
+		}
+		p += done;
+		n -= done;
+	}
+	return 0;
+}
+
+static int c_writeZeros( int fd, size_t n ){
+	static const uint8_t zeros[C_TENSOR_ALIGN];
+	size_t chunk;
+
+	for (; n; n-=chunk){
+		chunk = (n<sizeof zeros) ? n : sizeof zeros;
+		if (c_writeAll( fd, zeros, chunk )) return -1;
+	}
+	return 0;
+}
+
+int positTensor_open( positTensor_t * t, const char * path ){
+	const uint8_t * h;
+	uint64_t offset, quireOffset, quireBytes, words, span;
+	void * map;
+	int i;
+
+	memset( t, 0, sizeof *t );
+	map = softposit_mapFile( path, &t->mapBytes );
+	if (!map) return -1;
+	t->map = map;
+	if (t->mapBytes<C_TENSOR_HEADER) goto invalid;
+
+	h = map;
+	if (memcmp( h, "SPTENSOR", 8 ) || (h[8] | h[9]<<8)!=1) goto invalid;
+	t->nbits = h[10];
+	t->es = h[11];
+	t->wordBytes = h[12];
+	t->bigEndian = h[13];
+	t->rank = h[14];
+	if (t->nbits<2 || t->nbits>64 || (t->nbits>32 && t->nbits!=64) || t->es>4
+			|| t->wordBytes!=c_wordBytes( t->nbits, t->es ) || t->bigEndian>1
+			|| t->rank>SOFTPOSIT_TENSOR_MAXRANK) goto invalid;
+	for (i=0; i<t->rank; i++){
+		t->shape[i] = c_get64( h + 16 + 8*i );
+		t->strides[i] = (int64_t) c_get64( h + 80 + 8*i );
+	}
+	offset = c_get64( h + 144 );
+	words = c_get64( h + 152 );
+	quireOffset = c_get64( h + 160 );
+	t->quireCount = c_get64( h + 168 );
+	quireBytes = c_get64( h + 176 );
+	if (c_tensorSpan( t->rank, t->shape, t->strides, &span ) || words!=span || offset%C_TENSOR_ALIGN
+			|| offset<C_TENSOR_HEADER || offset>t->mapBytes || words>(t->mapBytes-offset)/t->wordBytes) goto invalid;
+	if (t->quireCount){
+		if ((quireBytes!=4 && quireBytes!=16 && quireBytes!=64) || quireOffset%C_TENSOR_ALIGN
+				|| quireOffset<offset + words*t->wordBytes || quireOffset>t->mapBytes
+				|| t->quireCount>(t->mapBytes-quireOffset)/quireBytes) goto invalid;
+		t->quireBytes = (uint32_t) quireBytes;
+		t->quires = (uint8_t *) map + quireOffset;
+	}
+	t->count = words;
+	t->data = (uint8_t *) map + offset;
+
+	if (t->bigEndian!=c_nativeBigEndian()){
+		softposit_swapWords( (uint8_t *) t->data, words, t->wordBytes );
+		if (t->quireCount) softposit_swapWords( (uint8_t *) t->quires, t->quireCount*quireBytes/((quireBytes==4) ? 4 : 8),
+				(quireBytes==4) ? 4 : 8 );
+		t->bigEndian = !t->bigEndian;
+	}
+	return 0;
+
+invalid:
+	positTensor_close( t );
+	errno = EINVAL;
+	return -1;
+}
+
+void positTensor_close( positTensor_t * t ){
+	if (t->map) munmap( t->map, t->mapBytes );
+	memset( t, 0, sizeof *t );
+}
+
+//Typed views; NULL unless the file holds that exact format
+const posit8_t * positTensor_p8( const positTensor_t * t ){
+	return (t->nbits==8 && t->es==0) ? t->data : 0;
+}
+const posit16_t * positTensor_p16( const positTensor_t * t ){
+	return (t->nbits==16 && t->es==1) ? t->data : 0;
+}
+const posit32_t * positTensor_p32( const positTensor_t * t ){
+	return (t->nbits==32 && t->es==2) ? t->data : 0;
+}
+const posit64_t * positTensor_p64( const positTensor_t * t ){
+	return (t->nbits==64 && t->es==2) ? t->data : 0;
+}
+const posit_2_t * positTensor_pX2( const positTensor_t * t, int x ){
+	return (t->nbits==x && t->es==2 && t->wordBytes==4) ? t->data : 0;
+}
+const quire8_t * positTensor_q8( const positTensor_t * t ){
+	return (t->quireBytes==4) ? t->quires : 0;
+}
+const quire16_t * positTensor_q16( const positTensor_t * t ){
+	return (t->quireBytes==16) ? t->quires : 0;
+}
+const quire32_t * positTensor_q32( const positTensor_t * t ){
+	return (t->quireBytes==64) ? t->quires : 0;
+}
+
+/*----------------------------------------------------------------------------
+| Writer.  strides may be NULL for C order; quireBytes is 0 when no quire
+| blocks follow.  Words and quires go straight to the file as they arrive;
+| close checks the counts and writes the final header.
+*----------------------------------------------------------------------------*/
+int positTensorWriter_open( positTensorWriter_t * w, const char * path, int nbits, int es,
+		int rank, const uint64_t * shape, const int64_t * strides, uint32_t quireBytes ){
+
+	uint64_t packed = 1;
+	int i;
+
+	memset( w, 0, sizeof *w );
+	w->fd = -1;
+	if (nbits<2 || nbits>64 || (nbits>32 && nbits!=64) || es<0 || es>4 || rank<0
+			|| rank>SOFTPOSIT_TENSOR_MAXRANK || (quireBytes && quireBytes!=4 && quireBytes!=16 && quireBytes!=64)){
+		errno = EINVAL;
+		return -1;
+	}
+	w->nbits = nbits;
+	w->es = es;
+	w->rank = rank;
+	w->wordBytes = c_wordBytes( nbits, es );
+	w->quireBytes = quireBytes;
+	for (i=rank-1; i>=0; i--){
+		w->shape[i] = shape[i];
+		w->strides[i] = strides ? strides[i] : (int64_t) packed;
+		//A packed stride past INT64_MAX reads as negative and is rejected below
+		if (__builtin_mul_overflow( packed, shape[i], &packed )) packed = UINT64_MAX;
+	}
+	if (c_tensorSpan( rank, w->shape, w->strides, &w->words )
+			|| w->words>(UINT64_MAX - C_TENSOR_HEADER - C_TENSOR_ALIGN)/w->wordBytes){
+		errno = EINVAL;
+		return -1;
+	}
+
+	w->fd = open( path, O_WRONLY|O_CREAT|O_TRUNC, 0644 );
+	if (w->fd<0) return -1;
+	if (c_writeZeros( w->fd, C_TENSOR_HEADER )){
+		positTensorWriter_abort( w );
+		return -1;
+	}
+	return 0;
+}
+
+int positTensorWriter_write( positTensorWriter_t * w, const void * words, size_t n ){
+	if (w->fd<0 || n>w->words-w->written){
+		errno = EINVAL;
+		return -1;
+	}
+	if (c_writeAll( w->fd, words, n*w->wordBytes )) return -1;
+	w->written += n;
+	return 0;
+}
+
+int positTensorWriter_writeQuires( positTensorWriter_t * w, const void * quires, size_t n ){
+	uint64_t end = C_TENSOR_HEADER + w->words*w->wordBytes;
+
+	if (w->fd<0 || !w->quireBytes || w->written!=w->words){
+		errno = EINVAL;
+		return -1;
+	}
+	if (n==0) return 0;
+	if (!w->quiresWritten && c_writeZeros( w->fd, c_alignUp( end ) - end )) return -1;
+	if (c_writeAll( w->fd, quires, n*w->quireBytes )) return -1;
+	w->quiresWritten += n;
+	return 0;
+}
+
+int positTensorWriter_close( positTensorWriter_t * w ){
+	uint8_t h[C_TENSOR_HEADER] = { 'S', 'P', 'T', 'E', 'N', 'S', 'O', 'R' };
+	uint64_t end = C_TENSOR_HEADER + w->words*w->wordBytes;
+	int i, rc;
+
+	if (w->fd<0 || w->written!=w->words){
+		positTensorWriter_abort( w );
+		errno = EINVAL;
+		return -1;
+	}
+	c_put16( h + 8, 1 );
+	h[10] = w->nbits;
+	h[11] = w->es;
+	h[12] = w->wordBytes;
+	h[13] = c_nativeBigEndian();
+	h[14] = w->rank;
+	for (i=0; i<w->rank; i++){
+		c_put64( h + 16 + 8*i, w->shape[i] );
+		c_put64( h + 80 + 8*i, (uint64_t) w->strides[i] );
+	}
+	c_put64( h + 144, C_TENSOR_HEADER );
+	c_put64( h + 152, w->words );
+	if (w->quiresWritten){
+		c_put64( h + 160, c_alignUp( end ) );
+		c_put64( h + 168, w->quiresWritten );
+		c_put64( h + 176, w->quireBytes );
+	}
+	rc = pwrite( w->fd, h, sizeof h, 0 )==(ssize_t) sizeof h ? 0 : -1;
+	if (close( w->fd )) rc = -1;
+	w->fd = -1;
+	return rc;
+}
+
+void positTensorWriter_abort( positTensorWriter_t * w ){
+	if (w->fd>=0) close( w->fd );
+	w->fd = -1;
+}
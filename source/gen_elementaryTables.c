@@ -0,0 +1,165 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Build-time generator for the posit8 and posit16 function tables.  Every
+| entry is evaluated in long double, which carries at least 48 bits beyond a
+| posit16 significand, and rounded once to the target format.  Each result is
+| also rounded after being nudged by 2^-60 either way; if those roundings
+| disagree the reference is too close to a tie to be trusted and generation
+| fails rather than emitting a table that might not be correctly rounded.
+| Values that overflow or underflow long double are replaced by the largest
+| or smallest long double of the right sign, which posits saturate to maxpos
+| or minpos as they would the true value.  Domain errors give NaN and so NaR.
+*----------------------------------------------------------------------------*/
+#define GEN_SQRT1_2 0.707106781186547524400844362104849039L
+
+static long double gen_exp( long double x ){
+	if (x > 11000) return LDBL_MAX;
+	if (x < -11000) return LDBL_TRUE_MIN;
+	return expl(x);
+}
+static long double gen_log( long double x ){
+	return x>0 ? logl(x) : NAN;
+}
+static long double gen_sigmoid( long double x ){
+	if (x < -11000) return LDBL_TRUE_MIN;
+	return 1 / (1 + expl(-x));
+}
+static long double gen_tanh( long double x ){
+	return tanhl(x);
+}
+static long double gen_gelu( long double x ){
+	//x*Phi(x) with Phi through erfc so the negative tail keeps its precision
+	long double r = x * 0.5L * erfcl(-x*GEN_SQRT1_2);
+	return (r==0 && x!=0) ? -LDBL_TRUE_MIN : r;
+}
+static long double gen_reciprocal( long double x ){
+	return x!=0 ? 1/x : NAN;
+}
+static long double gen_rsqrt( long double x ){
+	return x>0 ? 1/sqrtl(x) : NAN;
+}
+static long double gen_sin( long double x ){
+	return sinl(x);
+}
+static long double gen_cos( long double x ){
+	return cosl(x);
+}
+
+static const struct {
+	const char * name;
+	long double (*f)( long double );
+} gen_functions[] = {
+	{ "exp", gen_exp }, { "log", gen_log }, { "sigmoid", gen_sigmoid },
+	{ "tanh", gen_tanh }, { "gelu", gen_gelu }, { "reciprocal", gen_reciprocal },
+	{ "rsqrt", gen_rsqrt }, { "sin", gen_sin }, { "cos", gen_cos }
+};
+
+static long double gen_decode( uint_fast32_t uiA, int nbits, int es ){
+	bool signA = uiA>>(nbits-1);
+	uint_fast64_t sig;
+	int_fast32_t scale;
+
+	if (uiA==0) return 0;
+	if (signA) uiA = (-uiA) & ((1ULL<<nbits)-1);
+	scale = softposit_decodeMagPX( (uint_fast64_t) uiA<<(64-nbits), es, &sig );
+	return (signA ? -1 : 1) * ldexpl( (long double) sig, scale-63 );
+}
+
+static uint_fast32_t gen_round( long double x, int nbits, int es ){
+	uint_fast64_t mag;
+	int e;
+
+	if (isnan(x)) return 1ULL<<(nbits-1);
+	if (x==0) return 0;
+	if (isinf(x)) x = copysignl(LDBL_MAX, x);
+	x = frexpl(x, &e);
+	mag = softposit_roundPackMagPX( e-1, (uint_fast64_t) ldexpl(fabsl(x), 64), false, nbits, es );
+	return x<0 ? (-mag) & ((1ULL<<nbits)-1) : mag;
+}
+
+static void gen_table( const char * name, int nbits, int es, long double (*f)( long double ) ){
+	uint_fast32_t n = 1UL<<nbits, uiA, uiZ;
+	int width = nbits/4;
+	long double x, y;
+
+	printf( "\nconst uint%d_t softposit_%sP%d[%lu] = {", nbits, name, nbits, (unsigned long) n );
+	for (uiA=0; uiA<n; uiA++){
+		if (uiA==(n>>1)){
+			uiZ = uiA;
+		}
+		else{
+			x = gen_decode( uiA, nbits, es );
+			y = f(x);
+			uiZ = gen_round( y, nbits, es );
+			if (isfinite(y) && y!=0
+					&& ( gen_round( y * (1 - 0x1p-60L), nbits, es )!=uiZ
+					|| gen_round( y * (1 + 0x1p-60L), nbits, es )!=uiZ )){
+				fprintf( stderr, "%s p%d 0x%0*lX: reference too close to a tie\n",
+						name, nbits, width, (unsigned long) uiA );
+				exit(EXIT_FAILURE);
+			}
+		}
+		printf( "%s0x%0*lX%s", (uiA%8) ? " " : "\n\t", width, (unsigned long) uiZ,
+				(uiA+1<n) ? "," : "\n" );
+	}
+	printf( "};\n" );
+}
+
+int main( void ){
+	size_t i;
+
+	printf( "/* Generated by gen_elementaryTables; do not edit. */\n\n" );
+	printf( "#include <stdint.h>\n#include \"platform.h\"\n#include \"primitives.h\"\n" );
+	for (i=0; i<sizeof(gen_functions)/sizeof(gen_functions[0]); i++){
+		gen_table( gen_functions[i].name, 8, 0, gen_functions[i].f );
+		gen_table( gen_functions[i].name, 16, 1, gen_functions[i].f );
+	}
+	return 0;
+}
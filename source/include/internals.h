@@ -52,6 +52,10 @@ extern "C"{
 
 #include <stdio.h>
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 #ifdef SOFTPOSIT_QUAD
 #include <quadmath.h>
 #endif
@@ -123,6 +127,305 @@ posit_1_t softposit_mulAddPX1( uint_fast32_t, uint_fast32_t, uint_fast32_t, uint
 posit64_t softposit_addMagsP64( uint_fast64_t, uint_fast64_t );
 posit64_t softposit_subMagsP64( uint_fast64_t, uint_fast64_t );
 posit64_t softposit_mulAddP64( uint_fast64_t, uint_fast64_t, uint_fast64_t, uint_fast64_t );
+posit64_t softposit_roundQ64ToP64( quire64_t, int stat );
+
+/*----------------------------------------------------------------------------
+| Instrumentation and exactness hooks.  With SOFTPOSIT_STATS each thread
+| counts into its own softposit_stats_t, registered on first use; with
+| SOFTPOSIT_EXACT rounded and saturated results raise the thread's inexact
+| flag.  Otherwise the hooks compile to nothing.  SOFTPOSIT_ROUNDED takes
+| the round bit, the sticky bit and the last kept bit of a round-to-nearest-
+| even step, SOFTPOSIT_SATURATED whether the clamp went to maxpos and whether
+| it lost anything; arguments are only evaluated when used.  The _AT forms
+| take a softposit_stat_* index instead of a width name.
+*----------------------------------------------------------------------------*/
+#ifdef SOFTPOSIT_STATS
+extern THREAD_LOCAL softposit_stats_t softposit_statsThread;
+extern THREAD_LOCAL bool softposit_statsRegistered;
+void softposit_statsRegister( void );
+
+static inline softposit_stats_t * softposit_statsLocal( void ){
+	if (!softposit_statsRegistered) softposit_statsRegister();
+	return &softposit_statsThread;
+}
+
+static inline void softposit_statsRound( int w, bool bitNPlusOne, bool bitsMore, bool bitLast ){
+	softposit_stats_t * stats = softposit_statsLocal();
+
+	if (bitNPlusOne && (bitsMore || bitLast)) stats->roundUp[w]++;
+	else if (bitNPlusOne || bitsMore) stats->roundDown[w]++;
+	else stats->exact[w]++;
+}
+
+#define SOFTPOSIT_STAT_OP( op, w ) (softposit_statsLocal()->calls[softposit_stat_##op][softposit_stat_##w]++)
+#define SOFTPOSIT_STAT_NAR( w ) (softposit_statsLocal()->nar[softposit_stat_##w]++)
+#define SOFTPOSIT_STAT_SAT_AT( i, max ) \
+	((max) ? softposit_statsLocal()->maxpos[i]++ : softposit_statsLocal()->minpos[i]++)
+#define SOFTPOSIT_STAT_ROUND_AT( i, bitNPlusOne, bitsMore, bitLast ) \
+	softposit_statsRound( i, bitNPlusOne, bitsMore, bitLast )
+#else
+#define SOFTPOSIT_STAT_OP( op, w ) ((void) 0)
+#define SOFTPOSIT_STAT_NAR( w ) ((void) 0)
+#define SOFTPOSIT_STAT_SAT_AT( i, max ) ((void) 0)
+#define SOFTPOSIT_STAT_ROUND_AT( i, bitNPlusOne, bitsMore, bitLast ) ((void) 0)
+#endif
+
+#ifdef SOFTPOSIT_EXACT
+extern THREAD_LOCAL uint_fast8_t softposit_exceptionFlags;
+#define SOFTPOSIT_RAISE_INEXACT( inexact ) \
+	((inexact) ? (void) (softposit_exceptionFlags |= softposit_flag_inexact) : (void) 0)
+#else
+#define SOFTPOSIT_RAISE_INEXACT( inexact ) ((void) 0)
+#endif
+
+#define SOFTPOSIT_ROUNDED_AT( i, bitNPlusOne, bitsMore, bitLast ) \
+	(SOFTPOSIT_STAT_ROUND_AT( i, bitNPlusOne, bitsMore, bitLast ), SOFTPOSIT_RAISE_INEXACT( (bitNPlusOne) || (bitsMore) ))
+#define SOFTPOSIT_SATURATED_AT( i, max, inexact ) \
+	(SOFTPOSIT_STAT_SAT_AT( i, max ), SOFTPOSIT_RAISE_INEXACT( inexact ))
+#define SOFTPOSIT_ROUNDED( w, bitNPlusOne, bitsMore, bitLast ) \
+	SOFTPOSIT_ROUNDED_AT( softposit_stat_##w, bitNPlusOne, bitsMore, bitLast )
+#define SOFTPOSIT_SATURATED( w, max, inexact ) \
+	SOFTPOSIT_SATURATED_AT( softposit_stat_##w, max, inexact )
+
+/*----------------------------------------------------------------------------
+| Branch-light decoding and rounding for any width up to 64 bits and es up
+| to 2, used by the array and elementary-function kernels instead of the
+| bit-serial regime loops.  Magnitudes are those of nonzero, non-NaR posits
+| held left-aligned in 64 bits (sign position clear) for decoding and
+| right-aligned in nbits-1 bits when packed.  Significands carry the hidden
+| bit at bit 63.
+*----------------------------------------------------------------------------*/
+static inline int_fast32_t softposit_decodeMagPX(
+	uint_fast64_t uiA, int es, uint_fast64_t * sig ){
+
+	uint_fast64_t tmp = uiA<<1;
+	bool regSA = tmp>>63;
+	int run = __builtin_clzll(regSA ? ~tmp : tmp);
+	int_fast32_t kA = regSA ? run-1 : -run;
+
+	tmp = (tmp<<run)<<1;
+	*sig = 0x8000000000000000ULL | ((tmp<<es)>>1);
+	return kA*(1<<es) + (int_fast32_t) (es ? tmp>>(64-es) : 0);
+}
+
+//Rounds to nearest even, saturating to maxpos and minpos; rounding and
+//saturation count into the statistics bucket stat
+static inline uint_fast64_t softposit_roundPackMagPXAt(
+	int_fast32_t scale, uint_fast64_t sig, bool sticky, int nbits, int es, int stat ){
+
+	int_fast32_t kA = scale>>es;
+	uint_fast64_t expA = scale & ((1<<es)-1), uiZ;
+	unsigned __int128 body;
+	int regA;
+	bool bitNPlusOne;
+
+	if (kA>=nbits-2){
+		SOFTPOSIT_SATURATED_AT( stat, 1, kA>nbits-2 || expA || (sig<<1) || sticky );
+		return (1ULL<<(nbits-1)) - 1;
+	}
+	if (kA<-(nbits-2)){
+		SOFTPOSIT_SATURATED_AT( stat, 0, 1 );
+		return 1;
+	}
+	if (kA>=0){
+		regA = kA+2;
+		body = (unsigned __int128) (((1ULL<<(kA+1))-1)<<1) << (128-regA);
+	}
+	else{
+		regA = 1-kA;
+		body = (unsigned __int128) 1 << (128-regA);
+	}
+	body |= (unsigned __int128) expA << (128-regA-es);
+	body |= (unsigned __int128) (sig & 0x7FFFFFFFFFFFFFFFULL) << (65-regA-es);
+
+	uiZ = (uint_fast64_t) (body >> (129-nbits));
+	bitNPlusOne = (body >> (128-nbits)) & 1;
+	sticky |= (body << nbits) != 0;
+	SOFTPOSIT_ROUNDED_AT( stat, bitNPlusOne, sticky, uiZ&1 );
+	return uiZ + (bitNPlusOne & (sticky | (uiZ&1)));
+}
+
+static inline uint_fast64_t softposit_roundPackMagPX(
+	int_fast32_t scale, uint_fast64_t sig, bool sticky, int nbits, int es ){
+
+	return softposit_roundPackMagPXAt( scale, sig, sticky, nbits, es, softposit_stat_pX );
+}
+
+//Unpacks a nonzero, non-NaR posit left-aligned in 32 bits
+static inline int_fast32_t softposit_unpackPX(
+	uint_fast32_t uiA, int es, bool * sign, uint_fast64_t * sig ){
+
+	*sign = uiA>>31;
+	if (*sign) uiA = -uiA & 0xFFFFFFFF;
+	return softposit_decodeMagPX( (uint_fast64_t) uiA<<32, es, sig );
+}
+
+//Rounds and packs a posit of nbits<=32, left-aligned in 32 bits
+static inline uint_fast32_t softposit_packPX(
+	bool sign, int_fast32_t scale, uint_fast64_t sig, bool sticky, int nbits, int es ){
+
+	uint_fast32_t uiZ = (uint_fast32_t) softposit_roundPackMagPX( scale, sig, sticky, nbits, es ) << (32-nbits);
+	return sign ? -uiZ & 0xFFFFFFFF : uiZ;
+}
+
+//Rounds a posit of any es to nbitsZ bits and esZ
+static inline uint_fast32_t softposit_convertPX( uint_fast32_t uiA, int esA, int nbitsZ, int esZ ){
+	uint_fast64_t sig;
+	int_fast32_t scale;
+	bool sign;
+
+	if (uiA==0 || uiA==0x80000000) return uiA;
+	scale = softposit_unpackPX( uiA, esA, &sign, &sig );
+	return softposit_packPX( sign, scale, sig, false, nbitsZ, esZ );
+}
+
+#ifdef __AVX2__
+/*----------------------------------------------------------------------------
+| Eight-lane AVX2 forms of the decode and round-pack above, on patterns
+| left-aligned in 32-bit lanes, for widths up to 32 bits.  Without a vector
+| count-leading-zeros the run length comes from the exponents of two exact
+| integer-to-float conversions.
+*----------------------------------------------------------------------------*/
+static inline __m256i softposit_clzx8( __m256i x ){
+	__m256i hi = _mm256_srli_epi32( x, 8 );
+	__m256i eHi = _mm256_srli_epi32( _mm256_castps_si256( _mm256_cvtepi32_ps( hi ) ), 23 );
+	__m256i eLo = _mm256_srli_epi32( _mm256_castps_si256( _mm256_cvtepi32_ps(
+			_mm256_and_si256( x, _mm256_set1_epi32( 0xFF ) ) ) ), 23 );
+	__m256i log2 = _mm256_blendv_epi8( _mm256_sub_epi32( eHi, _mm256_set1_epi32( 119 ) ),
+			_mm256_sub_epi32( eLo, _mm256_set1_epi32( 127 ) ), _mm256_cmpeq_epi32( hi, _mm256_setzero_si256() ) );
+	return _mm256_sub_epi32( _mm256_set1_epi32( 31 ), log2 );
+}
+
+//Scale of nonzero, non-NaR lanes; *sign gets all-ones for negative lanes and
+//*frac the fraction left-aligned without the hidden bit
+static inline __m256i softposit_decodePXx8( __m256i uA, int es, __m256i * sign, __m256i * frac ){
+	__m256i zero = _mm256_setzero_si256(), one = _mm256_set1_epi32( 1 );
+	__m256i t, regS, run, rest, scale;
+
+	*sign = _mm256_srai_epi32( uA, 31 );
+	t = _mm256_slli_epi32( _mm256_sub_epi32( _mm256_xor_si256( uA, *sign ), *sign ), 1 );
+	regS = _mm256_srai_epi32( t, 31 );
+	run = softposit_clzx8( _mm256_xor_si256( t, regS ) );
+	rest = _mm256_sllv_epi32( t, _mm256_add_epi32( run, one ) );
+	*frac = _mm256_sllv_epi32( rest, _mm256_set1_epi32( es ) );
+	scale = _mm256_blendv_epi8( _mm256_sub_epi32( zero, run ), _mm256_sub_epi32( run, one ), regS );
+	scale = _mm256_sllv_epi32( scale, _mm256_set1_epi32( es ) );
+	if (es) scale = _mm256_add_epi32( scale, _mm256_srlv_epi32( rest, _mm256_set1_epi32( 32-es ) ) );
+	return scale;
+}
+
+//Rounds to nbits (2 to 32) and es like softposit_packPX, left-aligned
+static inline __m256i softposit_packPXx8( __m256i sign, __m256i scale, __m256i frac, int nbits, int es ){
+	__m256i zero = _mm256_setzero_si256(), one = _mm256_set1_epi32( 1 );
+	__m256i kZ = _mm256_srav_epi32( scale, _mm256_set1_epi32( es ) );
+	__m256i kc = _mm256_min_epi32( _mm256_max_epi32( kZ, _mm256_set1_epi32( 2-nbits ) ), _mm256_set1_epi32( nbits-3 ) );
+	__m256i kNeg = _mm256_cmpgt_epi32( zero, kc );
+	__m256i regime = _mm256_blendv_epi8(
+			_mm256_xor_si256( _mm256_set1_epi32( 0x7FFFFFFF ),
+					_mm256_srlv_epi32( _mm256_set1_epi32( 0x7FFFFFFF ), _mm256_add_epi32( kc, one ) ) ),
+			_mm256_srlv_epi32( _mm256_set1_epi32( 0x40000000 ), _mm256_sub_epi32( zero, kc ) ), kNeg );
+	__m256i shift = _mm256_blendv_epi8( _mm256_add_epi32( kc, _mm256_set1_epi32( 3 ) ),
+			_mm256_sub_epi32( _mm256_set1_epi32( 2 ), kc ), kNeg );
+	__m256i y = frac, lost = zero, body, lostY, uiZ, rbit, up;
+
+	if (es){
+		y = _mm256_or_si256( _mm256_slli_epi32( _mm256_and_si256( scale, _mm256_set1_epi32( (1<<es)-1 ) ), 32-es ),
+				_mm256_srli_epi32( frac, es ) );
+		lost = _mm256_slli_epi32( frac, 32-es );
+	}
+	body = _mm256_or_si256( regime, _mm256_srlv_epi32( y, shift ) );
+	lostY = _mm256_sllv_epi32( y, _mm256_sub_epi32( _mm256_set1_epi32( 32 ), shift ) );
+	if (nbits<32){
+		uiZ = _mm256_srlv_epi32( body, _mm256_set1_epi32( 32-nbits ) );
+		rbit = _mm256_and_si256( _mm256_srlv_epi32( body, _mm256_set1_epi32( 31-nbits ) ), one );
+		lost = _mm256_or_si256( lost, _mm256_or_si256( lostY,
+				_mm256_and_si256( body, _mm256_set1_epi32( (1<<(31-nbits))-1 ) ) ) );
+	}
+	else{
+		uiZ = body;
+		rbit = _mm256_srli_epi32( lostY, 31 );
+		lost = _mm256_or_si256( lost, _mm256_slli_epi32( lostY, 1 ) );
+	}
+	up = _mm256_and_si256( rbit, _mm256_or_si256( _mm256_andnot_si256( _mm256_cmpeq_epi32( lost, zero ), one ), uiZ ) );
+	uiZ = _mm256_add_epi32( uiZ, _mm256_and_si256( up, one ) );
+	uiZ = _mm256_blendv_epi8( uiZ, _mm256_set1_epi32( (int) ((1U<<(nbits-1))-1) ),
+			_mm256_cmpgt_epi32( kZ, _mm256_set1_epi32( nbits-3 ) ) );
+	uiZ = _mm256_blendv_epi8( uiZ, one, _mm256_cmpgt_epi32( _mm256_set1_epi32( 2-nbits ), kZ ) );
+	uiZ = _mm256_sllv_epi32( uiZ, _mm256_set1_epi32( 32-nbits ) );
+	return _mm256_sub_epi32( _mm256_xor_si256( uiZ, sign ), sign );
+}
+#endif
+
+//Unpacks a nonzero, non-NaR 64-bit posit (es=2)
+static inline int_fast32_t softposit_unpackP64( uint_fast64_t uiA, bool * sign, uint_fast64_t * sig ){
+	*sign = uiA>>63;
+	if (*sign) uiA = -uiA;
+	return softposit_decodeMagPX( uiA, 2, sig );
+}
+
+//Rounds and packs a 64-bit posit (es=2)
+static inline uint_fast64_t softposit_packP64( bool sign, int_fast32_t scale, uint_fast64_t sig, bool sticky ){
+	uint_fast64_t uiZ = softposit_roundPackMagPX( scale, sig, sticky, 64, 2 );
+	return sign ? -uiZ : uiZ;
+}
+
+//|a| * 2^(scale-63) rounded to the nearest integer, ties to even; saturates
+static inline uint_fast64_t softposit_roundSigToInt( int_fast32_t scale, uint_fast64_t sig ){
+	uint_fast64_t iZ, rem;
+
+	if (scale<-1) return 0;
+	if (scale==-1) return sig>0x8000000000000000ULL;
+	if (scale>=64) return UINT64_MAX;
+	if (scale==63) return sig;
+	iZ = sig>>(63-scale);
+	rem = sig<<(scale+1);
+	return iZ + ((rem>0x8000000000000000ULL) | ((rem==0x8000000000000000ULL) & iZ));
+}
+
+/*----------------------------------------------------------------------------
+| Arithmetic for posits of any width up to 32 bits and any es up to 2, on
+| patterns left-aligned in 32 bits.  Every result is rounded once.  These
+| back the es=0 dynamic-width posits.
+*----------------------------------------------------------------------------*/
+uint_fast32_t softposit_addPX( uint_fast32_t, uint_fast32_t, int, int );
+uint_fast32_t softposit_mulPX( uint_fast32_t, uint_fast32_t, int, int );
+uint_fast32_t softposit_divPX( uint_fast32_t, uint_fast32_t, int, int );
+uint_fast32_t softposit_mulAddPX( uint_fast32_t, uint_fast32_t, uint_fast32_t, int, int );
+uint_fast32_t softposit_sqrtPX( uint_fast32_t, int, int );
+uint_fast32_t softposit_fromIntPX( bool, uint_fast64_t, int, int );
+uint_fast64_t softposit_toIntMagPX( uint_fast32_t, int );
+
+//Private writable file mapping and in-place byte swapping (c_positTensorFile.c)
+void * softposit_mapFile( const char *, size_t * );
+void softposit_swapWords( void *, uint64_t, int );
+
+//Correctly rounded decimal parsing into an nbits pattern (c_convertPositChars.c)
+const char * softposit_parsePosit( const char *, const char *, int, int, uint_fast64_t * );
+
+//Matrix Market coordinate file to CSR with nbits-wide values (c_matrixMarket.c)
+int softposit_readMatrixMarketCSR( const char *, int, int, uint64_t *, uint64_t *, uint64_t *,
+		uint64_t **, uint32_t **, void ** );
+
+/*----------------------------------------------------------------------------
+| Fork-join helper (s_parallel.c): runs body(ctx, part, nParts) for every
+| part, one per thread, on nThreads threads (<= 0 means one per online CPU).
+*----------------------------------------------------------------------------*/
+#define SOFTPOSIT_MAXTHREADS 256
+int softposit_threadCount( int );
+void softposit_parallelRun( int, void (*)( void *, int, int ), void * );
+
+//First index i in [0, n] whose prefix weight prefix[i] reaches part/nParts of prefix[n]
+static inline uint64_t softposit_partitionPoint( const uint64_t * prefix, uint64_t n, int part, int nParts ){
+	uint64_t target = (uint64_t) ((unsigned __int128) prefix[n] * part / nParts);
+	uint64_t lo = 0, hi = n;
+
+	while (lo<hi){
+		uint64_t mid = lo + (hi-lo)/2;
+		if (prefix[mid]<target) lo = mid+1;
+		else hi = mid;
+	}
+	return lo;
+}
 
 /*uint_fast16_t reglengthP32UI (uint32_t);
 int_fast16_t regkP32UI(bool, uint_fast32_t);
@@ -49,4 +49,24 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 extern const uint_fast16_t softposit_approxRecipSqrt0[16];
 extern const uint_fast16_t softposit_approxRecipSqrt1[16];
 
+//Correctly rounded function tables, generated at build time by gen_elementaryTables
+extern const uint8_t softposit_expP8[256];
+extern const uint8_t softposit_logP8[256];
+extern const uint8_t softposit_sigmoidP8[256];
+extern const uint8_t softposit_tanhP8[256];
+extern const uint8_t softposit_geluP8[256];
+extern const uint8_t softposit_reciprocalP8[256];
+extern const uint8_t softposit_rsqrtP8[256];
+extern const uint8_t softposit_sinP8[256];
+extern const uint8_t softposit_cosP8[256];
+extern const uint16_t softposit_expP16[65536];
+extern const uint16_t softposit_logP16[65536];
+extern const uint16_t softposit_sigmoidP16[65536];
+extern const uint16_t softposit_tanhP16[65536];
+extern const uint16_t softposit_geluP16[65536];
+extern const uint16_t softposit_reciprocalP16[65536];
+extern const uint16_t softposit_rsqrtP16[65536];
+extern const uint16_t softposit_sinP16[65536];
+extern const uint16_t softposit_cosP16[65536];
+
 #endif
@@ -56,6 +56,7 @@ extern "C"{
 #endif
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef SOFTPOSIT_QUAD
@@ -68,35 +69,76 @@ extern "C"{
 
 
 #ifndef THREAD_LOCAL
+#if !defined(SOFTPOSIT_STATS) && !defined(SOFTPOSIT_EXACT)
 #define THREAD_LOCAL
+#elif defined(__cplusplus)
+#define THREAD_LOCAL thread_local
+#else
+#define THREAD_LOCAL _Thread_local
+#endif
 #endif
 
 #define castUI( a ) ( (a).v )
 
+/*----------------------------------------------------------------------------
+| Exception flags.  A library built with SOFTPOSIT_EXACT raises
+| softposit_flag_inexact in the calling thread whenever posit8, posit16,
+| posit32 or pX0 arithmetic has to round or saturate its result, including
+| inside the batch and multithreaded kernels.  Like IEEE floating-point flags
+| it stays raised until cleared, so a whole batch is checked with one test.
+| Without SOFTPOSIT_EXACT the flag is never raised.
+*----------------------------------------------------------------------------*/
+enum { softposit_flag_inexact = 1 };
+
+uint_fast8_t softposit_testFlags( uint_fast8_t );
+void softposit_clearFlags( uint_fast8_t );
+void softposit_raiseFlags( uint_fast8_t );
+
 /*----------------------------------------------------------------------------
 | Integer-to-posit conversion routines.
 *----------------------------------------------------------------------------*/
 posit8_t  ui32_to_p8( uint32_t );
 posit16_t ui32_to_p16( uint32_t );
 posit32_t ui32_to_p32( uint32_t );
-//posit64_t ui32_to_p64( uint32_t );
+posit64_t ui32_to_p64( uint32_t );
 
 
 posit8_t  ui64_to_p8( uint64_t );
 posit16_t ui64_to_p16( uint64_t );
 posit32_t ui64_to_p32( uint64_t );
-//posit64_t ui64_to_p64( uint64_t );
+posit64_t ui64_to_p64( uint64_t );
 
 posit8_t  i32_to_p8( int32_t );
 posit16_t i32_to_p16( int32_t );
 posit32_t i32_to_p32( int32_t );
-//posit64_t i32_to_p64( int32_t );
+posit64_t i32_to_p64( int32_t );
 
 posit8_t  i64_to_p8( int64_t );
 posit16_t i64_to_p16( int64_t );
 posit32_t i64_to_p32( int64_t );
 posit64_t i64_to_p64( int64_t );
 
+//Batch integer conversions with a power-of-two scale: iM_to_pN_n gives a*2^scale
+//rounded once, pN_to_iM_n gives a*2^-scale rounded to nearest even, saturated, NaR to 0
+void i8_to_p8_n( const int8_t *, size_t, posit8_t *, int );
+void i16_to_p8_n( const int16_t *, size_t, posit8_t *, int );
+void i32_to_p8_n( const int32_t *, size_t, posit8_t *, int );
+void p8_to_i8_n( const posit8_t *, size_t, int8_t *, int );
+void p8_to_i16_n( const posit8_t *, size_t, int16_t *, int );
+void p8_to_i32_n( const posit8_t *, size_t, int32_t *, int );
+void i8_to_p16_n( const int8_t *, size_t, posit16_t *, int );
+void i16_to_p16_n( const int16_t *, size_t, posit16_t *, int );
+void i32_to_p16_n( const int32_t *, size_t, posit16_t *, int );
+void p16_to_i8_n( const posit16_t *, size_t, int8_t *, int );
+void p16_to_i16_n( const posit16_t *, size_t, int16_t *, int );
+void p16_to_i32_n( const posit16_t *, size_t, int32_t *, int );
+void i8_to_p32_n( const int8_t *, size_t, posit32_t *, int );
+void i16_to_p32_n( const int16_t *, size_t, posit32_t *, int );
+void i32_to_p32_n( const int32_t *, size_t, posit32_t *, int );
+void p32_to_i8_n( const posit32_t *, size_t, int8_t *, int );
+void p32_to_i16_n( const posit32_t *, size_t, int16_t *, int );
+void p32_to_i32_n( const posit32_t *, size_t, int32_t *, int );
+
 
 
 /*----------------------------------------------------------------------------
@@ -111,7 +153,7 @@ int_fast64_t p8_to_i64( posit8_t);
 
 posit16_t p8_to_p16( posit8_t );
 posit32_t p8_to_p32( posit8_t );
-//posit64_t p8_to_p64( posit8_t );
+posit64_t p8_to_p64( posit8_t );
 
 posit_1_t p8_to_pX1( posit8_t, int );
 posit_2_t p8_to_pX2( posit8_t, int );
@@ -127,6 +169,63 @@ bool p8_eq( posit8_t, posit8_t );
 bool p8_le( posit8_t, posit8_t );
 bool p8_lt( posit8_t, posit8_t );
 
+//Batch kernels
+void p8_add_n( const posit8_t *, const posit8_t *, size_t, posit8_t * );
+void p8_sub_n( const posit8_t *, const posit8_t *, size_t, posit8_t * );
+void p8_mul_n( const posit8_t *, const posit8_t *, size_t, posit8_t * );
+void p8_div_n( const posit8_t *, const posit8_t *, size_t, posit8_t * );
+void p8_mulAdd_n( const posit8_t *, const posit8_t *, const posit8_t *, size_t, posit8_t * );
+void p8_sqrt_n( const posit8_t *, size_t, posit8_t * );
+void p8_roundToInt_n( const posit8_t *, size_t, posit8_t * );
+void convertDoubleToP8_n( const double *, size_t, posit8_t * );
+void convertP8ToDouble_n( const posit8_t *, size_t, double * );
+//Dot product through the quire, rounded once
+posit8_t p8_dot_n( const posit8_t *, const posit8_t *, size_t );
+
+//Sorting and searching, NaR sorts before all real values
+void p8_sort_n( posit8_t *, size_t );
+void p8_argsort_n( const posit8_t *, size_t, size_t * );
+size_t p8_topk_n( const posit8_t *, size_t, size_t, posit8_t *, size_t * );
+size_t p8_searchsorted( const posit8_t *, size_t, posit8_t );
+void p8_searchsorted_n( const posit8_t *, size_t, const posit8_t *, size_t, size_t * );
+
+//Array reductions and elementwise kernels on the bit patterns
+posit8_t p8_min_n( const posit8_t *, size_t );
+posit8_t p8_max_n( const posit8_t *, size_t );
+size_t p8_argmin_n( const posit8_t *, size_t );
+size_t p8_argmax_n( const posit8_t *, size_t );
+void p8_clamp_n( const posit8_t *, size_t, posit8_t, posit8_t, posit8_t * );
+void p8_select_n( const uint8_t *, const posit8_t *, const posit8_t *, size_t, posit8_t * );
+void p8_eq_n( const posit8_t *, const posit8_t *, size_t, uint8_t * );
+void p8_le_n( const posit8_t *, const posit8_t *, size_t, uint8_t * );
+void p8_lt_n( const posit8_t *, const posit8_t *, size_t, uint8_t * );
+size_t p8_countNaR_n( const posit8_t *, size_t );
+void p8_abs_n( const posit8_t *, size_t, posit8_t * );
+void p8_neg_n( const posit8_t *, size_t, posit8_t * );
+
+//Elementary functions by correctly rounded table lookup
+posit8_t p8_exp( posit8_t );
+posit8_t p8_log( posit8_t );
+posit8_t p8_sigmoid( posit8_t );
+posit8_t p8_tanh( posit8_t );
+posit8_t p8_gelu( posit8_t );
+posit8_t p8_reciprocal( posit8_t );
+posit8_t p8_rsqrt( posit8_t );
+posit8_t p8_sin( posit8_t );
+posit8_t p8_cos( posit8_t );
+void p8_exp_n( const posit8_t *, size_t, posit8_t * );
+void p8_log_n( const posit8_t *, size_t, posit8_t * );
+void p8_sigmoid_n( const posit8_t *, size_t, posit8_t * );
+void p8_tanh_n( const posit8_t *, size_t, posit8_t * );
+void p8_gelu_n( const posit8_t *, size_t, posit8_t * );
+void p8_reciprocal_n( const posit8_t *, size_t, posit8_t * );
+void p8_rsqrt_n( const posit8_t *, size_t, posit8_t * );
+void p8_sin_n( const posit8_t *, size_t, posit8_t * );
+void p8_cos_n( const posit8_t *, size_t, posit8_t * );
+//Bit-manipulation approximation of sigmoid for es=0
+posit8_t p8_sigmoidFast( posit8_t );
+void p8_sigmoidFast_n( const posit8_t *, size_t, posit8_t * );
+
 
 //Quire 8
 quire8_t q8_fdp_add(quire8_t, posit8_t, posit8_t);
@@ -172,7 +271,7 @@ static inline quire8_t q8Clr(){
 #define absP8(a)({\
 		union ui8_p8 uA;\
 		uA.p = (a);\
-		int mask = uA.ui >> 7;\
+		int mask = -(uA.ui >> 7);\
 		uA.ui = ((uA.ui + mask) ^ mask)&0xFF;\
 		uA.p; \
 })
@@ -180,6 +279,11 @@ static inline quire8_t q8Clr(){
 //Helper
 double convertP8ToDouble(posit8_t);
 posit8_t convertDoubleToP8(double);
+//Decimal text (no stdio or locale); _n forms read/write delimited lists in chunks
+const char * p8_from_chars( const char *, const char *, posit8_t * );
+char * p8_to_chars( char *, char *, posit8_t );
+size_t p8_from_chars_n( const char *, const char *, posit8_t *, size_t, bool, const char ** );
+size_t p8_to_chars_n( char *, char *, const posit8_t *, size_t, char, char ** );
 
 /*----------------------------------------------------------------------------
 | 16-bit (half-precision) posit operations.
@@ -192,7 +296,7 @@ int_fast32_t p16_to_i32( posit16_t);
 int_fast64_t p16_to_i64( posit16_t );
 posit8_t p16_to_p8( posit16_t );
 posit32_t p16_to_p32( posit16_t );
-//posit64_t p16_to_p64( posit16_t );
+posit64_t p16_to_p64( posit16_t );
 
 posit_1_t p16_to_pX1( posit16_t, int );
 posit_2_t p16_to_pX2( posit16_t, int );
@@ -208,6 +312,127 @@ bool p16_eq( posit16_t, posit16_t );
 bool p16_le( posit16_t, posit16_t );
 bool p16_lt( posit16_t, posit16_t );
 
+//Batch kernels
+void p16_add_n( const posit16_t *, const posit16_t *, size_t, posit16_t * );
+void p16_sub_n( const posit16_t *, const posit16_t *, size_t, posit16_t * );
+void p16_mul_n( const posit16_t *, const posit16_t *, size_t, posit16_t * );
+void p16_div_n( const posit16_t *, const posit16_t *, size_t, posit16_t * );
+void p16_mulAdd_n( const posit16_t *, const posit16_t *, const posit16_t *, size_t, posit16_t * );
+void p16_sqrt_n( const posit16_t *, size_t, posit16_t * );
+void p16_roundToInt_n( const posit16_t *, size_t, posit16_t * );
+void convertDoubleToP16_n( const double *, size_t, posit16_t * );
+void convertP16ToDouble_n( const posit16_t *, size_t, double * );
+//Dot product through the quire, rounded once
+posit16_t p16_dot_n( const posit16_t *, const posit16_t *, size_t );
+
+//Sparse matrices: CSR, and SELL-C-sigma (slices of C rows stored column by
+//column, rows sorted by length within windows of sigma rows)
+#define SOFTPOSIT_SELL_MAXC 64
+typedef struct {
+	uint64_t rows, cols, nnz;
+	uint64_t * rowPtr;
+	uint32_t * colIdx;
+	posit16_t * val;
+} p16_csr_t;
+
+typedef struct {
+	uint64_t rows, cols, nnz;
+	int C;
+	uint64_t nSlices;
+	uint64_t * slicePtr;    //nSlices+1 offsets into colIdx and val
+	uint32_t * perm;        //stored row -> matrix row
+	uint32_t * rowLen;      //stored row -> entries; the rest of its slice is padding
+	uint32_t * colIdx;
+	posit16_t * val;
+} p16_sell_t;
+
+int p16_csr_readMatrixMarket( p16_csr_t *, const char * );
+void p16_csr_free( p16_csr_t * );
+int p16_sell_fromCSR( p16_sell_t *, const p16_csr_t *, int C, uint64_t sigma );
+void p16_sell_free( p16_sell_t * );
+//y = A*x, each row rounded once from the quire; nThreads <= 0 uses every CPU
+void p16_csr_spmv( const p16_csr_t *, const posit16_t *, posit16_t *, int nThreads );
+void p16_sell_spmv( const p16_sell_t *, const posit16_t *, posit16_t *, int nThreads );
+
+//Dense factorisations, row-major with leading dimension lda; solves overwrite b
+int p16_luFactor( posit16_t *, size_t n, size_t lda, size_t * piv, int nThreads );
+void p16_luSolve( const posit16_t *, size_t n, size_t lda, const size_t * piv, posit16_t * b );
+int p16_cholFactor( posit16_t *, size_t n, size_t lda, int nThreads );
+void p16_cholSolve( const posit16_t *, size_t n, size_t lda, posit16_t * b );
+
+//Unnormalised power-of-two FFTs on split real/imaginary arrays
+#define SOFTPOSIT_FFT_QUIRE 1    //round each butterfly output once from the quire
+typedef struct {
+	size_t n;
+	int flags;
+	posit16_t * wr, * wi, * hwr, * hwi;
+} p16_fftPlan_t;
+
+int p16_fftPlan( p16_fftPlan_t *, size_t n, int flags );
+void p16_fftPlanFree( p16_fftPlan_t * );
+void p16_fft( const p16_fftPlan_t *, posit16_t * re, posit16_t * im, bool inverse );
+void p16_fft_batch( const p16_fftPlan_t *, posit16_t * re, posit16_t * im, size_t count, size_t dist, bool inverse, int nThreads );
+//n reals to n/2+1 bins and back; p16_irfft overwrites the bins
+void p16_rfft( const p16_fftPlan_t *, const posit16_t * x, posit16_t * re, posit16_t * im );
+void p16_irfft( const p16_fftPlan_t *, posit16_t * re, posit16_t * im, posit16_t * x );
+
+//Complex posits; products round each component once from the quire
+typedef struct {
+	posit16_t re, im;
+} cposit16_t;
+
+cposit16_t cp16_add( cposit16_t, cposit16_t );
+cposit16_t cp16_sub( cposit16_t, cposit16_t );
+cposit16_t cp16_mul( cposit16_t, cposit16_t );
+cposit16_t cp16_div( cposit16_t, cposit16_t );
+cposit16_t cp16_conj( cposit16_t );
+posit16_t cp16_norm( cposit16_t );
+posit16_t cp16_abs( cposit16_t );
+void cp16_mul_n( const posit16_t *, const posit16_t *, const posit16_t *, const posit16_t *, size_t, posit16_t *, posit16_t * );
+cposit16_t cp16_dotc_n( const posit16_t *, const posit16_t *, const posit16_t *, const posit16_t *, size_t );
+void cp16_abs_n( const posit16_t *, const posit16_t *, size_t, posit16_t * );
+
+//Sorting and searching, NaR sorts before all real values
+void p16_sort_n( posit16_t *, size_t );
+void p16_argsort_n( const posit16_t *, size_t, size_t * );
+size_t p16_topk_n( const posit16_t *, size_t, size_t, posit16_t *, size_t * );
+size_t p16_searchsorted( const posit16_t *, size_t, posit16_t );
+void p16_searchsorted_n( const posit16_t *, size_t, const posit16_t *, size_t, size_t * );
+
+//Array reductions and elementwise kernels on the bit patterns
+posit16_t p16_min_n( const posit16_t *, size_t );
+posit16_t p16_max_n( const posit16_t *, size_t );
+size_t p16_argmin_n( const posit16_t *, size_t );
+size_t p16_argmax_n( const posit16_t *, size_t );
+void p16_clamp_n( const posit16_t *, size_t, posit16_t, posit16_t, posit16_t * );
+void p16_select_n( const uint8_t *, const posit16_t *, const posit16_t *, size_t, posit16_t * );
+void p16_eq_n( const posit16_t *, const posit16_t *, size_t, uint8_t * );
+void p16_le_n( const posit16_t *, const posit16_t *, size_t, uint8_t * );
+void p16_lt_n( const posit16_t *, const posit16_t *, size_t, uint8_t * );
+size_t p16_countNaR_n( const posit16_t *, size_t );
+void p16_abs_n( const posit16_t *, size_t, posit16_t * );
+void p16_neg_n( const posit16_t *, size_t, posit16_t * );
+
+//Elementary functions by correctly rounded table lookup
+posit16_t p16_exp( posit16_t );
+posit16_t p16_log( posit16_t );
+posit16_t p16_sigmoid( posit16_t );
+posit16_t p16_tanh( posit16_t );
+posit16_t p16_gelu( posit16_t );
+posit16_t p16_reciprocal( posit16_t );
+posit16_t p16_rsqrt( posit16_t );
+posit16_t p16_sin( posit16_t );
+posit16_t p16_cos( posit16_t );
+void p16_exp_n( const posit16_t *, size_t, posit16_t * );
+void p16_log_n( const posit16_t *, size_t, posit16_t * );
+void p16_sigmoid_n( const posit16_t *, size_t, posit16_t * );
+void p16_tanh_n( const posit16_t *, size_t, posit16_t * );
+void p16_gelu_n( const posit16_t *, size_t, posit16_t * );
+void p16_reciprocal_n( const posit16_t *, size_t, posit16_t * );
+void p16_rsqrt_n( const posit16_t *, size_t, posit16_t * );
+void p16_sin_n( const posit16_t *, size_t, posit16_t * );
+void p16_cos_n( const posit16_t *, size_t, posit16_t * );
+
 
 #ifdef SOFTPOSIT_QUAD
 	__float128 convertP16ToQuadDec(posit16_t);
@@ -271,7 +496,7 @@ static inline quire16_t q16Clr(){
 #define absP16(a)({\
 		union ui16_p16 uA;\
 		uA.p = (a);\
-		int mask = uA.ui >> 15;\
+		int mask = -(uA.ui >> 15);\
 		uA.ui = ((uA.ui + mask) ^ mask)&0xFFFF;\
 		uA.p; \
 })
@@ -281,6 +506,22 @@ static inline quire16_t q16Clr(){
 double convertP16ToDouble(posit16_t);
 posit16_t convertFloatToP16(float);
 posit16_t convertDoubleToP16(double);
+//IEEE half and bfloat16 values are passed as their 16-bit patterns
+posit16_t convertHalfToP16(uint16_t);
+uint16_t convertP16ToHalf(posit16_t);
+posit16_t convertBF16ToP16(uint16_t);
+uint16_t convertP16ToBF16(posit16_t);
+void convertFloatToP16_n( const float *, size_t, posit16_t * );
+void convertP16ToFloat_n( const posit16_t *, size_t, float * );
+void convertHalfToP16_n( const uint16_t *, size_t, posit16_t * );
+void convertP16ToHalf_n( const posit16_t *, size_t, uint16_t * );
+void convertBF16ToP16_n( const uint16_t *, size_t, posit16_t * );
+void convertP16ToBF16_n( const posit16_t *, size_t, uint16_t * );
+//Decimal text (no stdio or locale); _n forms read/write delimited lists in chunks
+const char * p16_from_chars( const char *, const char *, posit16_t * );
+char * p16_to_chars( char *, char *, posit16_t );
+size_t p16_from_chars_n( const char *, const char *, posit16_t *, size_t, bool, const char ** );
+size_t p16_to_chars_n( char *, char *, const posit16_t *, size_t, char, char ** );
 
 /*----------------------------------------------------------------------------
 | 32-bit (single-precision) posit operations.
@@ -292,7 +533,7 @@ int_fast64_t p32_to_i64( posit32_t );
 
 posit8_t p32_to_p8( posit32_t );
 posit16_t p32_to_p16( posit32_t );
-//posit64_t p32_to_p64( posit32_t );
+posit64_t p32_to_p64( posit32_t );
 
 
 posit32_t p32_roundToInt( posit32_t );
@@ -306,6 +547,127 @@ bool p32_eq( posit32_t, posit32_t );
 bool p32_le( posit32_t, posit32_t );
 bool p32_lt( posit32_t, posit32_t );
 
+//Batch kernels
+void p32_add_n( const posit32_t *, const posit32_t *, size_t, posit32_t * );
+void p32_sub_n( const posit32_t *, const posit32_t *, size_t, posit32_t * );
+void p32_mul_n( const posit32_t *, const posit32_t *, size_t, posit32_t * );
+void p32_div_n( const posit32_t *, const posit32_t *, size_t, posit32_t * );
+void p32_mulAdd_n( const posit32_t *, const posit32_t *, const posit32_t *, size_t, posit32_t * );
+void p32_sqrt_n( const posit32_t *, size_t, posit32_t * );
+void p32_roundToInt_n( const posit32_t *, size_t, posit32_t * );
+void convertDoubleToP32_n( const double *, size_t, posit32_t * );
+void convertP32ToDouble_n( const posit32_t *, size_t, double * );
+//Dot product through the quire, rounded once
+posit32_t p32_dot_n( const posit32_t *, const posit32_t *, size_t );
+
+//Sparse matrices (see the 16-bit section)
+typedef struct {
+	uint64_t rows, cols, nnz;
+	uint64_t * rowPtr;
+	uint32_t * colIdx;
+	posit32_t * val;
+} p32_csr_t;
+
+typedef struct {
+	uint64_t rows, cols, nnz;
+	int C;
+	uint64_t nSlices;
+	uint64_t * slicePtr;    //nSlices+1 offsets into colIdx and val
+	uint32_t * perm;        //stored row -> matrix row
+	uint32_t * rowLen;      //stored row -> entries; the rest of its slice is padding
+	uint32_t * colIdx;
+	posit32_t * val;
+} p32_sell_t;
+
+int p32_csr_readMatrixMarket( p32_csr_t *, const char * );
+void p32_csr_free( p32_csr_t * );
+int p32_sell_fromCSR( p32_sell_t *, const p32_csr_t *, int C, uint64_t sigma );
+void p32_sell_free( p32_sell_t * );
+//y = A*x, each row rounded once from the quire; nThreads <= 0 uses every CPU
+void p32_csr_spmv( const p32_csr_t *, const posit32_t *, posit32_t *, int nThreads );
+void p32_sell_spmv( const p32_sell_t *, const posit32_t *, posit32_t *, int nThreads );
+
+//Dense factorisations, row-major with leading dimension lda; solves overwrite b
+int p32_luFactor( posit32_t *, size_t n, size_t lda, size_t * piv, int nThreads );
+void p32_luSolve( const posit32_t *, size_t n, size_t lda, const size_t * piv, posit32_t * b );
+int p32_cholFactor( posit32_t *, size_t n, size_t lda, int nThreads );
+void p32_cholSolve( const posit32_t *, size_t n, size_t lda, posit32_t * b );
+//Factor in posit16, refine to posit32 accuracy with quire residuals; returns steps or -1
+int p32_luSolveRefine( const posit32_t *, size_t n, size_t lda, const posit32_t * b, posit32_t * x, int maxIter, int nThreads );
+int p32_cholSolveRefine( const posit32_t *, size_t n, size_t lda, const posit32_t * b, posit32_t * x, int maxIter, int nThreads );
+
+//Unnormalised power-of-two FFTs on split real/imaginary arrays
+typedef struct {
+	size_t n;
+	int flags;
+	posit32_t * wr, * wi, * hwr, * hwi;
+} p32_fftPlan_t;
+
+int p32_fftPlan( p32_fftPlan_t *, size_t n, int flags );
+void p32_fftPlanFree( p32_fftPlan_t * );
+void p32_fft( const p32_fftPlan_t *, posit32_t * re, posit32_t * im, bool inverse );
+void p32_fft_batch( const p32_fftPlan_t *, posit32_t * re, posit32_t * im, size_t count, size_t dist, bool inverse, int nThreads );
+//n reals to n/2+1 bins and back; p32_irfft overwrites the bins
+void p32_rfft( const p32_fftPlan_t *, const posit32_t * x, posit32_t * re, posit32_t * im );
+void p32_irfft( const p32_fftPlan_t *, posit32_t * re, posit32_t * im, posit32_t * x );
+
+//Complex posits; products round each component once from the quire
+typedef struct {
+	posit32_t re, im;
+} cposit32_t;
+
+cposit32_t cp32_add( cposit32_t, cposit32_t );
+cposit32_t cp32_sub( cposit32_t, cposit32_t );
+cposit32_t cp32_mul( cposit32_t, cposit32_t );
+cposit32_t cp32_div( cposit32_t, cposit32_t );
+cposit32_t cp32_conj( cposit32_t );
+posit32_t cp32_norm( cposit32_t );
+posit32_t cp32_abs( cposit32_t );
+void cp32_mul_n( const posit32_t *, const posit32_t *, const posit32_t *, const posit32_t *, size_t, posit32_t *, posit32_t * );
+cposit32_t cp32_dotc_n( const posit32_t *, const posit32_t *, const posit32_t *, const posit32_t *, size_t );
+void cp32_abs_n( const posit32_t *, const posit32_t *, size_t, posit32_t * );
+
+//Sorting and searching, NaR sorts before all real values
+void p32_sort_n( posit32_t *, size_t );
+void p32_argsort_n( const posit32_t *, size_t, size_t * );
+size_t p32_topk_n( const posit32_t *, size_t, size_t, posit32_t *, size_t * );
+size_t p32_searchsorted( const posit32_t *, size_t, posit32_t );
+void p32_searchsorted_n( const posit32_t *, size_t, const posit32_t *, size_t, size_t * );
+
+//Array reductions and elementwise kernels on the bit patterns
+posit32_t p32_min_n( const posit32_t *, size_t );
+posit32_t p32_max_n( const posit32_t *, size_t );
+size_t p32_argmin_n( const posit32_t *, size_t );
+size_t p32_argmax_n( const posit32_t *, size_t );
+void p32_clamp_n( const posit32_t *, size_t, posit32_t, posit32_t, posit32_t * );
+void p32_select_n( const uint8_t *, const posit32_t *, const posit32_t *, size_t, posit32_t * );
+void p32_eq_n( const posit32_t *, const posit32_t *, size_t, uint8_t * );
+void p32_le_n( const posit32_t *, const posit32_t *, size_t, uint8_t * );
+void p32_lt_n( const posit32_t *, const posit32_t *, size_t, uint8_t * );
+size_t p32_countNaR_n( const posit32_t *, size_t );
+void p32_abs_n( const posit32_t *, size_t, posit32_t * );
+void p32_neg_n( const posit32_t *, size_t, posit32_t * );
+
+//Elementary functions, correctly rounded or within 1 ulp
+posit32_t p32_exp( posit32_t );
+posit32_t p32_exp2( posit32_t );
+posit32_t p32_log( posit32_t );
+posit32_t p32_log2( posit32_t );
+posit32_t p32_sin( posit32_t );
+posit32_t p32_cos( posit32_t );
+posit32_t p32_tanh( posit32_t );
+posit32_t p32_pow( posit32_t, posit32_t );
+posit32_t p32_atan2( posit32_t, posit32_t );
+void p32_exp_n( const posit32_t *, size_t, posit32_t * );
+void p32_exp2_n( const posit32_t *, size_t, posit32_t * );
+void p32_log_n( const posit32_t *, size_t, posit32_t * );
+void p32_log2_n( const posit32_t *, size_t, posit32_t * );
+void p32_sin_n( const posit32_t *, size_t, posit32_t * );
+void p32_cos_n( const posit32_t *, size_t, posit32_t * );
+void p32_tanh_n( const posit32_t *, size_t, posit32_t * );
+void p32_pow_n( const posit32_t *, const posit32_t *, size_t, posit32_t * );
+void p32_atan2_n( const posit32_t *, const posit32_t *, size_t, posit32_t * );
+
 posit_1_t p32_to_pX1( posit32_t, int);
 posit_2_t p32_to_pX2( posit32_t, int );
 
@@ -382,7 +744,7 @@ static inline quire32_t q32Clr(){
 #define absP32(a)({\
 		union ui32_p32 uA;\
 		uA.p = (a);\
-		int mask = uA.ui >> 31; \
+		int mask = -(uA.ui >> 31); \
 		uA.ui = ((uA.ui + mask) ^ mask)&0xFFFFFFFF; \
 		uA.p; \
 })
@@ -392,6 +754,11 @@ static inline quire32_t q32Clr(){
 double convertP32ToDouble(posit32_t);
 posit32_t convertFloatToP32(float);
 posit32_t convertDoubleToP32(double);
+//Decimal text (no stdio or locale); _n forms read/write delimited lists in chunks
+const char * p32_from_chars( const char *, const char *, posit32_t * );
+char * p32_to_chars( char *, char *, posit32_t );
+size_t p32_from_chars_n( const char *, const char *, posit32_t *, size_t, bool, const char ** );
+size_t p32_to_chars_n( char *, char *, const posit32_t *, size_t, char, char ** );
 
 
 /*----------------------------------------------------------------------------
@@ -435,6 +802,9 @@ static inline posit32_t pX2_to_p32(posit_2_t pA){
 posit_2_t convertDoubleToPX2(double, int);
 
 double convertPX2ToDouble(posit_2_t);
+//Decimal text (no stdio or locale)
+const char * pX2_from_chars( const char *, const char *, posit_2_t *, int );
+char * pX2_to_chars( char *, char *, posit_2_t, int );
 
 #ifdef SOFTPOSIT_QUAD
 	__float128 convertPX2ToQuad(posit_2_t);
@@ -505,7 +875,7 @@ static inline quire_2_t qX2Clr(){
 #define absPX2(a)({\
 		union ui32_pX2 uA;\
 		uA.p = (a);\
-		int  mask = uA.ui >> 31; \
+		int  mask = -(uA.ui >> 31); \
 		uA.ui = ((uA.ui + mask) ^ mask)&0xFFFFFFFF; \
 		uA.p; \
 })
@@ -618,37 +988,268 @@ static inline quire_1_t qX1Clr(){
 #define absPX1(a)({\
 		union ui32_pX1 uA;\
 		uA.p = (a);\
-		int mask = uA.ui >> 31; \
+		int mask = -(uA.ui >> 31); \
+		uA.ui = ((uA.ui + mask) ^ mask)&0xFFFFFFFF;\
+		uA.p; \
+})
+/*----------------------------------------------------------------------------
+| Dyanamic 2 to 32-bit Posits for es = 0
+*----------------------------------------------------------------------------*/
+
+posit_0_t pX0_add( posit_0_t, posit_0_t, int);
+posit_0_t pX0_sub( posit_0_t, posit_0_t, int);
+posit_0_t pX0_mul( posit_0_t, posit_0_t, int);
+posit_0_t pX0_div( posit_0_t, posit_0_t, int);
+posit_0_t pX0_mulAdd( posit_0_t, posit_0_t, posit_0_t, int);
+posit_0_t pX0_roundToInt( posit_0_t, int );
+posit_0_t ui32_to_pX0( uint32_t, int );
+posit_0_t ui64_to_pX0( uint64_t, int );
+posit_0_t i32_to_pX0( int32_t, int );
+posit_0_t i64_to_pX0( int64_t, int );
+posit_0_t pX0_sqrt( posit_0_t, int );
+
+uint_fast32_t pX0_to_ui32( posit_0_t );
+uint_fast64_t pX0_to_ui64( posit_0_t );
+int_fast32_t pX0_to_i32( posit_0_t );
+int_fast64_t pX0_to_i64( posit_0_t );
+int64_t pX0_int( posit_0_t );
+
+bool pX0_eq( posit_0_t, posit_0_t);
+bool pX0_le( posit_0_t, posit_0_t);
+bool pX0_lt( posit_0_t, posit_0_t);
+
+posit8_t pX0_to_p8( posit_0_t );
+posit16_t pX0_to_p16( posit_0_t );
+posit32_t pX0_to_p32( posit_0_t );
+posit_0_t pX0_to_pX0( posit_0_t, int);
+posit_1_t pX0_to_pX1( posit_0_t, int);
+posit_2_t pX0_to_pX2( posit_0_t, int);
+posit_0_t p8_to_pX0( posit8_t, int );
+posit_0_t p16_to_pX0( posit16_t, int );
+posit_0_t p32_to_pX0( posit32_t, int );
+posit_0_t pX1_to_pX0( posit_1_t, int );
+posit_0_t pX2_to_pX0( posit_2_t, int );
+
+//Batch width conversions, bit-exact with the scalar ones; pX targets take the width x
+void p8_to_p16_n( const posit8_t *, size_t, posit16_t * );
+void p8_to_p32_n( const posit8_t *, size_t, posit32_t * );
+void p8_to_pX0_n( const posit8_t *, size_t, posit_0_t *, int );
+void p8_to_pX1_n( const posit8_t *, size_t, posit_1_t *, int );
+void p8_to_pX2_n( const posit8_t *, size_t, posit_2_t *, int );
+void p16_to_p8_n( const posit16_t *, size_t, posit8_t * );
+void p16_to_p32_n( const posit16_t *, size_t, posit32_t * );
+void p16_to_pX0_n( const posit16_t *, size_t, posit_0_t *, int );
+void p16_to_pX1_n( const posit16_t *, size_t, posit_1_t *, int );
+void p16_to_pX2_n( const posit16_t *, size_t, posit_2_t *, int );
+void p32_to_p8_n( const posit32_t *, size_t, posit8_t * );
+void p32_to_p16_n( const posit32_t *, size_t, posit16_t * );
+void p32_to_pX0_n( const posit32_t *, size_t, posit_0_t *, int );
+void p32_to_pX1_n( const posit32_t *, size_t, posit_1_t *, int );
+void p32_to_pX2_n( const posit32_t *, size_t, posit_2_t *, int );
+void pX0_to_p8_n( const posit_0_t *, size_t, posit8_t * );
+void pX0_to_p16_n( const posit_0_t *, size_t, posit16_t * );
+void pX0_to_p32_n( const posit_0_t *, size_t, posit32_t * );
+void pX0_to_pX0_n( const posit_0_t *, size_t, posit_0_t *, int );
+void pX0_to_pX1_n( const posit_0_t *, size_t, posit_1_t *, int );
+void pX0_to_pX2_n( const posit_0_t *, size_t, posit_2_t *, int );
+void pX1_to_p8_n( const posit_1_t *, size_t, posit8_t * );
+void pX1_to_p16_n( const posit_1_t *, size_t, posit16_t * );
+void pX1_to_p32_n( const posit_1_t *, size_t, posit32_t * );
+void pX1_to_pX0_n( const posit_1_t *, size_t, posit_0_t *, int );
+void pX1_to_pX1_n( const posit_1_t *, size_t, posit_1_t *, int );
+void pX1_to_pX2_n( const posit_1_t *, size_t, posit_2_t *, int );
+void pX2_to_p8_n( const posit_2_t *, size_t, posit8_t * );
+void pX2_to_p16_n( const posit_2_t *, size_t, posit16_t * );
+void pX2_to_p32_n( const posit_2_t *, size_t, posit32_t * );
+void pX2_to_pX0_n( const posit_2_t *, size_t, posit_0_t *, int );
+void pX2_to_pX1_n( const posit_2_t *, size_t, posit_1_t *, int );
+void pX2_to_pX2_n( const posit_2_t *, size_t, posit_2_t *, int );
+
+//Bit-manipulation approximation of sigmoid
+posit_0_t pX0_sigmoidFast( posit_0_t, int );
+
+#define isNaRpX0UI( a ) ( ((a) ^ 0x80000000) == 0 )
+
+//Helper
+posit_0_t convertDoubleToPX0(double, int);
+double convertPX0ToDouble(posit_0_t);
+
+//Batch kernels
+void pX0_add_n( const posit_0_t *, const posit_0_t *, size_t, posit_0_t *, int );
+void pX0_sub_n( const posit_0_t *, const posit_0_t *, size_t, posit_0_t *, int );
+void pX0_mul_n( const posit_0_t *, const posit_0_t *, size_t, posit_0_t *, int );
+void pX0_div_n( const posit_0_t *, const posit_0_t *, size_t, posit_0_t *, int );
+void pX0_mulAdd_n( const posit_0_t *, const posit_0_t *, const posit_0_t *, size_t, posit_0_t *, int );
+void pX0_sqrt_n( const posit_0_t *, size_t, posit_0_t *, int );
+void pX0_sigmoidFast_n( const posit_0_t *, size_t, posit_0_t *, int );
+void convertDoubleToPX0_n( const double *, size_t, posit_0_t *, int );
+void convertPX0ToDouble_n( const posit_0_t *, size_t, double * );
+//Dot product through the quire, rounded once
+posit_0_t pX0_dot_n( const posit_0_t *, const posit_0_t *, size_t, int );
+
+quire_0_t qX0_fdp_add( quire_0_t q, posit_0_t pA, posit_0_t );
+quire_0_t qX0_fdp_sub( quire_0_t q, posit_0_t pA, posit_0_t );
+quire_0_t qX0_fdp_add_n( quire_0_t q, const posit_0_t *, const posit_0_t *, size_t );
+posit_0_t qX0_to_pX0(quire_0_t, int);
+#define isNaRqX0( q ) ( q.v[0]==0x8000000000000000ULL && q.v[1]==0 && q.v[2]==0 && q.v[3]==0 && q.v[4]==0 && q.v[5]==0 && q.v[6]==0 && q.v[7]==0)
+#define isqX0Zero(q) (q.v[0]==0 && q.v[1]==0 && q.v[2]==0 && q.v[3]==0 && q.v[4]==0 && q.v[5]==0 && q.v[6]==0 && q.v[7]==0)
+quire_0_t qX0_TwosComplement(quire_0_t);
+
+#define qX0_clr(q) ({\
+	q.v[0]=0;\
+	q.v[1]=0;\
+	q.v[2]=0;\
+	q.v[3]=0;\
+	q.v[4]=0;\
+	q.v[5]=0;\
+	q.v[6]=0;\
+	q.v[7]=0;\
+	q;\
+})
+
+static inline quire_0_t qX0Clr(){
+	quire_0_t q;
+	q.v[0]=0;
+	q.v[1]=0;
+	q.v[2]=0;
+	q.v[3]=0;
+	q.v[4]=0;
+	q.v[5]=0;
+	q.v[6]=0;
+	q.v[7]=0;
+	return q;
+}
+
+#define castqX0(l0, l1, l2, l3, l4, l5, l6, l7)({\
+		union ui512_qX0 uA;\
+		uA.ui[0] = l0; \
+		uA.ui[1] = l1; \
+		uA.ui[2] = l2; \
+		uA.ui[3] = l3; \
+		uA.ui[4] = l4; \
+		uA.ui[5] = l5; \
+		uA.ui[6] = l6; \
+		uA.ui[7] = l7; \
+		uA.q;\
+})
+
+
+#define castpX0(a)({\
+	posit_0_t pA = {.v = (a)};\
+	pA; \
+})
+
+
+
+#define negpX0(a)({\
+		union ui32_pX0 uA;\
+		uA.p = (a);\
+		uA.ui = -uA.ui&0xFFFFFFFF;\
+		uA.p; \
+})
+
+#define absPX0(a)({\
+		union ui32_pX0 uA;\
+		uA.p = (a);\
+		int mask = -(uA.ui >> 31); \
 		uA.ui = ((uA.ui + mask) ^ mask)&0xFFFFFFFF;\
 		uA.p; \
 })
 /*----------------------------------------------------------------------------
 | 64-bit (double-precision) floating-point operations.
 *----------------------------------------------------------------------------*/
-//uint_fast32_t p64_to_ui32( posit64_t, uint_fast16_t, bool );
+uint_fast32_t p64_to_ui32( posit64_t );
 uint_fast64_t p64_to_ui64( posit64_t );
-//int_fast32_t p64_to_i32( posit64_t, uint_fast16_t, bool );
+int_fast32_t p64_to_i32( posit64_t );
 int_fast64_t p64_to_i64( posit64_t );
 
-/*posit8_t p64_to_p8( posit64_t );
+posit8_t p64_to_p8( posit64_t );
 posit16_t p64_to_p16( posit64_t );
-posit32_t p64_to_p32( posit64_t );*/
+posit32_t p64_to_p32( posit64_t );
+posit_0_t p64_to_pX0( posit64_t, int );
+posit_1_t p64_to_pX1( posit64_t, int );
+posit_2_t p64_to_pX2( posit64_t, int );
+posit64_t pX0_to_p64( posit_0_t );
+posit64_t pX1_to_p64( posit_1_t );
+posit64_t pX2_to_p64( posit_2_t );
+
+//Batch conversions to and from posit64
+void p64_to_p8_n( const posit64_t *, size_t, posit8_t * );
+void p64_to_p16_n( const posit64_t *, size_t, posit16_t * );
+void p64_to_p32_n( const posit64_t *, size_t, posit32_t * );
+void p8_to_p64_n( const posit8_t *, size_t, posit64_t * );
+void p16_to_p64_n( const posit16_t *, size_t, posit64_t * );
+void p32_to_p64_n( const posit32_t *, size_t, posit64_t * );
+void ui32_to_p64_n( const uint32_t *, size_t, posit64_t * );
+void ui64_to_p64_n( const uint64_t *, size_t, posit64_t * );
+void i32_to_p64_n( const int32_t *, size_t, posit64_t * );
+void p64_to_ui32_n( const posit64_t *, size_t, uint32_t * );
+void p64_to_ui64_n( const posit64_t *, size_t, uint64_t * );
+void p64_to_i32_n( const posit64_t *, size_t, int32_t * );
+void p64_to_i64_n( const posit64_t *, size_t, int64_t * );
 
 double convertP64ToDouble( posit64_t );
 posit64_t convertDoubleToP64(double);
+//Decimal text (no stdio or locale); _n forms read/write delimited lists in chunks
+const char * p64_from_chars( const char *, const char *, posit64_t * );
+char * p64_to_chars( char *, char *, posit64_t );
+size_t p64_from_chars_n( const char *, const char *, posit64_t *, size_t, bool, const char ** );
+size_t p64_to_chars_n( char *, char *, const posit64_t *, size_t, char, char ** );
 
 posit64_t p64_roundToInt( posit64_t );
+int64_t p64_int( posit64_t );
 posit64_t p64_add( posit64_t, posit64_t );
 posit64_t p64_sub( posit64_t, posit64_t );
 posit64_t p64_mul( posit64_t, posit64_t );
 posit64_t p64_mulAdd( posit64_t, posit64_t, posit64_t );
 posit64_t p64_div( posit64_t, posit64_t );
 //posit64_t p64_rem( posit64_t, posit64_t );
-//posit64_t p64_sqrt( posit64_t );
+posit64_t p64_sqrt( posit64_t );
 bool p64_eq( posit64_t, posit64_t );
 bool p64_le( posit64_t, posit64_t );
 bool p64_lt( posit64_t, posit64_t );
 
+//Sorting and searching, NaR sorts before all real values
+void p64_sort_n( posit64_t *, size_t );
+void p64_argsort_n( const posit64_t *, size_t, size_t * );
+size_t p64_topk_n( const posit64_t *, size_t, size_t, posit64_t *, size_t * );
+size_t p64_searchsorted( const posit64_t *, size_t, posit64_t );
+void p64_searchsorted_n( const posit64_t *, size_t, const posit64_t *, size_t, size_t * );
+
+//Array reductions and elementwise kernels on the bit patterns
+posit64_t p64_min_n( const posit64_t *, size_t );
+posit64_t p64_max_n( const posit64_t *, size_t );
+size_t p64_argmin_n( const posit64_t *, size_t );
+size_t p64_argmax_n( const posit64_t *, size_t );
+void p64_clamp_n( const posit64_t *, size_t, posit64_t, posit64_t, posit64_t * );
+void p64_select_n( const uint8_t *, const posit64_t *, const posit64_t *, size_t, posit64_t * );
+void p64_eq_n( const posit64_t *, const posit64_t *, size_t, uint8_t * );
+void p64_le_n( const posit64_t *, const posit64_t *, size_t, uint8_t * );
+void p64_lt_n( const posit64_t *, const posit64_t *, size_t, uint8_t * );
+size_t p64_countNaR_n( const posit64_t *, size_t );
+void p64_abs_n( const posit64_t *, size_t, posit64_t * );
+void p64_neg_n( const posit64_t *, size_t, posit64_t * );
+
+//Elementary functions, correctly rounded or within 1 ulp
+posit64_t p64_exp( posit64_t );
+posit64_t p64_exp2( posit64_t );
+posit64_t p64_log( posit64_t );
+posit64_t p64_log2( posit64_t );
+posit64_t p64_sin( posit64_t );
+posit64_t p64_cos( posit64_t );
+posit64_t p64_tanh( posit64_t );
+posit64_t p64_pow( posit64_t, posit64_t );
+posit64_t p64_atan2( posit64_t, posit64_t );
+void p64_exp_n( const posit64_t *, size_t, posit64_t * );
+void p64_exp2_n( const posit64_t *, size_t, posit64_t * );
+void p64_log_n( const posit64_t *, size_t, posit64_t * );
+void p64_log2_n( const posit64_t *, size_t, posit64_t * );
+void p64_sin_n( const posit64_t *, size_t, posit64_t * );
+void p64_cos_n( const posit64_t *, size_t, posit64_t * );
+void p64_tanh_n( const posit64_t *, size_t, posit64_t * );
+void p64_pow_n( const posit64_t *, const posit64_t *, size_t, posit64_t * );
+void p64_atan2_n( const posit64_t *, const posit64_t *, size_t, posit64_t * );
+
 
 #define isNaRP64UI( a ) ( ((a) ^ 0x8000000000000000) == 0 )
 
@@ -667,11 +1268,184 @@ bool p64_lt( posit64_t, posit64_t );
 #define absP64(a)({\
 		union ui64_p64 uA;\
 		uA.p = (a);\
-		int mask = uA.ui >> 63; \
+		int mask = -(uA.ui >> 63); \
 		uA.ui = ((uA.ui + mask) ^ mask)&0xFFFFFFFFFFFFFFFF; \
 		uA.p; \
 })
 
+//1024-bit quire for posit64, binary point 496 bits from the right
+quire64_t q64_fdp_add( quire64_t, posit64_t, posit64_t );
+quire64_t q64_fdp_sub( quire64_t, posit64_t, posit64_t );
+posit64_t q64_to_p64( quire64_t );
+quire64_t q64_TwosComplement( quire64_t );
+
+static inline quire64_t q64Clr(){
+	quire64_t q;
+	int i;
+	for (i=0; i<16; i++) q.v[i] = 0;
+	return q;
+}
+
+static inline bool isQ64Zero( quire64_t q ){
+	uint64_t any = 0;
+	int i;
+	for (i=0; i<16; i++) any |= q.v[i];
+	return !any;
+}
+
+static inline bool isNaRQ64( quire64_t q ){
+	bool nar = q.v[0]==0x8000000000000000ULL;
+	int i;
+	for (i=1; i<16; i++) nar &= !q.v[i];
+	return nar;
+}
+
+/*----------------------------------------------------------------------------
+| Memory-mapped posit tensor files (format described in c_positTensorFile.c).
+| Functions returning int give 0 on success and -1 with errno set on failure.
+*----------------------------------------------------------------------------*/
+#define SOFTPOSIT_TENSOR_MAXRANK 8
+
+typedef struct {
+	uint8_t nbits, es, wordBytes, bigEndian, rank;
+	uint64_t shape[SOFTPOSIT_TENSOR_MAXRANK];
+	int64_t strides[SOFTPOSIT_TENSOR_MAXRANK];    //in words
+	uint64_t count;                               //words in the payload
+	const void * data;
+	uint64_t quireCount;
+	uint32_t quireBytes;
+	const void * quires;
+	void * map;
+	size_t mapBytes;
+} positTensor_t;
+
+typedef struct {
+	int fd;
+	uint8_t nbits, es, wordBytes, rank;
+	uint32_t quireBytes;
+	uint64_t shape[SOFTPOSIT_TENSOR_MAXRANK];
+	int64_t strides[SOFTPOSIT_TENSOR_MAXRANK];
+	uint64_t words, written, quiresWritten;
+} positTensorWriter_t;
+
+int positTensor_open( positTensor_t *, const char * );
+void positTensor_close( positTensor_t * );
+const posit8_t * positTensor_p8( const positTensor_t * );
+const posit16_t * positTensor_p16( const positTensor_t * );
+const posit32_t * positTensor_p32( const positTensor_t * );
+const posit64_t * positTensor_p64( const positTensor_t * );
+const posit_2_t * positTensor_pX2( const positTensor_t *, int );
+const quire8_t * positTensor_q8( const positTensor_t * );
+const quire16_t * positTensor_q16( const positTensor_t * );
+const quire32_t * positTensor_q32( const positTensor_t * );
+
+int positTensorWriter_open( positTensorWriter_t *, const char *, int nbits, int es,
+		int rank, const uint64_t * shape, const int64_t * strides, uint32_t quireBytes );
+int positTensorWriter_write( positTensorWriter_t *, const void *, size_t );
+int positTensorWriter_writeQuires( positTensorWriter_t *, const void *, size_t );
+int positTensorWriter_close( positTensorWriter_t * );
+void positTensorWriter_abort( positTensorWriter_t * );
+
+/*----------------------------------------------------------------------------
+| NumPy .npy files.  Posit arrays are stored as unsigned integers of their
+| width and mapped without copying; float32/float64 payloads convert into
+| caller-provided arrays of count elements.
+*----------------------------------------------------------------------------*/
+typedef struct {
+	char kind;                                    //dtype kind: 'u', 'i', 'f', ...
+	uint8_t itemBytes, fortranOrder, rank;
+	uint64_t shape[SOFTPOSIT_TENSOR_MAXRANK];
+	uint64_t count;
+	const void * data;
+	void * map;
+	size_t mapBytes;
+} positNpy_t;
+
+int positNpy_open( positNpy_t *, const char * );
+void positNpy_close( positNpy_t * );
+const posit8_t * positNpy_p8( const positNpy_t * );
+const posit16_t * positNpy_p16( const positNpy_t * );
+const posit32_t * positNpy_p32( const positNpy_t * );
+const posit64_t * positNpy_p64( const positNpy_t * );
+int positNpy_toP8( const positNpy_t *, posit8_t * );
+int positNpy_toP16( const positNpy_t *, posit16_t * );
+int positNpy_toP32( const positNpy_t *, posit32_t * );
+int positNpy_toP64( const positNpy_t *, posit64_t * );
+int positNpy_write( const char *, const void *, int itemBytes, int rank, const uint64_t * shape );
+
+/*----------------------------------------------------------------------------
+| Operation counters and rounding statistics.  When the library is built
+| with SOFTPOSIT_STATS, the scalar add/sub/mul/div/mulAdd/sqrt of posit8,
+| posit16, posit32 and posit64 and the shared dynamic-width core (pX) count
+| into thread-local counters, which softposit_statsGet sums over all
+| threads, past and present.  pX is a single aggregate bucket, not split by
+| width or es: every dynamic width from 2 to 32 bits counts into it, and so
+| does rounding in the conversions and array kernels that share its
+| round-pack step.  Rounding is counted per round-to-nearest step on the
+| magnitude: up, down, or exact when its round and sticky bits are clear.
+| Without SOFTPOSIT_STATS nothing is recorded and softposit_statsGet reports
+| zeros.  Reset only while no other thread is running posit operations.
+*----------------------------------------------------------------------------*/
+enum {
+	softposit_stat_add, softposit_stat_sub, softposit_stat_mul,
+	softposit_stat_div, softposit_stat_mulAdd, softposit_stat_sqrt,
+	softposit_stat_nOps
+};
+enum {
+	softposit_stat_p8, softposit_stat_p16, softposit_stat_p32, softposit_stat_p64,
+	softposit_stat_pX,
+	softposit_stat_nWidths
+};
+
+typedef struct {
+	uint64_t calls[softposit_stat_nOps][softposit_stat_nWidths];
+	uint64_t nar[softposit_stat_nWidths];         //NaR results
+	uint64_t maxpos[softposit_stat_nWidths];      //regime overflow clamped to maxpos
+	uint64_t minpos[softposit_stat_nWidths];      //regime underflow clamped to minpos
+	uint64_t roundUp[softposit_stat_nWidths];
+	uint64_t roundDown[softposit_stat_nWidths];
+	uint64_t exact[softposit_stat_nWidths];
+} softposit_stats_t;
+
+void softposit_statsGet( softposit_stats_t * );
+void softposit_statsReset( void );
+void softposit_statsPrint( FILE *, const softposit_stats_t * );
+
+/*----------------------------------------------------------------------------
+| Dynamic-range profiles.  The _n scans add posit or float arrays into a
+| profile: histograms of scale, of fraction bits up to the last one bit and,
+| for posit data, of regime length in the data's own format.  Floats are
+| profiled exactly, as they would convert with enough precision; NaN and
+| infinities count as NaR.  positProfile_recommend finds the narrowest
+| width (2 to 32 bits with es 0 to 2, then posit64) in which at least
+| coverage of the nonzero values round with relative error at most
+| maxRelErr, judging each scale by its widest fraction; it returns -1 if
+| none qualifies.
+*----------------------------------------------------------------------------*/
+#define SOFTPOSIT_PROFILE_SCALEBIAS 1088
+#define SOFTPOSIT_PROFILE_NSCALES 2176
+
+typedef struct {
+	uint64_t count, zeros, nars;
+	uint64_t regime[65];                                //regime bits, terminator included
+	uint64_t fracBits[65];
+	uint64_t scale[SOFTPOSIT_PROFILE_NSCALES];          //index scale+SOFTPOSIT_PROFILE_SCALEBIAS
+	uint8_t scaleFracBits[SOFTPOSIT_PROFILE_NSCALES];   //widest fraction seen at each scale
+} positProfile_t;
+
+void positProfile_init( positProfile_t * );
+void positProfile_merge( positProfile_t *, const positProfile_t * );
+void positProfile_p8_n( const posit8_t *, size_t, positProfile_t *, int nThreads );
+void positProfile_p16_n( const posit16_t *, size_t, positProfile_t *, int nThreads );
+void positProfile_p32_n( const posit32_t *, size_t, positProfile_t *, int nThreads );
+void positProfile_p64_n( const posit64_t *, size_t, positProfile_t *, int nThreads );
+void positProfile_pX0_n( const posit_0_t *, size_t, positProfile_t *, int nThreads, int x );
+void positProfile_pX1_n( const posit_1_t *, size_t, positProfile_t *, int nThreads, int x );
+void positProfile_pX2_n( const posit_2_t *, size_t, positProfile_t *, int nThreads, int x );
+void positProfile_float_n( const float *, size_t, positProfile_t *, int nThreads );
+void positProfile_double_n( const double *, size_t, positProfile_t *, int nThreads );
+int positProfile_recommend( const positProfile_t *, double maxRelErr, double coverage, int * nbits, int * es );
+
 #ifdef __cplusplus
 }
 #endif
@@ -25,179 +25,573 @@ SOFTWARE.
 #ifndef INCLUDE_SOFTPOSIT_CPP_H_
 #define INCLUDE_SOFTPOSIT_CPP_H_
 
+#include <algorithm>
+#include <complex>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
 #include <iostream>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include "softposit.h"
 #include "math.h"
 //#include "positMath.h"
 
 #ifdef __cplusplus
 
+/*----------------------------------------------------------------------------
+| Constant evaluation.  From C++14 on, and where the compiler can tell a
+| constant evaluation from a run-time call (std::is_constant_evaluated or
+| __builtin_is_constant_evaluated), the posit types below are literal types
+| whose constructors, conversions, arithmetic and comparisons are constexpr,
+| so that tables such as { posit32(0.1), posit32(0.2) } are rounded by the
+| compiler.  At run time every operation still calls the library; only a
+| constant evaluation takes the softposit_cx* path, which decodes operands
+| to sign, scale and significand, sums exactly in a quire32-layout image
+| and rounds like softposit_roundPackMagPX, so both give the same bits
+| (posit_2 is rounded correctly, as posit32 is, at every width x).
+| Elsewhere SOFTPOSIT_CONSTEXPR is empty and nothing changes.
+*----------------------------------------------------------------------------*/
+#if defined(__cpp_lib_is_constant_evaluated)
+#define SOFTPOSIT_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define SOFTPOSIT_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#elif defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9
+#define SOFTPOSIT_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+
+#if defined(SOFTPOSIT_CONSTANT_EVALUATED) && __cplusplus >= 201402L
+#define SOFTPOSIT_CONSTEXPR constexpr
+#else
+#undef SOFTPOSIT_CONSTANT_EVALUATED
+#define SOFTPOSIT_CONSTANT_EVALUATED() false
+#define SOFTPOSIT_CONSTEXPR
+#endif
+
+//Nonzero, non-NaR posit of nbits<=32 held right-aligned; hidden bit at 63
+struct softposit_cxUnpacked{
+	bool sign;
+	int scale;
+	uint64_t sig;
+};
+
+SOFTPOSIT_CONSTEXPR softposit_cxUnpacked softposit_cxUnpack( uint32_t uiA, int nbits, int es ){
+	softposit_cxUnpacked u = { false, 0, 0 };
+	uint64_t tmp = (uint64_t) uiA << (64-nbits);
+	bool regSA = false;
+	int run = 0, kA = 0;
+
+	u.sign = tmp>>63;
+	if (u.sign) tmp = -tmp;
+	tmp <<= 1;
+	regSA = tmp>>63;
+	run = __builtin_clzll(regSA ? ~tmp : tmp);
+	kA = regSA ? run-1 : -run;
+	tmp = (tmp<<run)<<1;
+	u.sig = 0x8000000000000000ULL | ((tmp<<es)>>1);
+	u.scale = kA*(1<<es) + (int) (es ? tmp>>(64-es) : 0);
+	return u;
+}
+
+//Rounds to nearest even, saturating to maxpos and minpos
+SOFTPOSIT_CONSTEXPR uint32_t softposit_cxRoundPack(
+	bool sign, int scale, uint64_t sig, bool sticky, int nbits, int es ){
+
+	int kA = scale>>es, regA = 0;
+	uint64_t expA = scale & ((1<<es)-1);
+	uint32_t uiZ = 0;
+	unsigned __int128 body = 0;
+	bool bitNPlusOne = false;
+
+	if (kA>=nbits-2){
+		uiZ = (1UL<<(nbits-1)) - 1;
+	}
+	else if (kA<-(nbits-2)){
+		uiZ = 1;
+	}
+	else{
+		if (kA>=0){
+			regA = kA+2;
+			body = (unsigned __int128) (((1ULL<<(kA+1))-1)<<1) << (128-regA);
+		}
+		else{
+			regA = 1-kA;
+			body = (unsigned __int128) 1 << (128-regA);
+		}
+		body |= (unsigned __int128) expA << (128-regA-es);
+		body |= (unsigned __int128) (sig & 0x7FFFFFFFFFFFFFFFULL) << (65-regA-es);
+
+		uiZ = (uint32_t) (body >> (129-nbits));
+		bitNPlusOne = (body >> (128-nbits)) & 1;
+		sticky |= (body << nbits) != 0;
+		uiZ += bitNPlusOne & (sticky | (uiZ&1));
+	}
+	return sign ? -uiZ & (0xFFFFFFFF >> (32-nbits)) : uiZ;
+}
+
+//512 bits laid out as quire32_t: v[7] least significant, 1.0 at bit 240
+struct softposit_cxQuire{
+	uint64_t v[8];
+
+	SOFTPOSIT_CONSTEXPR softposit_cxQuire() : v() {
+	}
+
+	SOFTPOSIT_CONSTEXPR bool isNaR() const{
+		return v[0]==0x8000000000000000ULL && !(v[1] | v[2] | v[3] | v[4] | v[5] | v[6] | v[7]);
+	}
+
+	SOFTPOSIT_CONSTEXPR void toNaR(){
+		for (int i=1; i<8; i++) v[i] = 0;
+		v[0] = 0x8000000000000000ULL;
+	}
+
+	//Two's complement addition or subtraction of a whole quire image
+	SOFTPOSIT_CONSTEXPR void add( const uint64_t (&w)[8], bool negate ){
+		uint64_t carry = negate;
+
+		for (int j=7; j>=0; j--){
+			uint64_t term = negate ? ~w[j] : w[j];
+			uint64_t sum = v[j] + term;
+			uint64_t next = sum < v[j];
+			v[j] = sum + carry;
+			carry = next | (v[j] < sum);
+		}
+	}
+
+	//Adds or subtracts mag * 2^(pos-240)
+	SOFTPOSIT_CONSTEXPR void add( uint64_t mag, int pos, bool negate ){
+		uint64_t w[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+		int i = 7 - (pos>>6), b = pos & 63;
+
+		w[i] = mag << b;
+		if (b && i>0) w[i-1] = mag >> (64-b);
+		add( w, negate );
+	}
+
+	//q += a*b or q -= a*b for posits of nbits<=32 held right-aligned
+	SOFTPOSIT_CONSTEXPR void fdp( uint32_t uiA, uint32_t uiB, int nbits, int es, bool negate ){
+		uint32_t nar = 1UL<<(nbits-1);
+		softposit_cxUnpacked a = { false, 0, 0 }, b = { false, 0, 0 };
+		uint64_t prod = 0;
+		int pos = 0;
+
+		if (isNaR()) return;
+		if (uiA==nar || uiB==nar){
+			toNaR();
+			return;
+		}
+		if (uiA==0 || uiB==0) return;
+		a = softposit_cxUnpack( uiA, nbits, es );
+		b = softposit_cxUnpack( uiB, nbits, es );
+		//At most 28 significant bits each, so the product is exact in 58
+		prod = (a.sig>>35) * (b.sig>>35);
+		pos = a.scale + b.scale - 56 + 240;
+		if (pos<0){
+			prod >>= -pos;
+			pos = 0;
+		}
+		add( prod, pos, a.sign ^ b.sign ^ negate );
+	}
+
+	SOFTPOSIT_CONSTEXPR uint32_t toPosit( int nbits, int es ) const{
+		uint64_t m[8] = { v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7] };
+		uint64_t carry = 1, sig = 0;
+		bool sign = v[0]>>63, sticky = false;
+		int i = 0, lz = 0;
+
+		if (isNaR()) return 1UL<<(nbits-1);
+		if (sign){
+			for (int j=7; j>=0; j--){
+				m[j] = ~m[j] + carry;
+				carry = carry && !m[j];
+			}
+		}
+		while (i<8 && !m[i]) i++;
+		if (i==8) return 0;
+		lz = __builtin_clzll(m[i]);
+		sig = m[i]<<lz;
+		if (i<7){
+			if (lz) sig |= m[i+1]>>(64-lz);
+			sticky = (m[i+1]<<lz) != 0;
+			for (int j=i+2; j<8; j++) sticky |= m[j] != 0;
+		}
+		return softposit_cxRoundPack( sign, (7-i)*64 + 63 - lz - 240, sig, sticky, nbits, es );
+	}
+};
+
+SOFTPOSIT_CONSTEXPR uint32_t softposit_cxMulAdd( uint32_t uiA, uint32_t uiB, uint32_t uiC, int nbits, int es ){
+	softposit_cxQuire q;
+	q.fdp( uiA, uiB, nbits, es, false );
+	q.fdp( uiC, 1UL<<(nbits-2), nbits, es, false );
+	return q.toPosit( nbits, es );
+}
+
+SOFTPOSIT_CONSTEXPR uint32_t softposit_cxAdd( uint32_t uiA, uint32_t uiB, int nbits, int es ){
+	return softposit_cxMulAdd( uiA, 1UL<<(nbits-2), uiB, nbits, es );
+}
+
+SOFTPOSIT_CONSTEXPR uint32_t softposit_cxSub( uint32_t uiA, uint32_t uiB, int nbits, int es ){
+	softposit_cxQuire q;
+	q.fdp( uiA, 1UL<<(nbits-2), nbits, es, false );
+	q.fdp( uiB, 1UL<<(nbits-2), nbits, es, true );
+	return q.toPosit( nbits, es );
+}
+
+SOFTPOSIT_CONSTEXPR uint32_t softposit_cxMul( uint32_t uiA, uint32_t uiB, int nbits, int es ){
+	return softposit_cxMulAdd( uiA, uiB, 0, nbits, es );
+}
+
+SOFTPOSIT_CONSTEXPR uint32_t softposit_cxDiv( uint32_t uiA, uint32_t uiB, int nbits, int es ){
+	uint32_t nar = 1UL<<(nbits-1);
+	softposit_cxUnpacked a = { false, 0, 0 }, b = { false, 0, 0 };
+	unsigned __int128 num = 0;
+	uint64_t quot = 0;
+	int scale = 0;
+
+	if (uiA==nar || uiB==nar || uiB==0) return nar;
+	if (uiA==0) return 0;
+	a = softposit_cxUnpack( uiA, nbits, es );
+	b = softposit_cxUnpack( uiB, nbits, es );
+	num = (unsigned __int128) a.sig << 63;
+	quot = (uint64_t) (num / b.sig);
+	scale = a.scale - b.scale;
+	if (!(quot>>63)){
+		quot <<= 1;
+		scale--;
+	}
+	return softposit_cxRoundPack( a.sign ^ b.sign, scale, quot, num % b.sig != 0, nbits, es );
+}
+
+SOFTPOSIT_CONSTEXPR uint32_t softposit_cxSqrt( uint32_t uiA, int nbits, int es ){
+	softposit_cxUnpacked a = { false, 0, 0 };
+	unsigned __int128 rad = 0;
+	uint64_t root = 0;
+	int odd = 0;
+
+	if (uiA>>(nbits-1)) return 1UL<<(nbits-1);
+	if (uiA==0) return 0;
+	a = softposit_cxUnpack( uiA, nbits, es );
+	odd = a.scale & 1;
+	//rad = sig * 2^(63+odd) lies in [2^126, 2^128), so its root has 64 bits
+	rad = (unsigned __int128) a.sig << (63+odd);
+	for (int i=63; i>=0; i--){
+		uint64_t trial = root | (1ULL<<i);
+		if ((unsigned __int128) trial * trial <= rad) root = trial;
+	}
+	return softposit_cxRoundPack( false, (a.scale-odd)/2, root,
+			(unsigned __int128) root * root != rad, nbits, es );
+}
+
+SOFTPOSIT_CONSTEXPR uint32_t softposit_cxFromDouble( double a, int nbits, int es ){
+	int scale = 0;
+	bool sign = a<0;
+
+	if (a==0) return 0;
+	if (a!=a || a>1.7976931348623157e308 || a<-1.7976931348623157e308) return 1UL<<(nbits-1);
+	if (sign) a = -a;
+	while (a>=18446744073709551616.0){
+		a /= 18446744073709551616.0;
+		scale += 64;
+	}
+	while (a<1.0/18446744073709551616.0){
+		a *= 18446744073709551616.0;
+		scale -= 64;
+	}
+	while (a>=2){
+		a /= 2;
+		scale++;
+	}
+	while (a<1){
+		a *= 2;
+		scale--;
+	}
+	return softposit_cxRoundPack( sign, scale, (uint64_t) (a * 9223372036854775808.0), false, nbits, es );
+}
+
+SOFTPOSIT_CONSTEXPR uint32_t softposit_cxFromInt( int64_t a, int nbits, int es ){
+	uint64_t mag = a<0 ? -(uint64_t) a : a;
+	int lz = 0;
+
+	if (a==0) return 0;
+	lz = __builtin_clzll(mag);
+	return softposit_cxRoundPack( a<0, 63-lz, mag<<lz, false, nbits, es );
+}
+
+SOFTPOSIT_CONSTEXPR double softposit_cxToDouble( uint32_t uiA, int nbits, int es ){
+	softposit_cxUnpacked a = { false, 0, 0 };
+	double d = 0;
+
+	if (uiA==0) return 0;
+	if (uiA==1UL<<(nbits-1)) return __builtin_nan("");
+	a = softposit_cxUnpack( uiA, nbits, es );
+	d = (double) a.sig / 9223372036854775808.0;
+	for (; a.scale>0; a.scale--) d *= 2;
+	for (; a.scale<0; a.scale++) d /= 2;
+	return a.sign ? -d : d;
+}
+
+//Per-width entry points: the engine under constant evaluation, the library otherwise
+#define SOFTPOSIT_CX_DISPATCH( w, es ) \
+	SOFTPOSIT_CONSTEXPR uint##w##_t p##w##_cxAdd( uint##w##_t a, uint##w##_t b ){ \
+		return SOFTPOSIT_CONSTANT_EVALUATED() ? softposit_cxAdd( a, b, w, es ) \
+				: castUI(p##w##_add(posit##w##_t{a}, posit##w##_t{b})); \
+	} \
+	SOFTPOSIT_CONSTEXPR uint##w##_t p##w##_cxSub( uint##w##_t a, uint##w##_t b ){ \
+		return SOFTPOSIT_CONSTANT_EVALUATED() ? softposit_cxSub( a, b, w, es ) \
+				: castUI(p##w##_sub(posit##w##_t{a}, posit##w##_t{b})); \
+	} \
+	SOFTPOSIT_CONSTEXPR uint##w##_t p##w##_cxMul( uint##w##_t a, uint##w##_t b ){ \
+		return SOFTPOSIT_CONSTANT_EVALUATED() ? softposit_cxMul( a, b, w, es ) \
+				: castUI(p##w##_mul(posit##w##_t{a}, posit##w##_t{b})); \
+	} \
+	SOFTPOSIT_CONSTEXPR uint##w##_t p##w##_cxDiv( uint##w##_t a, uint##w##_t b ){ \
+		return SOFTPOSIT_CONSTANT_EVALUATED() ? softposit_cxDiv( a, b, w, es ) \
+				: castUI(p##w##_div(posit##w##_t{a}, posit##w##_t{b})); \
+	} \
+	SOFTPOSIT_CONSTEXPR uint##w##_t p##w##_cxMulAdd( uint##w##_t a, uint##w##_t b, uint##w##_t c ){ \
+		return SOFTPOSIT_CONSTANT_EVALUATED() ? softposit_cxMulAdd( a, b, c, w, es ) \
+				: castUI(p##w##_mulAdd(posit##w##_t{a}, posit##w##_t{b}, posit##w##_t{c})); \
+	} \
+	SOFTPOSIT_CONSTEXPR uint##w##_t p##w##_cxSqrt( uint##w##_t a ){ \
+		return SOFTPOSIT_CONSTANT_EVALUATED() ? softposit_cxSqrt( a, w, es ) \
+				: castUI(p##w##_sqrt(posit##w##_t{a})); \
+	} \
+	SOFTPOSIT_CONSTEXPR uint##w##_t p##w##_cxFromDouble( double a ){ \
+		return SOFTPOSIT_CONSTANT_EVALUATED() ? softposit_cxFromDouble( a, w, es ) \
+				: castUI(convertDoubleToP##w(a)); \
+	} \
+	SOFTPOSIT_CONSTEXPR uint##w##_t p##w##_cxFromI32( int32_t a ){ \
+		return SOFTPOSIT_CONSTANT_EVALUATED() ? softposit_cxFromInt( a, w, es ) \
+				: castUI(i32_to_p##w(a)); \
+	} \
+	SOFTPOSIT_CONSTEXPR uint##w##_t p##w##_cxFromI64( int64_t a ){ \
+		return SOFTPOSIT_CONSTANT_EVALUATED() ? softposit_cxFromInt( a, w, es ) \
+				: castUI(i64_to_p##w(a)); \
+	} \
+	SOFTPOSIT_CONSTEXPR double p##w##_cxToDouble( uint##w##_t a ){ \
+		return SOFTPOSIT_CONSTANT_EVALUATED() ? softposit_cxToDouble( a, w, es ) \
+				: convertP##w##ToDouble(posit##w##_t{a}); \
+	}
+
+SOFTPOSIT_CX_DISPATCH( 8, 0 )
+SOFTPOSIT_CX_DISPATCH( 16, 1 )
+SOFTPOSIT_CX_DISPATCH( 32, 2 )
+#undef SOFTPOSIT_CX_DISPATCH
+
+//posit_2 patterns are left-aligned in 32 bits
+SOFTPOSIT_CONSTEXPR uint32_t pX2_cxAdd( uint32_t a, uint32_t b, int x ){
+	return SOFTPOSIT_CONSTANT_EVALUATED() ? softposit_cxAdd( a>>(32-x), b>>(32-x), x, 2 )<<(32-x)
+			: castUI(pX2_add(posit_2_t{a}, posit_2_t{b}, x));
+}
+SOFTPOSIT_CONSTEXPR uint32_t pX2_cxSub( uint32_t a, uint32_t b, int x ){
+	return SOFTPOSIT_CONSTANT_EVALUATED() ? softposit_cxSub( a>>(32-x), b>>(32-x), x, 2 )<<(32-x)
+			: castUI(pX2_sub(posit_2_t{a}, posit_2_t{b}, x));
+}
+SOFTPOSIT_CONSTEXPR uint32_t pX2_cxMul( uint32_t a, uint32_t b, int x ){
+	return SOFTPOSIT_CONSTANT_EVALUATED() ? softposit_cxMul( a>>(32-x), b>>(32-x), x, 2 )<<(32-x)
+			: castUI(pX2_mul(posit_2_t{a}, posit_2_t{b}, x));
+}
+SOFTPOSIT_CONSTEXPR uint32_t pX2_cxDiv( uint32_t a, uint32_t b, int x ){
+	return SOFTPOSIT_CONSTANT_EVALUATED() ? softposit_cxDiv( a>>(32-x), b>>(32-x), x, 2 )<<(32-x)
+			: castUI(pX2_div(posit_2_t{a}, posit_2_t{b}, x));
+}
+SOFTPOSIT_CONSTEXPR uint32_t pX2_cxMulAdd( uint32_t a, uint32_t b, uint32_t c, int x ){
+	return SOFTPOSIT_CONSTANT_EVALUATED() ? softposit_cxMulAdd( a>>(32-x), b>>(32-x), c>>(32-x), x, 2 )<<(32-x)
+			: castUI(pX2_mulAdd(posit_2_t{a}, posit_2_t{b}, posit_2_t{c}, x));
+}
+SOFTPOSIT_CONSTEXPR uint32_t pX2_cxSqrt( uint32_t a, int x ){
+	return SOFTPOSIT_CONSTANT_EVALUATED() ? softposit_cxSqrt( a>>(32-x), x, 2 )<<(32-x)
+			: castUI(pX2_sqrt(posit_2_t{a}, x));
+}
+SOFTPOSIT_CONSTEXPR uint32_t pX2_cxFromDouble( double a, int x ){
+	return SOFTPOSIT_CONSTANT_EVALUATED() ? softposit_cxFromDouble( a, x, 2 )<<(32-x)
+			: castUI(convertDoubleToPX2(a, x));
+}
+SOFTPOSIT_CONSTEXPR uint32_t pX2_cxFromI32( int32_t a, int x ){
+	return SOFTPOSIT_CONSTANT_EVALUATED() ? softposit_cxFromInt( a, x, 2 )<<(32-x)
+			: castUI(i32_to_pX2(a, x));
+}
+SOFTPOSIT_CONSTEXPR uint32_t pX2_cxFromI64( int64_t a, int x ){
+	return SOFTPOSIT_CONSTANT_EVALUATED() ? softposit_cxFromInt( a, x, 2 )<<(32-x)
+			: castUI(i64_to_pX2(a, x));
+}
+SOFTPOSIT_CONSTEXPR double pX2_cxToDouble( uint32_t a, int x ){
+	return SOFTPOSIT_CONSTANT_EVALUATED() ? softposit_cxToDouble( a>>(32-x), x, 2 )
+			: convertPX2ToDouble(posit_2_t{a});
+}
+
 struct posit8{
 	uint8_t value;
 
-	posit8(double x=0) : value(castUI(convertDoubleToP8(x))) {
+	SOFTPOSIT_CONSTEXPR posit8(double x=0) : value(p8_cxFromDouble(x)) {
 	}
 
 	//Equal
-	posit8& operator=(const double a) {
-		value = castUI(convertDoubleToP8(a));
+	SOFTPOSIT_CONSTEXPR posit8& operator=(const double a) {
+		value = p8_cxFromDouble(a);
 		return *this;
 	}
-	posit8& operator=(const int a) {
-		value = castUI(i32_to_p8(a));
+	SOFTPOSIT_CONSTEXPR posit8& operator=(const int a) {
+		value = p8_cxFromI32(a);
 		return *this;
 	}
 
 	//Add
-	posit8 operator+(const posit8 &a) const{
+	SOFTPOSIT_CONSTEXPR posit8 operator+(const posit8 &a) const{
 		posit8 ans;
-		ans.value = castUI(p8_add(castP8(value), castP8(a.value)));
+		ans.value = p8_cxAdd(value, a.value);
 		return ans;
 	}
 
 	//Add equal
-	posit8& operator+=(const posit8 &a) {
-		value = castUI(p8_add(castP8(value), castP8(a.value)));
+	SOFTPOSIT_CONSTEXPR posit8& operator+=(const posit8 &a) {
+		value = p8_cxAdd(value, a.value);
 		return *this;
 	}
 
 	//Subtract
-	posit8 operator-(const posit8 &a) const{
+	SOFTPOSIT_CONSTEXPR posit8 operator-(const posit8 &a) const{
 		posit8 ans;
-		ans.value = castUI(p8_sub(castP8(value), castP8(a.value)));
+		ans.value = p8_cxSub(value, a.value);
 		return ans;
 	}
 
 	//Subtract equal
-	posit8& operator-=(const posit8 &a) {
-		value = castUI(p8_sub(castP8(value), castP8(a.value)));
+	SOFTPOSIT_CONSTEXPR posit8& operator-=(const posit8 &a) {
+		value = p8_cxSub(value, a.value);
 		return *this;
 	}
 
 	//Multiply
-	posit8 operator*(const posit8 &a) const{
+	SOFTPOSIT_CONSTEXPR posit8 operator*(const posit8 &a) const{
 		posit8 ans;
-		ans.value = castUI(p8_mul(castP8(value), castP8(a.value)));
+		ans.value = p8_cxMul(value, a.value);
 		return ans;
 	}
 
 	//Multiply equal
-	posit8& operator*=(const posit8 &a) {
-		value = castUI(p8_mul(castP8(value), castP8(a.value)));
+	SOFTPOSIT_CONSTEXPR posit8& operator*=(const posit8 &a) {
+		value = p8_cxMul(value, a.value);
 		return *this;
 	}
 
 
 	//Divide
-	posit8 operator/(const posit8 &a) const{
+	SOFTPOSIT_CONSTEXPR posit8 operator/(const posit8 &a) const{
 		posit8 ans;
-		ans.value = castUI(p8_div(castP8(value), castP8(a.value)));
+		ans.value = p8_cxDiv(value, a.value);
 		return ans;
 	}
 
 	//Divide equal
-	posit8& operator/=(const posit8 &a) {
-		value = castUI(p8_div(castP8(value), castP8(a.value)));
+	SOFTPOSIT_CONSTEXPR posit8& operator/=(const posit8 &a) {
+		value = p8_cxDiv(value, a.value);
 		return *this;
 	}
 
 	//less than
-	bool operator<(const posit8 &a) const{
-		return p8_lt(castP8(value), castP8(a.value));
+	SOFTPOSIT_CONSTEXPR bool operator<(const posit8 &a) const{
+		return (int8_t) value < (int8_t) a.value;
 	}
 
 	//less than equal
-	bool operator<=(const posit8 &a) const{
-		return p8_le(castP8(value), castP8(a.value));
+	SOFTPOSIT_CONSTEXPR bool operator<=(const posit8 &a) const{
+		return (int8_t) value <= (int8_t) a.value;
 	}
 
 	//equal
-	bool operator==(const posit8 &a) const{
-		return p8_eq(castP8(value), castP8(a.value));
+	SOFTPOSIT_CONSTEXPR bool operator==(const posit8 &a) const{
+		return value == a.value;
 	}
 
 
 	//Not equalCPP
-	bool operator!=(const posit8 &a) const{
-		return !p8_eq(castP8(value), castP8(a.value));
+	SOFTPOSIT_CONSTEXPR bool operator!=(const posit8 &a) const{
+		return value != a.value;
 	}
 
 	//greater than
-	bool operator>(const posit8 &a) const{
-		return p8_lt(castP8(a.value), castP8(value));
+	SOFTPOSIT_CONSTEXPR bool operator>(const posit8 &a) const{
+		return (int8_t) a.value < (int8_t) value;
 	}
 
 	//greater than equal
-	bool operator>=(const posit8 &a) const{
-		return p8_le(castP8(a.value), castP8(value));
+	SOFTPOSIT_CONSTEXPR bool operator>=(const posit8 &a) const{
+		return (int8_t) a.value <= (int8_t) value;
 	}
 
 	//plus plus
-	posit8& operator++() {
-		value = castUI(p8_add(castP8(value), castP8(0x40)));
+	SOFTPOSIT_CONSTEXPR posit8& operator++() {
+		value = p8_cxAdd(value, 0x40);
 		return *this;
 	}
 
 	//minus minus
-	posit8& operator--() {
-		value = castUI(p8_sub(castP8(value), castP8(0x40)));
+	SOFTPOSIT_CONSTEXPR posit8& operator--() {
+		value = p8_cxSub(value, 0x40);
 		return *this;
 	}
 
 	//Binary operators
 
-	posit8 operator>>(const int &x) {
+	SOFTPOSIT_CONSTEXPR posit8 operator>>(const int &x) {
 		posit8 ans;
 		ans.value = value>>x;
 		return ans;
 	}
 
-	posit8& operator>>=(const int &x) {
+	SOFTPOSIT_CONSTEXPR posit8& operator>>=(const int &x) {
 		value = value>>x;
 		return *this;
 	}
 
-	posit8 operator<<(const int &x) {
+	SOFTPOSIT_CONSTEXPR posit8 operator<<(const int &x) {
 		posit8 ans;
 		ans.value = (value<<x)&0xFF;
 		return ans;
 	}
 
-	posit8& operator<<=(const int &x) {
+	SOFTPOSIT_CONSTEXPR posit8& operator<<=(const int &x) {
 		value = (value<<x)&0xFF;
 		return *this;
 	}
 
 
 	//Negate
-	posit8 operator-() const{
+	SOFTPOSIT_CONSTEXPR posit8 operator-() const{
 		posit8 ans;
 		ans.value = -value;
 		return ans;
 	}
 
 	//NOT
-	posit8 operator~() {
+	SOFTPOSIT_CONSTEXPR posit8 operator~() {
 		posit8 ans;
 		ans.value = ~value;
 		return ans;
 	}
 
 	//AND
-	posit8 operator&(const posit8 &a) const{
+	SOFTPOSIT_CONSTEXPR posit8 operator&(const posit8 &a) const{
 		posit8 ans;
 		ans.value = (value & a.value);
 		return *this;
 	}
 
 	//AND equal
-	posit8& operator&=(const posit8 &a) {
+	SOFTPOSIT_CONSTEXPR posit8& operator&=(const posit8 &a) {
 		value = (value & a.value);
 		return *this;
 	}
 
 	//OR
-	posit8 operator|(const posit8 &a) const{
+	SOFTPOSIT_CONSTEXPR posit8 operator|(const posit8 &a) const{
 		posit8 ans;
 		ans.value = (value | a.value);
 		return ans;
@@ -205,46 +599,46 @@ struct posit8{
 
 
 	//OR equal
-	posit8& operator|=(const posit8 &a) {
+	SOFTPOSIT_CONSTEXPR posit8& operator|=(const posit8 &a) {
 		value = (value | a.value);
 		return *this;
 	}
 
 	//XOR
-	posit8 operator^(const posit8 &a) const{
+	SOFTPOSIT_CONSTEXPR posit8 operator^(const posit8 &a) const{
 		posit8 ans;
 		ans.value = (value ^ a.value);
 		return ans;
 	}
 
 	//XOR equal
-	posit8& operator^=(const posit8 &a) {
+	SOFTPOSIT_CONSTEXPR posit8& operator^=(const posit8 &a) {
 		value = (value ^ a.value);
 		return *this;
 	}
 
 	//Logical Operator
 	//!
-	bool operator!()const{
+	SOFTPOSIT_CONSTEXPR bool operator!()const{
 		return !value;
 	}
 
 	//&&
-	bool operator&&(const posit8 &a) const{
+	SOFTPOSIT_CONSTEXPR bool operator&&(const posit8 &a) const{
 		return (value && a.value);
 	}
 
 	//||
-	bool operator||(const posit8 &a) const{
+	SOFTPOSIT_CONSTEXPR bool operator||(const posit8 &a) const{
 		return (value || a.value);
 	}
 
-	bool isNaR(){
+	SOFTPOSIT_CONSTEXPR bool isNaR() const{
 		return isNaRP8UI(value);
 	}
 
-	double toDouble()const{
-		return convertP8ToDouble(castP8(value));
+	SOFTPOSIT_CONSTEXPR double toDouble()const{
+		return p8_cxToDouble(value);
 	}
 
 	long long int toInt()const{
@@ -254,20 +648,20 @@ struct posit8{
 	long long int toRInt()const{
 		return p8_to_i64(castP8(value));
 	}
-	posit8& sqrt(){
-		value = castUI( p8_sqrt(castP8(value)) );
+	SOFTPOSIT_CONSTEXPR posit8& sqrt(){
+		value = p8_cxSqrt(value);
 		return *this;
 	}
 	posit8& rint(){
 		value = castUI( p8_roundToInt(castP8(value)) );
 		return *this;
 	}
-	posit8 fma(posit8 a, posit8 b){ // + (a*b)
+	SOFTPOSIT_CONSTEXPR posit8 fma(posit8 a, posit8 b){ // + (a*b)
 		posit8 ans;
-		ans.value = castUI(p8_mulAdd(castP8(a.value), castP8(b.value), castP8(value)));
+		ans.value = p8_cxMulAdd(a.value, b.value, value);
 		return ans;
 	}
-	posit8& toNaR(){
+	SOFTPOSIT_CONSTEXPR posit8& toNaR(){
 		value = 0x80;
 		return *this;
 	}
@@ -276,168 +670,168 @@ struct posit8{
 
 struct posit16{
 	uint16_t value;
-	posit16(double x=0) : value(castUI(convertDoubleToP16(x))) {
+	SOFTPOSIT_CONSTEXPR posit16(double x=0) : value(p16_cxFromDouble(x)) {
 	}
 
 	//Equal
-	posit16& operator=(const double a) {
-		value = castUI(convertDoubleToP16(a));
+	SOFTPOSIT_CONSTEXPR posit16& operator=(const double a) {
+		value = p16_cxFromDouble(a);
 		return *this;
 	}
-	posit16& operator=(const int a) {
-		value = castUI(i32_to_p16(a));
+	SOFTPOSIT_CONSTEXPR posit16& operator=(const int a) {
+		value = p16_cxFromI32(a);
 		return *this;
 	}
 
 	//Add
-	posit16 operator+(const posit16 &a) const{
+	SOFTPOSIT_CONSTEXPR posit16 operator+(const posit16 &a) const{
 		posit16 ans;
-		ans.value = castUI(p16_add(castP16(value), castP16(a.value)));
+		ans.value = p16_cxAdd(value, a.value);
 		return ans;
 	}
 
 	//Add equal
-	posit16& operator+=(const posit16 &a) {
-		value = castUI(p16_add(castP16(value), castP16(a.value)));
+	SOFTPOSIT_CONSTEXPR posit16& operator+=(const posit16 &a) {
+		value = p16_cxAdd(value, a.value);
 		return *this;
 	}
 
 	//Subtract
-	posit16 operator-(const posit16 &a) const{
+	SOFTPOSIT_CONSTEXPR posit16 operator-(const posit16 &a) const{
 		posit16 ans;
-		ans.value = castUI(p16_sub(castP16(value), castP16(a.value)));
+		ans.value = p16_cxSub(value, a.value);
 		return ans;
 	}
 
 	//Subtract equal
-	posit16& operator-=(const posit16 &a) {
-		value = castUI(p16_sub(castP16(value), castP16(a.value)));
+	SOFTPOSIT_CONSTEXPR posit16& operator-=(const posit16 &a) {
+		value = p16_cxSub(value, a.value);
 		return *this;
 	}
 
 	//Multiply
-	posit16 operator*(const posit16 &a) const{
+	SOFTPOSIT_CONSTEXPR posit16 operator*(const posit16 &a) const{
 		posit16 ans;
-		ans.value = castUI(p16_mul(castP16(value), castP16(a.value)));
+		ans.value = p16_cxMul(value, a.value);
 		return ans;
 	}
 
 	//Multiply equal
-	posit16& operator*=(const posit16 &a) {
-		value = castUI(p16_mul(castP16(value), castP16(a.value)));
+	SOFTPOSIT_CONSTEXPR posit16& operator*=(const posit16 &a) {
+		value = p16_cxMul(value, a.value);
 		return *this;
 	}
 
 
 	//Divide
-	posit16 operator/(const posit16 &a) const{
+	SOFTPOSIT_CONSTEXPR posit16 operator/(const posit16 &a) const{
 		posit16 ans;
-		ans.value = castUI(p16_div(castP16(value), castP16(a.value)));
+		ans.value = p16_cxDiv(value, a.value);
 		return ans;
 	}
 
 	//Divide equal
-	posit16& operator/=(const posit16 &a) {
-		value = castUI(p16_div(castP16(value), castP16(a.value)));
+	SOFTPOSIT_CONSTEXPR posit16& operator/=(const posit16 &a) {
+		value = p16_cxDiv(value, a.value);
 		return *this;
 	}
 
 	//less than
-	bool operator<(const posit16 &a) const{
-		return p16_lt(castP16(value), castP16(a.value));
+	SOFTPOSIT_CONSTEXPR bool operator<(const posit16 &a) const{
+		return (int16_t) value < (int16_t) a.value;
 	}
 
 	//less than equal
-	bool operator<=(const posit16 &a) const{
-		return p16_le(castP16(value), castP16(a.value));
+	SOFTPOSIT_CONSTEXPR bool operator<=(const posit16 &a) const{
+		return (int16_t) value <= (int16_t) a.value;
 	}
 
 	//equal
-	bool operator==(const posit16 &a) const{
-		return p16_eq(castP16(value), castP16(a.value));
+	SOFTPOSIT_CONSTEXPR bool operator==(const posit16 &a) const{
+		return value == a.value;
 	}
 
 
 	//Not equal
-	bool operator!=(const posit16 &a) const{
-		return !p16_eq(castP16(value), castP16(a.value));
+	SOFTPOSIT_CONSTEXPR bool operator!=(const posit16 &a) const{
+		return value != a.value;
 	}
 
 	//greater than
-	bool operator>(const posit16 &a) const{
-		return p16_lt(castP16(a.value), castP16(value));
+	SOFTPOSIT_CONSTEXPR bool operator>(const posit16 &a) const{
+		return (int16_t) a.value < (int16_t) value;
 	}
 
 	//greater than equal
-	bool operator>=(const posit16 &a) const{
-		return p16_le(castP16(a.value), castP16(value));
+	SOFTPOSIT_CONSTEXPR bool operator>=(const posit16 &a) const{
+		return (int16_t) a.value <= (int16_t) value;
 	}
 
 	//plus plus
-	posit16& operator++() {
-		value = castUI(p16_add(castP16(value), castP16(0x4000)));
+	SOFTPOSIT_CONSTEXPR posit16& operator++() {
+		value = p16_cxAdd(value, 0x4000);
 		return *this;
 	}
 
 	//minus minus
-	posit16& operator--() {
-		value = castUI(p16_sub(castP16(value), castP16(0x4000)));
+	SOFTPOSIT_CONSTEXPR posit16& operator--() {
+		value = p16_cxSub(value, 0x4000);
 		return *this;
 	}
 
 	//Binary operators
 
-	posit16 operator>>(const int &x) {
+	SOFTPOSIT_CONSTEXPR posit16 operator>>(const int &x) {
 		posit16 ans;
 		ans.value = value>>x;
 		return ans;
 	}
 
-	posit16& operator>>=(const int &x) {
+	SOFTPOSIT_CONSTEXPR posit16& operator>>=(const int &x) {
 		value = value>>x;
 		return *this;
 	}
 
-	posit16 operator<<(const int &x) {
+	SOFTPOSIT_CONSTEXPR posit16 operator<<(const int &x) {
 		posit16 ans;
 		ans.value = (value<<x)&0xFFFF;
 		return ans;
 	}
 
-	posit16& operator<<=(const int &x) {
+	SOFTPOSIT_CONSTEXPR posit16& operator<<=(const int &x) {
 		value = (value<<x)&0xFFFF;
 		return *this;
 	}
 
 	//Negate
-	posit16 operator-() const{
+	SOFTPOSIT_CONSTEXPR posit16 operator-() const{
 		posit16 ans;
 		ans.value = -value;
 		return ans;
 	}
 
 	//Binary NOT
-	posit16 operator~() {
+	SOFTPOSIT_CONSTEXPR posit16 operator~() {
 		posit16 ans;
 		ans.value = ~value;
 		return ans;
 	}
 
 	//AND
-	posit16 operator&(const posit16 &a) const{
+	SOFTPOSIT_CONSTEXPR posit16 operator&(const posit16 &a) const{
 		posit16 ans;
 		ans.value = (value & a.value);
 		return ans;
 	}
 
 	//AND equal
-	posit16& operator&=(const posit16 &a) {
+	SOFTPOSIT_CONSTEXPR posit16& operator&=(const posit16 &a) {
 		value = (value & a.value);
 		return *this;
 	}
 
 	//OR
-	posit16 operator|(const posit16 &a) const{
+	SOFTPOSIT_CONSTEXPR posit16 operator|(const posit16 &a) const{
 		posit16 ans;
 		ans.value = (value | a.value);
 		return ans;
@@ -445,46 +839,46 @@ struct posit16{
 
 
 	//OR equal
-	posit16& operator|=(const posit16 &a) {
+	SOFTPOSIT_CONSTEXPR posit16& operator|=(const posit16 &a) {
 		value = (value | a.value);
 		return *this;
 	}
 
 	//XOR
-	posit16 operator^(const posit16 &a) const{
+	SOFTPOSIT_CONSTEXPR posit16 operator^(const posit16 &a) const{
 		posit16 ans;
 		ans.value = (value ^ a.value);
 		return ans;
 	}
 
 	//XOR equal
-	posit16& operator^=(const posit16 &a) {
+	SOFTPOSIT_CONSTEXPR posit16& operator^=(const posit16 &a) {
 		value = (value ^ a.value);
 		return *this;
 	}
 
 	//Logical operator
 	//!
-	bool operator!()const{
+	SOFTPOSIT_CONSTEXPR bool operator!()const{
 		return !value;
 	}
 
 	//&&
-	bool operator&&(const posit16 &a) const{
+	SOFTPOSIT_CONSTEXPR bool operator&&(const posit16 &a) const{
 		return (value && a.value);
 	}
 
 	//||
-	bool operator||(const posit16 &a) const{
+	SOFTPOSIT_CONSTEXPR bool operator||(const posit16 &a) const{
 		return (value || a.value);
 	}
 
-	bool isNaR(){
+	SOFTPOSIT_CONSTEXPR bool isNaR() const{
 		return isNaRP16UI(value);
 	}
 
-	double toDouble()const{
-		return convertP16ToDouble(castP16(value));
+	SOFTPOSIT_CONSTEXPR double toDouble()const{
+		return p16_cxToDouble(value);
 	}
 
 	long long int toInt()const{
@@ -494,20 +888,20 @@ struct posit16{
 	long long int toRInt()const{
 		return p16_to_i64(castP16(value));
 	}
-	posit16& sqrt(){
-		value = castUI( p16_sqrt(castP16(value)) );
+	SOFTPOSIT_CONSTEXPR posit16& sqrt(){
+		value = p16_cxSqrt(value);
 		return *this;
 	}
 	posit16& rint(){
 		value = castUI( p16_roundToInt(castP16(value)) );
 		return *this;
 	}
-	posit16 fma(posit16 a, posit16 b){ // + (a*b)
+	SOFTPOSIT_CONSTEXPR posit16 fma(posit16 a, posit16 b){ // + (a*b)
 		posit16 ans;
-		ans.value = castUI(p16_mulAdd(castP16(a.value), castP16(b.value), castP16(value)));
+		ans.value = p16_cxMulAdd(a.value, b.value, value);
 		return ans;
 	}
-	posit16& toNaR(){
+	SOFTPOSIT_CONSTEXPR posit16& toNaR(){
 		value = 0x8000;
 		return *this;
 	}
@@ -517,169 +911,169 @@ struct posit16{
 
 struct posit32{
 	uint32_t value;
-	posit32(double x=0) : value(castUI(convertDoubleToP32(x))) {
+	SOFTPOSIT_CONSTEXPR posit32(double x=0) : value(p32_cxFromDouble(x)) {
 	}
 
 	//Equal
-	posit32& operator=(const double a) {
-		value = castUI(convertDoubleToP32(a));
+	SOFTPOSIT_CONSTEXPR posit32& operator=(const double a) {
+		value = p32_cxFromDouble(a);
 		return *this;
 	}
-	posit32& operator=(const int a) {
-		value = castUI(i32_to_p32(a));
+	SOFTPOSIT_CONSTEXPR posit32& operator=(const int a) {
+		value = p32_cxFromI32(a);
 		return *this;
 	}
 
 	//Add
-	posit32 operator+(const posit32 &a) const{
+	SOFTPOSIT_CONSTEXPR posit32 operator+(const posit32 &a) const{
 		posit32 ans;
-		ans.value = castUI(p32_add(castP32(value), castP32(a.value)));
+		ans.value = p32_cxAdd(value, a.value);
 		return ans;
 	}
 
 	//Add equal
-	posit32& operator+=(const posit32 &a) {
-		value = castUI(p32_add(castP32(value), castP32(a.value)));
+	SOFTPOSIT_CONSTEXPR posit32& operator+=(const posit32 &a) {
+		value = p32_cxAdd(value, a.value);
 		return *this;
 	}
 
 	//Subtract
-	posit32 operator-(const posit32 &a) const{
+	SOFTPOSIT_CONSTEXPR posit32 operator-(const posit32 &a) const{
 		posit32 ans;
-		ans.value = castUI(p32_sub(castP32(value), castP32(a.value)));
+		ans.value = p32_cxSub(value, a.value);
 		return ans;
 	}
 
 	//Subtract equal
-	posit32& operator-=(const posit32 &a) {
-		value = castUI(p32_sub(castP32(value), castP32(a.value)));
+	SOFTPOSIT_CONSTEXPR posit32& operator-=(const posit32 &a) {
+		value = p32_cxSub(value, a.value);
 		return *this;
 	}
 
 	//Multiply
-	posit32 operator*(const posit32 &a) const{
+	SOFTPOSIT_CONSTEXPR posit32 operator*(const posit32 &a) const{
 		posit32 ans;
-		ans.value = castUI(p32_mul(castP32(value), castP32(a.value)));
+		ans.value = p32_cxMul(value, a.value);
 		return ans;
 	}
 
 	//Multiply equal
-	posit32& operator*=(const posit32 &a) {
-		value = castUI(p32_mul(castP32(value), castP32(a.value)));
+	SOFTPOSIT_CONSTEXPR posit32& operator*=(const posit32 &a) {
+		value = p32_cxMul(value, a.value);
 		return *this;
 	}
 
 
 	//Divide
-	posit32 operator/(const posit32 &a) const{
+	SOFTPOSIT_CONSTEXPR posit32 operator/(const posit32 &a) const{
 		posit32 ans;
-		ans.value = castUI(p32_div(castP32(value), castP32(a.value)));
+		ans.value = p32_cxDiv(value, a.value);
 		return ans;
 	}
 
 	//Divide equal
-	posit32& operator/=(const posit32 &a) {
-		value = castUI(p32_div(castP32(value), castP32(a.value)));
+	SOFTPOSIT_CONSTEXPR posit32& operator/=(const posit32 &a) {
+		value = p32_cxDiv(value, a.value);
 		return *this;
 	}
 
 	//less than
-	bool operator<(const posit32 &a) const{
-		return p32_lt(castP32(value), castP32(a.value));
+	SOFTPOSIT_CONSTEXPR bool operator<(const posit32 &a) const{
+		return (int32_t) value < (int32_t) a.value;
 	}
 
 	//less than equal
-	bool operator<=(const posit32 &a) const{
-		return p32_le(castP32(value), castP32(a.value));
+	SOFTPOSIT_CONSTEXPR bool operator<=(const posit32 &a) const{
+		return (int32_t) value <= (int32_t) a.value;
 	}
 
 	//equal
-	bool operator==(const posit32 &a) const{
-		return p32_eq(castP32(value), castP32(a.value));
+	SOFTPOSIT_CONSTEXPR bool operator==(const posit32 &a) const{
+		return value == a.value;
 	}
 
 
 	//Not equalCPP
-	bool operator!=(const posit32 &a) const{
-		return !p32_eq(castP32(value), castP32(a.value));
+	SOFTPOSIT_CONSTEXPR bool operator!=(const posit32 &a) const{
+		return value != a.value;
 	}
 
 	//greater than
-	bool operator>(const posit32 &a) const{
-		return p32_lt(castP32(a.value), castP32(value));
+	SOFTPOSIT_CONSTEXPR bool operator>(const posit32 &a) const{
+		return (int32_t) a.value < (int32_t) value;
 	}
 
 	//greater than equal
-	bool operator>=(const posit32 &a) const{
-		return p32_le(castP32(a.value), castP32(value));
+	SOFTPOSIT_CONSTEXPR bool operator>=(const posit32 &a) const{
+		return (int32_t) a.value <= (int32_t) value;
 	}
 
 	//plus plus
-	posit32& operator++() {
-		value = castUI(p32_add(castP32(value), castP32(0x40000000)));
+	SOFTPOSIT_CONSTEXPR posit32& operator++() {
+		value = p32_cxAdd(value, 0x40000000);
 		return *this;
 	}
 
 	//minus minus
-	posit32& operator--() {
-		value = castUI(p32_sub(castP32(value), castP32(0x40000000)));
+	SOFTPOSIT_CONSTEXPR posit32& operator--() {
+		value = p32_cxSub(value, 0x40000000);
 		return *this;
 	}
 
 	//Binary operators
 
-	posit32 operator>>(const int &x) {
+	SOFTPOSIT_CONSTEXPR posit32 operator>>(const int &x) {
 		posit32 ans;
 		ans.value = value>>x;
 		return ans;
 	}
 
-	posit32& operator>>=(const int &x) {
+	SOFTPOSIT_CONSTEXPR posit32& operator>>=(const int &x) {
 		value = value>>x;
 		return *this;
 	}
 
-	posit32 operator<<(const int &x) {
+	SOFTPOSIT_CONSTEXPR posit32 operator<<(const int &x) {
 		posit32 ans;
 		ans.value = (value<<x)&0xFFFFFFFF;
 		return ans;
 	}
 
-	posit32& operator<<=(const int &x) {
+	SOFTPOSIT_CONSTEXPR posit32& operator<<=(const int &x) {
 		value = (value<<x)&0xFFFFFFFF;
 		return *this;
 	}
 
 
 	//Negate
-	posit32 operator-() const{
+	SOFTPOSIT_CONSTEXPR posit32 operator-() const{
 		posit32 ans;
 		ans.value = -value;
 		return ans;
 	}
 
 	//NOT
-	posit32 operator~() {
+	SOFTPOSIT_CONSTEXPR posit32 operator~() {
 		posit32 ans;
 		ans.value = ~value;
 		return ans;
 	}
 
 	//AND
-	posit32 operator&(const posit32 &a) const{
+	SOFTPOSIT_CONSTEXPR posit32 operator&(const posit32 &a) const{
 		posit32 ans;
 		ans.value = (value & a.value);
 		return *this;
 	}
 
 	//AND equal
-	posit32& operator&=(const posit32 &a) {
+	SOFTPOSIT_CONSTEXPR posit32& operator&=(const posit32 &a) {
 		value = (value & a.value);
 		return *this;
 	}
 
 	//OR
-	posit32 operator|(const posit32 &a) const{
+	SOFTPOSIT_CONSTEXPR posit32 operator|(const posit32 &a) const{
 		posit32 ans;
 		ans.value = (value | a.value);
 		return ans;
@@ -687,46 +1081,46 @@ struct posit32{
 
 
 	//OR equal
-	posit32& operator|=(const posit32 &a) {
+	SOFTPOSIT_CONSTEXPR posit32& operator|=(const posit32 &a) {
 		value = (value | a.value);
 		return *this;
 	}
 
 	//XOR
-	posit32 operator^(const posit32 &a) const{
+	SOFTPOSIT_CONSTEXPR posit32 operator^(const posit32 &a) const{
 		posit32 ans;
 		ans.value = (value ^ a.value);
 		return ans;
 	}
 
 	//XOR equal
-	posit32& operator^=(const posit32 &a) {
+	SOFTPOSIT_CONSTEXPR posit32& operator^=(const posit32 &a) {
 		value = (value ^ a.value);
 		return *this;
 	}
 
 	//Logical Operator
 	//!
-	bool operator!()const{
+	SOFTPOSIT_CONSTEXPR bool operator!()const{
 		return !value;
 	}
 
 	//&&
-	bool operator&&(const posit32 &a) const{
+	SOFTPOSIT_CONSTEXPR bool operator&&(const posit32 &a) const{
 		return (value && a.value);
 	}
 
 	//||
-	bool operator||(const posit32 &a) const{
+	SOFTPOSIT_CONSTEXPR bool operator||(const posit32 &a) const{
 		return (value || a.value);
 	}
 
-	bool isNaR(){
+	SOFTPOSIT_CONSTEXPR bool isNaR() const{
 		return isNaRP32UI(value);
 	}
 
-	double toDouble()const{
-		return convertP32ToDouble(castP32(value));
+	SOFTPOSIT_CONSTEXPR double toDouble()const{
+		return p32_cxToDouble(value);
 	}
 
 	long long int toInt()const{
@@ -736,21 +1130,21 @@ struct posit32{
 	long long int toRInt()const{
 		return p32_to_i64(castP32(value));
 	}
-	posit32& sqrt(){
-		value = castUI( p32_sqrt(castP32(value)) );
+	SOFTPOSIT_CONSTEXPR posit32& sqrt(){
+		value = p32_cxSqrt(value);
 		return *this;
 	}
 	posit32& rint(){
 		value = castUI( p32_roundToInt(castP32(value)) );
 		return *this;
 	}
-	posit32 fma(posit32 a, posit32 b){ // + (a*b)
+	SOFTPOSIT_CONSTEXPR posit32 fma(posit32 a, posit32 b){ // + (a*b)
 		posit32 ans;
-		ans.value = castUI(p32_mulAdd(castP32(a.value), castP32(b.value), castP32(value)));
+		ans.value = p32_cxMulAdd(a.value, b.value, value);
 		return ans;
 	}
 
-	posit32& toNaR(){
+	SOFTPOSIT_CONSTEXPR posit32& toNaR(){
 		value = 0x80000000;
 		return *this;
 	}
@@ -761,148 +1155,148 @@ struct posit32{
 struct posit_2{
 	uint32_t value;
 	int x;
-	posit_2(double v=0, int x=32) : value(castUI(convertDoubleToPX2(v, x))), x(x) {
+	SOFTPOSIT_CONSTEXPR posit_2(double v=0, int x=32) : value(pX2_cxFromDouble(v, x)), x(x) {
 	}
 
 	//Equal
-	posit_2& operator=(const double a) {
-		value = castUI(convertDoubleToPX2(a, x));
+	SOFTPOSIT_CONSTEXPR posit_2& operator=(const double a) {
+		value = pX2_cxFromDouble(a, x);
 		return *this;
 	}
-	posit_2& operator=(const int a) {
-		value = castUI(i32_to_pX2(a, x));
+	SOFTPOSIT_CONSTEXPR posit_2& operator=(const int a) {
+		value = pX2_cxFromI32(a, x);
 		return *this;
 	}
 
 	//Add
-	posit_2 operator+(const posit_2 &a) const{
+	SOFTPOSIT_CONSTEXPR posit_2 operator+(const posit_2 &a) const{
 		posit_2 ans;
-		ans.value = castUI(pX2_add(castPX2(value), castPX2(a.value), x));
+		ans.value = pX2_cxAdd(value, a.value, x);
 		ans.x = x;
 		return ans;
 	}
 
 	//Add equal
-	posit_2& operator+=(const posit_2 &a) {
-		value = castUI(pX2_add(castPX2(value), castPX2(a.value), x));
+	SOFTPOSIT_CONSTEXPR posit_2& operator+=(const posit_2 &a) {
+		value = pX2_cxAdd(value, a.value, x);
 		return *this;
 	}
 
 	//Subtract
-	posit_2 operator-(const posit_2 &a) const{
+	SOFTPOSIT_CONSTEXPR posit_2 operator-(const posit_2 &a) const{
 		posit_2 ans;
-		ans.value = castUI(pX2_sub(castPX2(value), castPX2(a.value), x));
+		ans.value = pX2_cxSub(value, a.value, x);
 		ans.x = x;
 		return ans;
 	}
 
 	//Subtract equal
-	posit_2& operator-=(const posit_2 &a) {
-		value = castUI(pX2_sub(castPX2(value), castPX2(a.value), x));
+	SOFTPOSIT_CONSTEXPR posit_2& operator-=(const posit_2 &a) {
+		value = pX2_cxSub(value, a.value, x);
 		return *this;
 	}
 
 	//Multiply
-	posit_2 operator*(const posit_2 &a) const{
+	SOFTPOSIT_CONSTEXPR posit_2 operator*(const posit_2 &a) const{
 		posit_2 ans;
-		ans.value = castUI(pX2_mul(castPX2(value), castPX2(a.value), x));
+		ans.value = pX2_cxMul(value, a.value, x);
 		ans.x = x;
 		return ans;
 	}
 
 	//Multiply equal
-	posit_2& operator*=(const posit_2 &a) {
-		value = castUI(pX2_mul(castPX2(value), castPX2(a.value), x));
+	SOFTPOSIT_CONSTEXPR posit_2& operator*=(const posit_2 &a) {
+		value = pX2_cxMul(value, a.value, x);
 		return *this;
 	}
 
 
 	//Divide
-	posit_2 operator/(const posit_2 &a) const{
+	SOFTPOSIT_CONSTEXPR posit_2 operator/(const posit_2 &a) const{
 		posit_2 ans;
-		ans.value = castUI(pX2_div(castPX2(value), castPX2(a.value), x));
+		ans.value = pX2_cxDiv(value, a.value, x);
 		ans.x = x;
 		return ans;
 	}
 
 	//Divide equal
-	posit_2& operator/=(const posit_2 &a) {
-		value = castUI(pX2_div(castPX2(value), castPX2(a.value), x));
+	SOFTPOSIT_CONSTEXPR posit_2& operator/=(const posit_2 &a) {
+		value = pX2_cxDiv(value, a.value, x);
 		return *this;
 	}
 
 	//less than
-	bool operator<(const posit_2 &a) const{
-		return pX2_lt(castPX2(value), castPX2(a.value));
+	SOFTPOSIT_CONSTEXPR bool operator<(const posit_2 &a) const{
+		return (int32_t) value < (int32_t) a.value;
 	}
 
 	//less than equal
-	bool operator<=(const posit_2 &a) const{
-		return pX2_le(castPX2(value), castPX2(a.value));
+	SOFTPOSIT_CONSTEXPR bool operator<=(const posit_2 &a) const{
+		return (int32_t) value <= (int32_t) a.value;
 	}
 
 	//equal
-	bool operator==(const posit_2 &a) const{
-		return pX2_eq(castPX2(value), castPX2(a.value));
+	SOFTPOSIT_CONSTEXPR bool operator==(const posit_2 &a) const{
+		return value == a.value;
 	}
 
 
 	//Not equalCPP
-	bool operator!=(const posit_2 &a) const{
-		return !pX2_eq(castPX2(value), castPX2(a.value));
+	SOFTPOSIT_CONSTEXPR bool operator!=(const posit_2 &a) const{
+		return value != a.value;
 	}
 
 	//greater than
-	bool operator>(const posit_2 &a) const{
-		return pX2_lt(castPX2(a.value), castPX2(value));
+	SOFTPOSIT_CONSTEXPR bool operator>(const posit_2 &a) const{
+		return (int32_t) a.value < (int32_t) value;
 	}
 
 	//greater than equal
-	bool operator>=(const posit_2 &a) const{
-		return pX2_le(castPX2(a.value), castPX2(value));
+	SOFTPOSIT_CONSTEXPR bool operator>=(const posit_2 &a) const{
+		return (int32_t) a.value <= (int32_t) value;
 	}
 
 	//plus plus
-	posit_2& operator++() {
-		value = castUI(pX2_add(castPX2(value), castPX2(0x40000000), x));
+	SOFTPOSIT_CONSTEXPR posit_2& operator++() {
+		value = pX2_cxAdd(value, 0x40000000, x);
 		return *this;
 	}
 
 	//minus minus
-	posit_2& operator--() {
-		value = castUI(pX2_sub(castPX2(value), castPX2(0x40000000), x));
+	SOFTPOSIT_CONSTEXPR posit_2& operator--() {
+		value = pX2_cxSub(value, 0x40000000, x);
 		return *this;
 	}
 
 	//Binary operators
 
-	posit_2 operator>>(const int &x) {
+	SOFTPOSIT_CONSTEXPR posit_2 operator>>(const int &x) {
 		posit_2 ans;
 		ans.value = (value>>x) & ((int32_t)0x80000000>>(x-1));
 		ans.x = x;
 		return ans;
 	}
 
-	posit_2& operator>>=(const int &x) {
+	SOFTPOSIT_CONSTEXPR posit_2& operator>>=(const int &x) {
 		value = (value>>x) & ((int32_t)0x80000000>>(x-1));
 		return *this;
 	}
 
-	posit_2 operator<<(const int &x) {
+	SOFTPOSIT_CONSTEXPR posit_2 operator<<(const int &x) {
 		posit_2 ans;
 		ans.value = (value<<x)&0xFFFFFFFF;
 		ans.x = x;
 		return ans;
 	}
 
-	posit_2& operator<<=(const int &x) {
+	SOFTPOSIT_CONSTEXPR posit_2& operator<<=(const int &x) {
 		value = (value<<x)&0xFFFFFFFF;
 		return *this;
 	}
 
 
 	//Negate
-	posit_2 operator-() const{
+	SOFTPOSIT_CONSTEXPR posit_2 operator-() const{
 		posit_2 ans;
 		ans.value = -value;
 		ans.x = x;
@@ -910,7 +1304,7 @@ struct posit_2{
 	}
 
 	//NOT
-	posit_2 operator~() {
+	SOFTPOSIT_CONSTEXPR posit_2 operator~() {
 		posit_2 ans;
 		ans.value = ~value;
 		ans.x = x;
@@ -918,20 +1312,20 @@ struct posit_2{
 	}
 
 	//AND
-	posit_2 operator&(const posit_2 &a) const{
+	SOFTPOSIT_CONSTEXPR posit_2 operator&(const posit_2 &a) const{
 		posit_2 ans;
 		ans.value = (value & a.value);
 		return *this;
 	}
 
 	//AND equal
-	posit_2& operator&=(const posit_2 &a) {
+	SOFTPOSIT_CONSTEXPR posit_2& operator&=(const posit_2 &a) {
 		value = (value & a.value);
 		return *this;
 	}
 
 	//OR
-	posit_2 operator|(const posit_2 &a) const{
+	SOFTPOSIT_CONSTEXPR posit_2 operator|(const posit_2 &a) const{
 		posit_2 ans;
 		ans.value = (value | a.value);
 		return ans;
@@ -939,46 +1333,46 @@ struct posit_2{
 
 
 	//OR equal
-	posit_2& operator|=(const posit_2 &a) {
+	SOFTPOSIT_CONSTEXPR posit_2& operator|=(const posit_2 &a) {
 		value = (value | a.value);
 		return *this;
 	}
 
 	//XOR
-	posit_2 operator^(const posit_2 &a) const{
+	SOFTPOSIT_CONSTEXPR posit_2 operator^(const posit_2 &a) const{
 		posit_2 ans;
 		ans.value = (value ^ a.value);
 		return ans;
 	}
 
 	//XOR equal
-	posit_2& operator^=(const posit_2 &a) {
+	SOFTPOSIT_CONSTEXPR posit_2& operator^=(const posit_2 &a) {
 		value = (value ^ a.value);
 		return *this;
 	}
 
 	//Logical Operator
 	//!
-	bool operator!()const{
+	SOFTPOSIT_CONSTEXPR bool operator!()const{
 		return !value;
 	}
 
 	//&&
-	bool operator&&(const posit_2 &a) const{
+	SOFTPOSIT_CONSTEXPR bool operator&&(const posit_2 &a) const{
 		return (value && a.value);
 	}
 
 	//||
-	bool operator||(const posit_2 &a) const{
+	SOFTPOSIT_CONSTEXPR bool operator||(const posit_2 &a) const{
 		return (value || a.value);
 	}
 
-	bool isNaR(){
+	SOFTPOSIT_CONSTEXPR bool isNaR() const{
 		return isNaRPX2UI(value);
 	}
 
-	double toDouble()const{
-		return convertPX2ToDouble(castPX2(value));
+	SOFTPOSIT_CONSTEXPR double toDouble()const{
+		return pX2_cxToDouble(value, x);
 	}
 
 	long long int toInt()const{
@@ -988,17 +1382,17 @@ struct posit_2{
 	long long int toRInt()const{
 		return pX2_to_i64(castPX2(value));
 	}
-	posit_2& sqrt(){
-		value = castUI( pX2_sqrt(castPX2(value), x) );
+	SOFTPOSIT_CONSTEXPR posit_2& sqrt(){
+		value = pX2_cxSqrt(value, x);
 		return *this;
 	}
 	posit_2& rint(){
 		value = castUI( pX2_roundToInt(castPX2(value), x) );
 		return *this;
 	}
-	posit_2 fma(posit_2 a, posit_2 b){ // + (a*b)
+	SOFTPOSIT_CONSTEXPR posit_2 fma(posit_2 a, posit_2 b){ // + (a*b)
 		posit_2 ans;
-		ans.value = castUI(pX2_mulAdd(castPX2(a.value), castPX2(b.value), castPX2(value), x));
+		ans.value = pX2_cxMulAdd(a.value, b.value, value, x);
 		ans.x = x;
 		return ans;
 	}
@@ -1009,12 +1403,259 @@ struct posit_2{
 		ans.x = x;
 		return ans;
 	}
-	posit_2& toNaR(){
+	SOFTPOSIT_CONSTEXPR posit_2& toNaR(){
 		value = 0x80000000;
 		return *this;
 	}
 
 
+};
+
+//posit64 and quire64 run on the library only; the constant-evaluation engine
+//above stops at 32 bits.  Both keep the C layout (a single uint64_t, sixteen
+//uint64_t) and declare no copy or move members, so they are trivially copyable.
+struct posit64{
+	uint64_t value;
+	posit64(double x=0) : value(castUI(convertDoubleToP64(x))) {
+	}
+
+	//Equal
+	posit64& operator=(const double a) {
+		value = castUI(convertDoubleToP64(a));
+		return *this;
+	}
+	posit64& operator=(const int a) {
+		value = castUI(i32_to_p64(a));
+		return *this;
+	}
+	posit64& operator=(const long long int a) {
+		value = castUI(i64_to_p64(a));
+		return *this;
+	}
+
+	//Add
+	posit64 operator+(const posit64 &a) const{
+		posit64 ans;
+		ans.value = castUI(p64_add(castP64(value), castP64(a.value)));
+		return ans;
+	}
+
+	//Add equal
+	posit64& operator+=(const posit64 &a) {
+		value = castUI(p64_add(castP64(value), castP64(a.value)));
+		return *this;
+	}
+
+	//Subtract
+	posit64 operator-(const posit64 &a) const{
+		posit64 ans;
+		ans.value = castUI(p64_sub(castP64(value), castP64(a.value)));
+		return ans;
+	}
+
+	//Subtract equal
+	posit64& operator-=(const posit64 &a) {
+		value = castUI(p64_sub(castP64(value), castP64(a.value)));
+		return *this;
+	}
+
+	//Multiply
+	posit64 operator*(const posit64 &a) const{
+		posit64 ans;
+		ans.value = castUI(p64_mul(castP64(value), castP64(a.value)));
+		return ans;
+	}
+
+	//Multiply equal
+	posit64& operator*=(const posit64 &a) {
+		value = castUI(p64_mul(castP64(value), castP64(a.value)));
+		return *this;
+	}
+
+	//Divide
+	posit64 operator/(const posit64 &a) const{
+		posit64 ans;
+		ans.value = castUI(p64_div(castP64(value), castP64(a.value)));
+		return ans;
+	}
+
+	//Divide equal
+	posit64& operator/=(const posit64 &a) {
+		value = castUI(p64_div(castP64(value), castP64(a.value)));
+		return *this;
+	}
+
+	//less than
+	bool operator<(const posit64 &a) const{
+		return (int64_t) value < (int64_t) a.value;
+	}
+
+	//less than equal
+	bool operator<=(const posit64 &a) const{
+		return (int64_t) value <= (int64_t) a.value;
+	}
+
+	//equal
+	bool operator==(const posit64 &a) const{
+		return value == a.value;
+	}
+
+	//Not equal
+	bool operator!=(const posit64 &a) const{
+		return value != a.value;
+	}
+
+	//greater than
+	bool operator>(const posit64 &a) const{
+		return (int64_t) a.value < (int64_t) value;
+	}
+
+	//greater than equal
+	bool operator>=(const posit64 &a) const{
+		return (int64_t) a.value <= (int64_t) value;
+	}
+
+	//plus plus
+	posit64& operator++() {
+		value = castUI(p64_add(castP64(value), castP64(0x4000000000000000)));
+		return *this;
+	}
+
+	//minus minus
+	posit64& operator--() {
+		value = castUI(p64_sub(castP64(value), castP64(0x4000000000000000)));
+		return *this;
+	}
+
+	//Binary operators
+
+	posit64 operator>>(const int &x) {
+		posit64 ans;
+		ans.value = value>>x;
+		return ans;
+	}
+
+	posit64& operator>>=(const int &x) {
+		value = value>>x;
+		return *this;
+	}
+
+	posit64 operator<<(const int &x) {
+		posit64 ans;
+		ans.value = value<<x;
+		return ans;
+	}
+
+	posit64& operator<<=(const int &x) {
+		value = value<<x;
+		return *this;
+	}
+
+
+	//Negate
+	posit64 operator-() const{
+		posit64 ans;
+		ans.value = -value;
+		return ans;
+	}
+
+	//NOT
+	posit64 operator~() {
+		posit64 ans;
+		ans.value = ~value;
+		return ans;
+	}
+
+	//AND
+	posit64 operator&(const posit64 &a) const{
+		posit64 ans;
+		ans.value = (value & a.value);
+		return ans;
+	}
+
+	//AND equal
+	posit64& operator&=(const posit64 &a) {
+		value = (value & a.value);
+		return *this;
+	}
+
+	//OR
+	posit64 operator|(const posit64 &a) const{
+		posit64 ans;
+		ans.value = (value | a.value);
+		return ans;
+	}
+
+	//OR equal
+	posit64& operator|=(const posit64 &a) {
+		value = (value | a.value);
+		return *this;
+	}
+
+	//XOR
+	posit64 operator^(const posit64 &a) const{
+		posit64 ans;
+		ans.value = (value ^ a.value);
+		return ans;
+	}
+
+	//XOR equal
+	posit64& operator^=(const posit64 &a) {
+		value = (value ^ a.value);
+		return *this;
+	}
+
+	//Logical Operator
+	//!
+	bool operator!()const{
+		return !value;
+	}
+
+	//&&
+	bool operator&&(const posit64 &a) const{
+		return (value && a.value);
+	}
+
+	//||
+	bool operator||(const posit64 &a) const{
+		return (value || a.value);
+	}
+
+	bool isNaR() const{
+		return isNaRP64UI(value);
+	}
+
+	double toDouble()const{
+		return convertP64ToDouble(castP64(value));
+	}
+
+	long long int toInt()const{
+		return p64_int(castP64(value));
+	}
+
+	long long int toRInt()const{
+		return p64_to_i64(castP64(value));
+	}
+	posit64& sqrt(){
+		value = castUI(p64_sqrt(castP64(value)));
+		return *this;
+	}
+	posit64& rint(){
+		value = castUI(p64_roundToInt(castP64(value)));
+		return *this;
+	}
+	posit64 fma(posit64 a, posit64 b){ // + (a*b)
+		posit64 ans;
+		ans.value = castUI(p64_mulAdd(castP64(a.value), castP64(b.value), castP64(value)));
+		return ans;
+	}
+
+	posit64& toNaR(){
+		value = 0x8000000000000000;
+		return *this;
+	}
+
+
 };
 
 struct quire8{
@@ -1149,6 +1790,51 @@ struct quire32{
 
 };
 
+struct quire64{
+	uint64_t v[16];
+
+	quire64 (){
+		clr();
+	}
+
+	quire64& clr(){
+		for (int i=0; i<16; i++) v[i] = 0;
+		return *this;
+	}
+
+	bool isNaR() const{
+		return isNaRQ64(get());
+	}
+
+	quire64& qma(posit64 a, posit64 b){ // q += a*b
+		 set(q64_fdp_add(get(), castP64(a.value), castP64(b.value)));
+		 return *this;
+	}
+	quire64& qms(posit64 a, posit64 b){ // q -= a*b
+		 set(q64_fdp_sub(get(), castP64(a.value), castP64(b.value)));
+		 return *this;
+	}
+	posit64 toPosit() const{
+		posit64 a;
+		a.value = castUI(q64_to_p64(get()));
+		return a;
+	}
+
+	quire64_t get() const{
+		quire64_t q;
+		for (int i=0; i<16; i++) q.v[i] = v[i];
+		return q;
+	}
+	quire64& set(const quire64_t &q){
+		for (int i=0; i<16; i++) v[i] = q.v[i];
+		return *this;
+	}
+
+};
+
+static_assert(std::is_trivially_copyable<posit64>::value && sizeof(posit64)==sizeof(posit64_t), "posit64 must keep the posit64_t layout");
+static_assert(std::is_trivially_copyable<quire64>::value && sizeof(quire64)==sizeof(quire64_t), "quire64 must keep the quire64_t layout");
+
 struct quire_2{
 	uint64_t v0;
 	uint64_t v1;
@@ -1214,209 +1900,539 @@ struct quire_2{
 
 };
 
-inline posit8 operator+(int a, posit8 b){
-	b.value = castUI(p8_add(i32_to_p8(a), castP8(b.value)));
-	return b;
-}
-inline posit16 operator+(int a, posit16 b){
-	b.value = castUI(p16_add(i32_to_p16(a), castP16(b.value)));
-	return b;
-}
-inline posit32 operator+(int a, posit32 b){
-	b.value = castUI(p32_add(i32_to_p32(a), castP32(b.value)));
-	return b;
-}
-inline posit32 operator+(long long int a, posit32 b){
-	b.value = castUI(p32_add(i64_to_p32(a), castP32(b.value)));
-	return b;
-}
-inline posit_2 operator+(int a, posit_2 b){
-	b.value = castUI(pX2_add(i32_to_pX2(a, b.x), castPX2(b.value), b.x));
-	return b;
-}
-inline posit_2 operator+(long long int a, posit_2 b){
-	b.value = castUI(pX2_add(i64_to_pX2(a, b.x), castPX2(b.value), b.x));
-	return b;
-}
+/*----------------------------------------------------------------------------
+| Expression templates for posit32.  Fusion is opt-in: a*b stays a rounded
+| posit32, while p32_prod(a, b) is the unrounded product.  Sums and
+| differences with a p32_prod or a quire32 on either side, and posits or
+| arithmetic constants as the other terms, build p32_sum/p32_neg nodes on
+| the stack.  Converting the expression to posit32 (assignment,
+| initialisation or a comparison) evaluates it in a single quire32 and
+| rounds once, so
+|   posit32 r = p32_prod(a, b) + p32_prod(c, d) - p32_prod(e, f);
+| costs three fused dot-product steps and one rounding.  Nodes hold their
+| operands by value: an expression kept with auto stays valid, but is only
+| evaluated when converted.  Every other operation on an expression
+| (multiply, divide, shifts, bitwise and logical operators, sqrt, rint, ...)
+| rounds it first and then behaves exactly as on posit32.
+*----------------------------------------------------------------------------*/
+struct p32_prod;
+template<class L, class R, bool subtract> struct p32_sum;
+template<class E> struct p32_neg;
+
+template<class T> struct p32_isExpr { static const bool value = false; };
+template<> struct p32_isExpr<p32_prod> { static const bool value = true; };
+template<class L, class R, bool s> struct p32_isExpr< p32_sum<L, R, s> > { static const bool value = true; };
+template<class E> struct p32_isExpr< p32_neg<E> > { static const bool value = true; };
+
+template<class T> struct p32_isTerm {
+	static const bool value = p32_isExpr<T>::value || std::is_same<T, posit32>::value ||
+			std::is_same<T, quire32>::value || std::is_arithmetic<T>::value;
+};
 
-inline posit8 operator+(double a, posit8 b){
-	b.value = castUI(p8_add(convertDoubleToP8(a), castP8(b.value)));
-	return b;
-}
-inline posit16 operator+(double a, posit16 b){
-	b.value = castUI(p16_add(convertDoubleToP16(a), castP16(b.value)));
-	return b;
-}
-inline posit32 operator+(double a, posit32 b){
-	b.value = castUI(p32_add(convertDoubleToP32(a), castP32(b.value)));
-	return b;
-}
-inline posit_2 operator+(double a, posit_2 b){
-	b.value = castUI(pX2_add(convertDoubleToPX2(a, b.x), castPX2(b.value), b.x));
-	return b;
-}
+//At least one side must be an expression or a quire, so posit32 + posit32 keeps its rounded add
+template<class L, class R> struct p32_isFusable {
+	static const bool value = p32_isTerm<L>::value && p32_isTerm<R>::value &&
+			(p32_isExpr<L>::value || p32_isExpr<R>::value ||
+			std::is_same<L, quire32>::value || std::is_same<R, quire32>::value);
+};
 
+template<class E> struct p32_expr{
+	SOFTPOSIT_CONSTEXPR operator posit32() const{
+		posit32 ans;
+		if (SOFTPOSIT_CONSTANT_EVALUATED()){
+			softposit_cxQuire q;
+			static_cast<const E&>(*this).accumulate(q, false);
+			ans.value = q.toPosit(32, 2);
+		}
+		else{
+			quire32_t q = q32Clr();
+			static_cast<const E&>(*this).accumulate(q, false);
+			ans.value = castUI(q32_to_p32(q));
+		}
+		return ans;
+	}
 
-inline posit8 operator-(int a, posit8 b){
-	b.value = castUI(p8_sub(i32_to_p8(a), castP8(b.value)));
-	return b;
-}
-inline posit16 operator-(int a, posit16 b){
-	b.value = castUI(p16_sub(i32_to_p16(a), castP16(b.value)));
-	return b;
-}
-inline posit32 operator-(int a, posit32 b){
-	b.value = castUI(p32_sub(i32_to_p32(a), castP32(b.value)));
-	return b;
-}
-inline posit32 operator-(long long int a, posit32 b){
-	b.value = castUI(p32_sub(i64_to_p32(a), castP32(b.value)));
-	return b;
-}
-inline posit_2 operator-(int a, posit_2 b){
-	b.value = castUI(pX2_sub(i32_to_pX2(a, b.x), castPX2(b.value), b.x));
-	return b;
-}
-inline posit_2 operator-(long long int a, posit_2 b){
-	b.value = castUI(pX2_sub(i64_to_pX2(a, b.x), castPX2(b.value), b.x));
-	return b;
-}
+	SOFTPOSIT_CONSTEXPR double toDouble() const{
+		return posit32(*this).toDouble();
+	}
 
+	SOFTPOSIT_CONSTEXPR bool isNaR() const{
+		return posit32(*this).isNaR();
+	}
 
-inline posit8 operator-(double a, posit8 b){
-	b.value = castUI(p8_sub(convertDoubleToP8(a), castP8(b.value)));
-	return b;
-}
-inline posit16 operator-(double a, posit16 b){
-	b.value = castUI(p16_sub(convertDoubleToP16(a), castP16(b.value)));
-	return b;
-}
-inline posit32 operator-(double a, posit32 b){
-	b.value = castUI(p32_sub(convertDoubleToP32(a), castP32(b.value)));
-	return b;
+	long long int toInt() const{
+		return posit32(*this).toInt();
+	}
+
+	long long int toRInt() const{
+		return posit32(*this).toRInt();
+	}
+
+	//Rounded copies: an expression has no storage to update in place
+	SOFTPOSIT_CONSTEXPR posit32 sqrt() const{
+		posit32 ans = *this;
+		return ans.sqrt();
+	}
+
+	posit32 rint() const{
+		posit32 ans = *this;
+		return ans.rint();
+	}
+
+	SOFTPOSIT_CONSTEXPR posit32 fma(posit32 a, posit32 b) const{ // + (a*b)
+		return posit32(*this).fma(a, b);
+	}
+
+	SOFTPOSIT_CONSTEXPR posit32 operator*(const posit32 &a) const{
+		return posit32(*this) * a;
+	}
+
+	SOFTPOSIT_CONSTEXPR posit32 operator/(const posit32 &a) const{
+		return posit32(*this) / a;
+	}
+
+	SOFTPOSIT_CONSTEXPR posit32 operator>>(const int &x) const{
+		return posit32(*this) >> x;
+	}
+
+	SOFTPOSIT_CONSTEXPR posit32 operator<<(const int &x) const{
+		return posit32(*this) << x;
+	}
+
+	SOFTPOSIT_CONSTEXPR posit32 operator~() const{
+		return ~posit32(*this);
+	}
+
+	SOFTPOSIT_CONSTEXPR posit32 operator&(const posit32 &a) const{
+		return posit32(*this) & a;
+	}
+
+	SOFTPOSIT_CONSTEXPR posit32 operator|(const posit32 &a) const{
+		return posit32(*this) | a;
+	}
+
+	SOFTPOSIT_CONSTEXPR posit32 operator^(const posit32 &a) const{
+		return posit32(*this) ^ a;
+	}
+
+	SOFTPOSIT_CONSTEXPR bool operator!() const{
+		return !posit32(*this);
+	}
+
+	SOFTPOSIT_CONSTEXPR bool operator&&(const posit32 &a) const{
+		return posit32(*this) && a;
+	}
+
+	SOFTPOSIT_CONSTEXPR bool operator||(const posit32 &a) const{
+		return posit32(*this) || a;
+	}
+};
+
+inline void p32_accumulate(quire32_t &q, const posit32 &a, bool negate){
+	if (negate) q = q32_fdp_sub(q, castP32(a.value), castP32(0x40000000));
+	else q = q32_fdp_add(q, castP32(a.value), castP32(0x40000000));
+}
+
+SOFTPOSIT_CONSTEXPR inline void p32_accumulate(softposit_cxQuire &q, const posit32 &a, bool negate){
+	q.fdp(a.value, 0x40000000, 32, 2, negate);
+}
+
+//Two's complement addition of whole quires; NaR is sticky
+inline void p32_accumulate(quire32_t &q, const quire32 &a, bool negate){
+	quire32_t b = castQ32(a.v0, a.v1, a.v2, a.v3, a.v4, a.v5, a.v6, a.v7);
+	uint64_t carry = 0;
+
+	if (isNaRQ32(q)) return;
+	if (isNaRQ32(b)){
+		q = b;
+		return;
+	}
+	if (negate) b = q32_TwosComplement(b);
+	for (int i=7; i>=0; i--){
+		uint64_t sum = q.v[i] + b.v[i];
+		uint64_t next = sum < q.v[i];
+		q.v[i] = sum + carry;
+		carry = next | (q.v[i] < sum);
+	}
+}
+
+SOFTPOSIT_CONSTEXPR inline void p32_accumulate(softposit_cxQuire &q, const quire32 &a, bool negate){
+	softposit_cxQuire b;
+	b.v[0] = a.v0; b.v[1] = a.v1; b.v[2] = a.v2; b.v[3] = a.v3;
+	b.v[4] = a.v4; b.v[5] = a.v5; b.v[6] = a.v6; b.v[7] = a.v7;
+
+	if (q.isNaR()) return;
+	if (b.isNaR()) q.toNaR();
+	else q.add(b.v, negate);
+}
+
+template<class T> SOFTPOSIT_CONSTEXPR inline typename std::enable_if<std::is_arithmetic<T>::value, posit32>::type p32_term(T a){
+	posit32 ans;
+	if (std::is_integral<T>::value) ans.value = p32_cxFromI64((int64_t) a);
+	else ans.value = p32_cxFromDouble((double) a);
+	return ans;
+}
+
+template<class Q, class T> SOFTPOSIT_CONSTEXPR inline typename std::enable_if<std::is_arithmetic<T>::value>::type p32_accumulate(Q &q, T a, bool negate){
+	p32_accumulate(q, p32_term(a), negate);
+}
+
+template<class Q, class E> SOFTPOSIT_CONSTEXPR inline void p32_accumulate(Q &q, const p32_expr<E> &a, bool negate){
+	static_cast<const E&>(a).accumulate(q, negate);
+}
+
+struct p32_prod : p32_expr<p32_prod>{
+	posit32 a;
+	posit32 b;
+
+	SOFTPOSIT_CONSTEXPR p32_prod(const posit32 &a, const posit32 &b) : a(a), b(b) {
+	}
+
+	void accumulate(quire32_t &q, bool negate) const{
+		if (negate) q = q32_fdp_sub(q, castP32(a.value), castP32(b.value));
+		else q = q32_fdp_add(q, castP32(a.value), castP32(b.value));
+	}
+
+	SOFTPOSIT_CONSTEXPR void accumulate(softposit_cxQuire &q, bool negate) const{
+		q.fdp(a.value, b.value, 32, 2, negate);
+	}
+};
+
+template<class L, class R, bool subtract> struct p32_sum : p32_expr< p32_sum<L, R, subtract> >{
+	L a;
+	R b;
+
+	SOFTPOSIT_CONSTEXPR p32_sum(const L &a, const R &b) : a(a), b(b) {
+	}
+
+	template<class Q> SOFTPOSIT_CONSTEXPR void accumulate(Q &q, bool negate) const{
+		p32_accumulate(q, a, negate);
+		p32_accumulate(q, b, negate != subtract);
+	}
+};
+
+template<class E> struct p32_neg : p32_expr< p32_neg<E> >{
+	E a;
+
+	SOFTPOSIT_CONSTEXPR p32_neg(const E &a) : a(a) {
+	}
+
+	template<class Q> SOFTPOSIT_CONSTEXPR void accumulate(Q &q, bool negate) const{
+		a.accumulate(q, !negate);
+	}
+};
+
+template<class L, class R> SOFTPOSIT_CONSTEXPR inline typename std::enable_if<p32_isFusable<L, R>::value, p32_sum<L, R, false> >::type
+operator+(const L &a, const R &b){
+	return p32_sum<L, R, false>(a, b);
+}
+
+template<class L, class R> SOFTPOSIT_CONSTEXPR inline typename std::enable_if<p32_isFusable<L, R>::value, p32_sum<L, R, true> >::type
+operator-(const L &a, const R &b){
+	return p32_sum<L, R, true>(a, b);
+}
+
+template<class E> SOFTPOSIT_CONSTEXPR inline p32_neg<E> operator-(const p32_expr<E> &a){
+	return p32_neg<E>(static_cast<const E&>(a));
+}
+
+template<class T> SOFTPOSIT_CONSTEXPR inline typename std::enable_if<p32_isExpr<T>::value || std::is_same<T, posit32>::value, posit32>::type
+p32_round(const T &a){
+	return a;
+}
+
+template<class T> SOFTPOSIT_CONSTEXPR inline typename std::enable_if<std::is_arithmetic<T>::value, posit32>::type p32_round(T a){
+	return p32_term(a);
+}
+
+//Comparisons round the expression first
+template<class L, class R> struct p32_isComparable {
+	static const bool value = (p32_isExpr<L>::value || p32_isExpr<R>::value) &&
+			!std::is_same<L, quire32>::value && !std::is_same<R, quire32>::value &&
+			p32_isTerm<L>::value && p32_isTerm<R>::value;
+};
+
+template<class L, class R> SOFTPOSIT_CONSTEXPR inline typename std::enable_if<p32_isComparable<L, R>::value, bool>::type
+operator<(const L &a, const R &b){
+	return p32_round(a) < p32_round(b);
+}
+template<class L, class R> SOFTPOSIT_CONSTEXPR inline typename std::enable_if<p32_isComparable<L, R>::value, bool>::type
+operator<=(const L &a, const R &b){
+	return p32_round(a) <= p32_round(b);
+}
+template<class L, class R> SOFTPOSIT_CONSTEXPR inline typename std::enable_if<p32_isComparable<L, R>::value, bool>::type
+operator>(const L &a, const R &b){
+	return p32_round(a) > p32_round(b);
+}
+template<class L, class R> SOFTPOSIT_CONSTEXPR inline typename std::enable_if<p32_isComparable<L, R>::value, bool>::type
+operator>=(const L &a, const R &b){
+	return p32_round(a) >= p32_round(b);
+}
+template<class L, class R> SOFTPOSIT_CONSTEXPR inline typename std::enable_if<p32_isComparable<L, R>::value, bool>::type
+operator==(const L &a, const R &b){
+	return p32_round(a) == p32_round(b);
+}
+template<class L, class R> SOFTPOSIT_CONSTEXPR inline typename std::enable_if<p32_isComparable<L, R>::value, bool>::type
+operator!=(const L &a, const R &b){
+	return p32_round(a) != p32_round(b);
 }
-inline posit_2 operator-(double a, posit_2 b){
-	b.value = castUI(pX2_sub(convertDoubleToPX2(a, b.x), castPX2(b.value), b.x));
+
+SOFTPOSIT_CONSTEXPR inline posit8 operator+(int a, posit8 b){
+	b.value = p8_cxAdd(p8_cxFromI32(a), b.value);
+	return b;
+}
+SOFTPOSIT_CONSTEXPR inline posit16 operator+(int a, posit16 b){
+	b.value = p16_cxAdd(p16_cxFromI32(a), b.value);
+	return b;
+}
+SOFTPOSIT_CONSTEXPR inline posit32 operator+(int a, posit32 b){
+	b.value = p32_cxAdd(p32_cxFromI32(a), b.value);
+	return b;
+}
+SOFTPOSIT_CONSTEXPR inline posit32 operator+(long long int a, posit32 b){
+	b.value = p32_cxAdd(p32_cxFromI64(a), b.value);
+	return b;
+}
+SOFTPOSIT_CONSTEXPR inline posit_2 operator+(int a, posit_2 b){
+	b.value = pX2_cxAdd(pX2_cxFromI32(a, b.x), b.value, b.x);
+	return b;
+}
+SOFTPOSIT_CONSTEXPR inline posit_2 operator+(long long int a, posit_2 b){
+	b.value = pX2_cxAdd(pX2_cxFromI64(a, b.x), b.value, b.x);
+	return b;
+}
+inline posit64 operator+(int a, posit64 b){
+	b.value = castUI(p64_add(i32_to_p64(a), castP64(b.value)));
+	return b;
+}
+inline posit64 operator+(long long int a, posit64 b){
+	b.value = castUI(p64_add(i64_to_p64(a), castP64(b.value)));
 	return b;
 }
 
+SOFTPOSIT_CONSTEXPR inline posit8 operator+(double a, posit8 b){
+	b.value = p8_cxAdd(p8_cxFromDouble(a), b.value);
+	return b;
+}
+SOFTPOSIT_CONSTEXPR inline posit16 operator+(double a, posit16 b){
+	b.value = p16_cxAdd(p16_cxFromDouble(a), b.value);
+	return b;
+}
+SOFTPOSIT_CONSTEXPR inline posit32 operator+(double a, posit32 b){
+	b.value = p32_cxAdd(p32_cxFromDouble(a), b.value);
+	return b;
+}
+SOFTPOSIT_CONSTEXPR inline posit_2 operator+(double a, posit_2 b){
+	b.value = pX2_cxAdd(pX2_cxFromDouble(a, b.x), b.value, b.x);
+	return b;
+}
+inline posit64 operator+(double a, posit64 b){
+	b.value = castUI(p64_add(convertDoubleToP64(a), castP64(b.value)));
+	return b;
+}
 
 
-inline posit8 operator/(int a, posit8 b){
-	b.value = castUI(p8_div(i32_to_p8(a), castP8(b.value)));
+SOFTPOSIT_CONSTEXPR inline posit8 operator-(int a, posit8 b){
+	b.value = p8_cxSub(p8_cxFromI32(a), b.value);
+	return b;
+}
+SOFTPOSIT_CONSTEXPR inline posit16 operator-(int a, posit16 b){
+	b.value = p16_cxSub(p16_cxFromI32(a), b.value);
 	return b;
 }
-inline posit16 operator/(int a, posit16 b){
-	b.value = castUI(p16_div(i32_to_p16(a), castP16(b.value)));
+SOFTPOSIT_CONSTEXPR inline posit32 operator-(int a, posit32 b){
+	b.value = p32_cxSub(p32_cxFromI32(a), b.value);
 	return b;
 }
-inline posit32 operator/(int a, posit32 b){
-	b.value = castUI(p32_div(i32_to_p32(a), castP32(b.value)));
+SOFTPOSIT_CONSTEXPR inline posit32 operator-(long long int a, posit32 b){
+	b.value = p32_cxSub(p32_cxFromI64(a), b.value);
 	return b;
 }
-inline posit32 operator/(long long int a, posit32 b){
-	b.value = castUI(p32_div(i64_to_p32(a), castP32(b.value)));
+SOFTPOSIT_CONSTEXPR inline posit_2 operator-(int a, posit_2 b){
+	b.value = pX2_cxSub(pX2_cxFromI32(a, b.x), b.value, b.x);
 	return b;
 }
-inline posit_2 operator/(int a, posit_2 b){
-	b.value = castUI(pX2_div(i32_to_pX2(a, b.x), castPX2(b.value), b.x));
+SOFTPOSIT_CONSTEXPR inline posit_2 operator-(long long int a, posit_2 b){
+	b.value = pX2_cxSub(pX2_cxFromI64(a, b.x), b.value, b.x);
 	return b;
 }
-inline posit_2 operator/(long long int a, posit_2 b){
-	b.value = castUI(pX2_div(i64_to_pX2(a, b.x), castPX2(b.value), b.x));
+inline posit64 operator-(int a, posit64 b){
+	b.value = castUI(p64_sub(i32_to_p64(a), castP64(b.value)));
+	return b;
+}
+inline posit64 operator-(long long int a, posit64 b){
+	b.value = castUI(p64_sub(i64_to_p64(a), castP64(b.value)));
 	return b;
 }
 
 
+SOFTPOSIT_CONSTEXPR inline posit8 operator-(double a, posit8 b){
+	b.value = p8_cxSub(p8_cxFromDouble(a), b.value);
+	return b;
+}
+SOFTPOSIT_CONSTEXPR inline posit16 operator-(double a, posit16 b){
+	b.value = p16_cxSub(p16_cxFromDouble(a), b.value);
+	return b;
+}
+SOFTPOSIT_CONSTEXPR inline posit32 operator-(double a, posit32 b){
+	b.value = p32_cxSub(p32_cxFromDouble(a), b.value);
+	return b;
+}
+SOFTPOSIT_CONSTEXPR inline posit_2 operator-(double a, posit_2 b){
+	b.value = pX2_cxSub(pX2_cxFromDouble(a, b.x), b.value, b.x);
+	return b;
+}
+inline posit64 operator-(double a, posit64 b){
+	b.value = castUI(p64_sub(convertDoubleToP64(a), castP64(b.value)));
+	return b;
+}
+
 
-inline posit8 operator/(double a, posit8 b){
-	b.value = castUI(p8_div(convertDoubleToP8(a), castP8(b.value)));
+
+SOFTPOSIT_CONSTEXPR inline posit8 operator/(int a, posit8 b){
+	b.value = p8_cxDiv(p8_cxFromI32(a), b.value);
+	return b;
+}
+SOFTPOSIT_CONSTEXPR inline posit16 operator/(int a, posit16 b){
+	b.value = p16_cxDiv(p16_cxFromI32(a), b.value);
+	return b;
+}
+SOFTPOSIT_CONSTEXPR inline posit32 operator/(int a, posit32 b){
+	b.value = p32_cxDiv(p32_cxFromI32(a), b.value);
 	return b;
 }
-inline posit16 operator/(double a, posit16 b){
-	b.value = castUI(p16_div(convertDoubleToP16(a), castP16(b.value)));
+SOFTPOSIT_CONSTEXPR inline posit32 operator/(long long int a, posit32 b){
+	b.value = p32_cxDiv(p32_cxFromI64(a), b.value);
 	return b;
 }
-inline posit32 operator/(double a, posit32 b){
-	b.value = castUI(p32_div(convertDoubleToP32(a), castP32(b.value)));
+SOFTPOSIT_CONSTEXPR inline posit_2 operator/(int a, posit_2 b){
+	b.value = pX2_cxDiv(pX2_cxFromI32(a, b.x), b.value, b.x);
 	return b;
 }
-inline posit_2 operator/(double a, posit_2 b){
-	b.value = castUI(pX2_div(convertDoubleToPX2(a, b.x), castPX2(b.value), b.x));
+SOFTPOSIT_CONSTEXPR inline posit_2 operator/(long long int a, posit_2 b){
+	b.value = pX2_cxDiv(pX2_cxFromI64(a, b.x), b.value, b.x);
+	return b;
+}
+inline posit64 operator/(int a, posit64 b){
+	b.value = castUI(p64_div(i32_to_p64(a), castP64(b.value)));
+	return b;
+}
+inline posit64 operator/(long long int a, posit64 b){
+	b.value = castUI(p64_div(i64_to_p64(a), castP64(b.value)));
 	return b;
 }
 
 
 
-inline posit8 operator*(int a, posit8 b){
-	b.value = castUI(p8_mul(i32_to_p8(a), castP8(b.value)));
+SOFTPOSIT_CONSTEXPR inline posit8 operator/(double a, posit8 b){
+	b.value = p8_cxDiv(p8_cxFromDouble(a), b.value);
+	return b;
+}
+SOFTPOSIT_CONSTEXPR inline posit16 operator/(double a, posit16 b){
+	b.value = p16_cxDiv(p16_cxFromDouble(a), b.value);
+	return b;
+}
+SOFTPOSIT_CONSTEXPR inline posit32 operator/(double a, posit32 b){
+	b.value = p32_cxDiv(p32_cxFromDouble(a), b.value);
 	return b;
 }
-inline posit16 operator*(int a, posit16 b){
+SOFTPOSIT_CONSTEXPR inline posit_2 operator/(double a, posit_2 b){
+	b.value = pX2_cxDiv(pX2_cxFromDouble(a, b.x), b.value, b.x);
+	return b;
+}
+inline posit64 operator/(double a, posit64 b){
+	b.value = castUI(p64_div(convertDoubleToP64(a), castP64(b.value)));
+	return b;
+}
+
+
+
+SOFTPOSIT_CONSTEXPR inline posit8 operator*(int a, posit8 b){
+	b.value = p8_cxMul(p8_cxFromI32(a), b.value);
+	return b;
+}
+SOFTPOSIT_CONSTEXPR inline posit16 operator*(int a, posit16 b){
 	posit16 ans;
-	ans.value = castUI(p16_mul(i32_to_p16(a), castP16(b.value)));
+	ans.value = p16_cxMul(p16_cxFromI32(a), b.value);
 	return ans;
 }
-inline posit32 operator*(int a, posit32 b){
-	b.value = castUI(p32_mul(i32_to_p32(a), castP32(b.value)));
+SOFTPOSIT_CONSTEXPR inline posit32 operator*(int a, posit32 b){
+	b.value = p32_cxMul(p32_cxFromI32(a), b.value);
+	return b;
+}
+SOFTPOSIT_CONSTEXPR inline posit32 operator*(long long int a, posit32 b){
+	b.value = p32_cxMul(p32_cxFromI64(a), b.value);
+	return b;
+}
+SOFTPOSIT_CONSTEXPR inline posit_2 operator*(int a, posit_2 b){
+	b.value = pX2_cxMul(pX2_cxFromI32(a, b.x), b.value, b.x);
 	return b;
 }
-inline posit32 operator*(long long int a, posit32 b){
-	b.value = castUI(p32_mul(i64_to_p32(a), castP32(b.value)));
+SOFTPOSIT_CONSTEXPR inline posit_2 operator*(long long int a, posit_2 b){
+	b.value = pX2_cxMul(pX2_cxFromI64(a, b.x), b.value, b.x);
 	return b;
 }
-inline posit_2 operator*(int a, posit_2 b){
-	b.value = castUI(pX2_mul(i32_to_pX2(a, b.x), castPX2(b.value), b.x));
+inline posit64 operator*(int a, posit64 b){
+	b.value = castUI(p64_mul(i32_to_p64(a), castP64(b.value)));
 	return b;
 }
-inline posit_2 operator*(long long int a, posit_2 b){
-	b.value = castUI(pX2_mul(i64_to_pX2(a, b.x), castPX2(b.value), b.x));
+inline posit64 operator*(long long int a, posit64 b){
+	b.value = castUI(p64_mul(i64_to_p64(a), castP64(b.value)));
 	return b;
 }
 
 
-inline posit8 operator*(double a, posit8 b){
-	b.value = castUI(p8_mul(convertDoubleToP8(a), castP8(b.value)));
+SOFTPOSIT_CONSTEXPR inline posit8 operator*(double a, posit8 b){
+	b.value = p8_cxMul(p8_cxFromDouble(a), b.value);
 	return b;
 }
-inline posit16 operator*(double a, posit16 b){
+SOFTPOSIT_CONSTEXPR inline posit16 operator*(double a, posit16 b){
 	posit16 ans;
-	ans.value = castUI(p16_mul(convertDoubleToP16(a), castP16(b.value)));
+	ans.value = p16_cxMul(p16_cxFromDouble(a), b.value);
 	return ans;
 }
-inline posit32 operator*(double a, posit32 b){
-	b.value = castUI(p32_mul(convertDoubleToP32(a), castP32(b.value)));
+SOFTPOSIT_CONSTEXPR inline posit32 operator*(double a, posit32 b){
+	b.value = p32_cxMul(p32_cxFromDouble(a), b.value);
+	return b;
+}
+SOFTPOSIT_CONSTEXPR inline posit_2 operator*(double a, posit_2 b){
+	b.value = pX2_cxMul(pX2_cxFromDouble(a, b.x), b.value, b.x);
 	return b;
 }
-inline posit_2 operator*(double a, posit_2 b){
-	b.value = castUI(pX2_mul(convertDoubleToPX2(a, b.x), castPX2(b.value), b.x));
+inline posit64 operator*(double a, posit64 b){
+	b.value = castUI(p64_mul(convertDoubleToP64(a), castP64(b.value)));
 	return b;
 }
 
 
 
 //fused-multiply-add
-inline posit8 fma(posit8 a, posit8 b, posit8 c){ // (a*b) + c
+SOFTPOSIT_CONSTEXPR inline posit8 fma(posit8 a, posit8 b, posit8 c){ // (a*b) + c
 	posit8 ans;
-	ans.value = castUI(p8_mulAdd(castP8(a.value), castP8(b.value), castP8(c.value)));
+	ans.value = p8_cxMulAdd(a.value, b.value, c.value);
 	return ans;
 }
-inline posit16 fma(posit16 a, posit16 b, posit16 c){ // (a*b) + c
+SOFTPOSIT_CONSTEXPR inline posit16 fma(posit16 a, posit16 b, posit16 c){ // (a*b) + c
 	posit16 ans;
-	ans.value = castUI(p16_mulAdd(castP16(a.value), castP16(b.value), castP16(c.value)));
+	ans.value = p16_cxMulAdd(a.value, b.value, c.value);
 	return ans;
 }
-inline posit32 fma(posit32 a, posit32 b, posit32 c){ // (a*b) + c
+SOFTPOSIT_CONSTEXPR inline posit32 fma(posit32 a, posit32 b, posit32 c){ // (a*b) + c
 	posit32 ans;
-	ans.value = castUI(p32_mulAdd(castP32(a.value), castP32(b.value), castP32(c.value)));
+	ans.value = p32_cxMulAdd(a.value, b.value, c.value);
 	return ans;
 }
-inline posit_2 fma(posit_2 a, posit_2 b, posit_2 c){ // (a*b) + c
+SOFTPOSIT_CONSTEXPR inline posit_2 fma(posit_2 a, posit_2 b, posit_2 c){ // (a*b) + c
 	posit_2 ans;
-	ans.value = castUI(pX2_mulAdd(castPX2(a.value), castPX2(b.value), castPX2(c.value), c.x));
+	ans.value = pX2_cxMulAdd(a.value, b.value, c.value, c.x);
 	ans.x = c.x;
 	return ans;
 }
+inline posit64 fma(posit64 a, posit64 b, posit64 c){ // (a*b) + c
+	posit64 ans;
+	ans.value = castUI(p64_mulAdd(castP64(a.value), castP64(b.value), castP64(c.value)));
+	return ans;
+}
 
 
 //Round to nearest integer
@@ -1441,29 +2457,81 @@ inline posit_2 rint(posit_2 a){
 	ans.x = a.x;
 	return ans;
 }
+inline posit64 rint(posit64 a){
+	posit64 ans;
+	ans.value = castUI( p64_roundToInt(castP64(a.value)) );
+	return ans;
+}
 
 //Square root
-inline posit8 sqrt(posit8 a){
+SOFTPOSIT_CONSTEXPR inline posit8 sqrt(posit8 a){
 	posit8 ans;
-	ans.value = castUI( p8_sqrt(castP8(a.value)) );
+	ans.value = p8_cxSqrt(a.value);
 	return ans;
 }
-inline posit16 sqrt(posit16 a){
+SOFTPOSIT_CONSTEXPR inline posit16 sqrt(posit16 a){
 	posit16 ans;
-	ans.value = castUI( p16_sqrt(castP16(a.value)) );
+	ans.value = p16_cxSqrt(a.value);
 	return ans;
 }
-inline posit32 sqrt(posit32 a){
+SOFTPOSIT_CONSTEXPR inline posit32 sqrt(posit32 a){
 	posit32 ans;
-	ans.value = castUI( p32_sqrt(castP32(a.value)) );
+	ans.value = p32_cxSqrt(a.value);
 	return ans;
 }
-inline posit_2 sqrt(posit_2 a){
+SOFTPOSIT_CONSTEXPR inline posit_2 sqrt(posit_2 a){
 	posit_2 ans;
-	ans.value = castUI( pX2_sqrt(castPX2(a.value), a.x) );
+	ans.value = pX2_cxSqrt(a.value, a.x);
 	ans.x = a.x;
 	return ans;
 }
+inline posit64 sqrt(posit64 a){
+	posit64 ans;
+	ans.value = castUI( p64_sqrt(castP64(a.value)) );
+	return ans;
+}
+
+//Plain arithmetic keeps its rounded posit32 results, and an explicit product
+//stays usable wherever the posit32 it rounds to would be
+#define SOFTPOSIT_P32_PROD_OP(expr, type) \
+	static_assert(std::is_same<decltype(expr), type>::value, "p32_prod must support " #expr)
+#define SOFTPOSIT_P32_PROD std::declval<p32_prod>()
+#define SOFTPOSIT_P32 std::declval<posit32>()
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32 * SOFTPOSIT_P32, posit32);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32 * SOFTPOSIT_P32 + SOFTPOSIT_P32, posit32);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32_PROD / SOFTPOSIT_P32, posit32);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32 / SOFTPOSIT_P32_PROD, posit32);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32_PROD / SOFTPOSIT_P32_PROD, posit32);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32_PROD / 2, posit32);
+SOFTPOSIT_P32_PROD_OP(2.0 / SOFTPOSIT_P32_PROD, posit32);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32_PROD * SOFTPOSIT_P32, posit32);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32 * SOFTPOSIT_P32_PROD, posit32);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32_PROD << 1, posit32);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32_PROD >> 1, posit32);
+SOFTPOSIT_P32_PROD_OP(~SOFTPOSIT_P32_PROD, posit32);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32_PROD & SOFTPOSIT_P32, posit32);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32_PROD | SOFTPOSIT_P32, posit32);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32_PROD ^ SOFTPOSIT_P32, posit32);
+SOFTPOSIT_P32_PROD_OP(!SOFTPOSIT_P32_PROD, bool);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32_PROD && SOFTPOSIT_P32, bool);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32_PROD || SOFTPOSIT_P32, bool);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32_PROD < SOFTPOSIT_P32, bool);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32_PROD == 0.5, bool);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32_PROD.sqrt(), posit32);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32_PROD.rint(), posit32);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32_PROD.fma(SOFTPOSIT_P32, SOFTPOSIT_P32), posit32);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32_PROD.toDouble(), double);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32_PROD.toInt(), long long int);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32_PROD.toRInt(), long long int);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32_PROD.isNaR(), bool);
+SOFTPOSIT_P32_PROD_OP(sqrt(SOFTPOSIT_P32_PROD), posit32);
+SOFTPOSIT_P32_PROD_OP(rint(SOFTPOSIT_P32_PROD), posit32);
+SOFTPOSIT_P32_PROD_OP(fma(SOFTPOSIT_P32_PROD, SOFTPOSIT_P32, SOFTPOSIT_P32), posit32);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32 += SOFTPOSIT_P32_PROD, posit32&);
+SOFTPOSIT_P32_PROD_OP(SOFTPOSIT_P32 /= SOFTPOSIT_P32_PROD, posit32&);
+#undef SOFTPOSIT_P32
+#undef SOFTPOSIT_P32_PROD
+#undef SOFTPOSIT_P32_PROD_OP
 
 
 
@@ -1481,6 +2549,9 @@ inline uint32_t uint32 (posit32 a){
 inline uint32_t uint32 (posit_2 a){
 	return pX2_to_ui32(castPX2(a.value));
 }
+inline uint32_t uint32 (posit64 a){
+	return p64_to_ui32(castP64(a.value));
+}
 
 
 
@@ -1496,6 +2567,9 @@ inline int32_t int32 (posit32 a){
 inline int32_t int32 (posit_2 a){
 	return pX2_to_i32(castPX2(a.value));
 }
+inline int32_t int32 (posit64 a){
+	return p64_to_i32(castP64(a.value));
+}
 
 
 
@@ -1511,6 +2585,9 @@ inline uint64_t uint64 (posit32 a){
 inline uint64_t uint64 (posit_2 a){
 	return pX2_to_ui64(castPX2(a.value));
 }
+inline uint64_t uint64 (posit64 a){
+	return p64_to_ui64(castP64(a.value));
+}
 
 
 
@@ -1526,6 +2603,9 @@ inline int64_t int64 (posit32 a){
 inline int64_t int64 (posit_2 a){
 	return pX2_to_i64(castPX2(a.value));
 }
+inline int64_t int64 (posit64 a){
+	return p64_to_i64(castP64(a.value));
+}
 
 
 //Convert To Posit
@@ -1544,6 +2624,11 @@ inline posit8 p8(posit_2 a){
 	b.value = castUI(pX2_to_p8(castPX2(a.value)));
 	return b;
 }
+inline posit8 p8(posit64 a){
+	posit8 b;
+	b.value = castUI(p64_to_p8(castP64(a.value)));
+	return b;
+}
 
 
 inline posit16 p16(posit8 a){
@@ -1561,6 +2646,11 @@ inline posit16 p16(posit_2 a){
 	b.value = castUI(pX2_to_p16(castPX2(a.value)));
 	return b;
 }
+inline posit16 p16(posit64 a){
+	posit16 b;
+	b.value = castUI(p64_to_p16(castP64(a.value)));
+	return b;
+}
 
 
 inline posit32 p32(posit8 a){
@@ -1578,6 +2668,11 @@ inline posit32 p32(posit_2 a){
 	b.value = castUI(pX2_to_p32(castPX2(a.value)));
 	return b;
 }
+inline posit32 p32(posit64 a){
+	posit32 b;
+	b.value = castUI(p64_to_p32(castP64(a.value)));
+	return b;
+}
 
 
 inline posit_2 pX2(posit8 a, int x){
@@ -1604,6 +2699,34 @@ inline posit_2 pX2(posit_2 a, int x){
 	b.x = x;
 	return b;
 }
+inline posit_2 pX2(posit64 a, int x){
+	posit_2 b;
+	b.value = castUI(p64_to_pX2(castP64(a.value), x));
+	b.x = x;
+	return b;
+}
+
+
+inline posit64 p64(posit8 a){
+	posit64 b;
+	b.value = castUI(p8_to_p64(castP8(a.value)));
+	return b;
+}
+inline posit64 p64(posit16 a){
+	posit64 b;
+	b.value = castUI(p16_to_p64(castP16(a.value)));
+	return b;
+}
+inline posit64 p64(posit32 a){
+	posit64 b;
+	b.value = castUI(p32_to_p64(castP32(a.value)));
+	return b;
+}
+inline posit64 p64(posit_2 a){
+	posit64 b;
+	b.value = castUI(pX2_to_p64(castPX2(a.value)));
+	return b;
+}
 
 
 
@@ -1628,29 +2751,39 @@ inline posit_2 pX2(uint32_t a, int x){
 	b.x = x;
 	return b;
 }
+inline posit64 p64(uint32_t a){
+	posit64 b;
+	b.value = castUI(ui32_to_p64(a));
+	return b;
+}
 
 
-inline posit8 p8(int32_t a){
+SOFTPOSIT_CONSTEXPR inline posit8 p8(int32_t a){
 	posit8 b;
-	b.value = castUI(i32_to_p8(a));
+	b.value = p8_cxFromI32(a);
 	return b;
 }
-inline posit16 p16(int32_t a){
+SOFTPOSIT_CONSTEXPR inline posit16 p16(int32_t a){
 	posit16 b;
-	b.value = castUI(i32_to_p16(a));
+	b.value = p16_cxFromI32(a);
 	return b;
 }
-inline posit32 p32(int32_t a){
+SOFTPOSIT_CONSTEXPR inline posit32 p32(int32_t a){
 	posit32 b;
-	b.value = castUI(i32_to_p32(a));
+	b.value = p32_cxFromI32(a);
 	return b;
 }
-inline posit_2 pX2(int32_t a, int x){
+SOFTPOSIT_CONSTEXPR inline posit_2 pX2(int32_t a, int x){
 	posit_2 b;
-	b.value = castUI(i32_to_pX2(a, x));
+	b.value = pX2_cxFromI32(a, x);
 	b.x = x;
 	return b;
 }
+inline posit64 p64(int32_t a){
+	posit64 b;
+	b.value = castUI(i32_to_p64(a));
+	return b;
+}
 
 
 
@@ -1675,52 +2808,67 @@ inline posit_2 pX2(uint64_t a, int x){
 	b.x = x;
 	return b;
 }
+inline posit64 p64(uint64_t a){
+	posit64 b;
+	b.value = castUI(ui64_to_p64(a));
+	return b;
+}
 
 
-inline posit8 p8(int64_t a){
+SOFTPOSIT_CONSTEXPR inline posit8 p8(int64_t a){
 	posit8 b;
-	b.value = castUI(i64_to_p8(a));
+	b.value = p8_cxFromI64(a);
 	return b;
 }
-inline posit16 p16(int64_t a){
+SOFTPOSIT_CONSTEXPR inline posit16 p16(int64_t a){
 	posit16 b;
-	b.value = castUI(i64_to_p16(a));
+	b.value = p16_cxFromI64(a);
 	return b;
 }
-inline posit32 p32(int64_t a){
+SOFTPOSIT_CONSTEXPR inline posit32 p32(int64_t a){
 	posit32 b;
-	b.value = castUI(i64_to_p32(a));
+	b.value = p32_cxFromI64(a);
 	return b;
 }
-inline posit_2 p32(int64_t a, int x){
+SOFTPOSIT_CONSTEXPR inline posit_2 p32(int64_t a, int x){
 	posit_2 b;
-	b.value = castUI(i64_to_pX2(a, x));
+	b.value = pX2_cxFromI64(a, x);
 	b.x = x;
 	return b;
 }
+inline posit64 p64(int64_t a){
+	posit64 b;
+	b.value = castUI(i64_to_p64(a));
+	return b;
+}
 
 
-inline posit8 p8(double a){
+SOFTPOSIT_CONSTEXPR inline posit8 p8(double a){
 	posit8 b;
-	b.value = castUI(convertDoubleToP8(a));
+	b.value = p8_cxFromDouble(a);
 	return b;
 }
-inline posit16 p16(double a){
+SOFTPOSIT_CONSTEXPR inline posit16 p16(double a){
 	posit16 b;
-	b.value = castUI(convertDoubleToP16(a));
+	b.value = p16_cxFromDouble(a);
 	return b;
 }
-inline posit32 p32(double a){
+SOFTPOSIT_CONSTEXPR inline posit32 p32(double a){
 	posit32 b;
-	b.value = castUI(convertDoubleToP32(a));
+	b.value = p32_cxFromDouble(a);
 	return b;
 }
-inline posit_2 pX2(double a, int x){
+SOFTPOSIT_CONSTEXPR inline posit_2 pX2(double a, int x){
 	posit_2 b;
-	b.value = castUI(convertDoubleToPX2(a, x));
+	b.value = pX2_cxFromDouble(a, x);
 	b.x = x;
 	return b;
 }
+inline posit64 p64(double a){
+	posit64 b;
+	b.value = castUI(convertDoubleToP64(a));
+	return b;
+}
 
 
 
@@ -1751,7 +2899,1109 @@ inline posit_2 pX2(quire_2 a, int x){
 	b.x = x;
 	return b;
 }
+inline posit64 p64(quire64 a){
+	return a.toPosit();
+}
+
+
+//std::complex<posit16> and std::complex<posit32>; the non-member
+//std::complex operators are built on the members below.
+namespace std{
+
+template<> class complex<posit16>{
+public:
+	typedef posit16 value_type;
+
+	complex(const posit16 &re=posit16(), const posit16 &im=posit16()) : re(re), im(im) {
+	}
+
+	posit16 real() const{
+		return re;
+	}
+	posit16 imag() const{
+		return im;
+	}
+	void real(posit16 a){
+		re = a;
+	}
+	void imag(posit16 a){
+		im = a;
+	}
+
+	complex& operator=(const posit16 &a){
+		re = a;
+		im = posit16();
+		return *this;
+	}
+	complex& operator+=(const posit16 &a){
+		re += a;
+		return *this;
+	}
+	complex& operator-=(const posit16 &a){
+		re -= a;
+		return *this;
+	}
+	complex& operator*=(const posit16 &a){
+		re *= a;
+		im *= a;
+		return *this;
+	}
+	complex& operator/=(const posit16 &a){
+		re /= a;
+		im /= a;
+		return *this;
+	}
+
+	complex& operator+=(const complex &a){
+		return *this = fromC(cp16_add(toC(), a.toC()));
+	}
+	complex& operator-=(const complex &a){
+		return *this = fromC(cp16_sub(toC(), a.toC()));
+	}
+	//Each component rounded once from the quire
+	complex& operator*=(const complex &a){
+		return *this = fromC(cp16_mul(toC(), a.toC()));
+	}
+	complex& operator/=(const complex &a){
+		return *this = fromC(cp16_div(toC(), a.toC()));
+	}
+
+	cposit16_t toC() const{
+		cposit16_t z;
+		z.re = castP16(re.value);
+		z.im = castP16(im.value);
+		return z;
+	}
+	static complex fromC(cposit16_t a){
+		complex z;
+		z.re.value = castUI(a.re);
+		z.im.value = castUI(a.im);
+		return z;
+	}
+
+private:
+	posit16 re;
+	posit16 im;
+};
+
+template<> class complex<posit32>{
+public:
+	typedef posit32 value_type;
+
+	complex(const posit32 &re=posit32(), const posit32 &im=posit32()) : re(re), im(im) {
+	}
+
+	posit32 real() const{
+		return re;
+	}
+	posit32 imag() const{
+		return im;
+	}
+	void real(posit32 a){
+		re = a;
+	}
+	void imag(posit32 a){
+		im = a;
+	}
+
+	complex& operator=(const posit32 &a){
+		re = a;
+		im = posit32();
+		return *this;
+	}
+	complex& operator+=(const posit32 &a){
+		re += a;
+		return *this;
+	}
+	complex& operator-=(const posit32 &a){
+		re -= a;
+		return *this;
+	}
+	complex& operator*=(const posit32 &a){
+		re *= a;
+		im *= a;
+		return *this;
+	}
+	complex& operator/=(const posit32 &a){
+		re /= a;
+		im /= a;
+		return *this;
+	}
+
+	complex& operator+=(const complex &a){
+		return *this = fromC(cp32_add(toC(), a.toC()));
+	}
+	complex& operator-=(const complex &a){
+		return *this = fromC(cp32_sub(toC(), a.toC()));
+	}
+	//Each component rounded once from the quire
+	complex& operator*=(const complex &a){
+		return *this = fromC(cp32_mul(toC(), a.toC()));
+	}
+	complex& operator/=(const complex &a){
+		return *this = fromC(cp32_div(toC(), a.toC()));
+	}
+
+	cposit32_t toC() const{
+		cposit32_t z;
+		z.re = castP32(re.value);
+		z.im = castP32(im.value);
+		return z;
+	}
+	static complex fromC(cposit32_t a){
+		complex z;
+		z.re.value = castUI(a.re);
+		z.im.value = castUI(a.im);
+		return z;
+	}
+
+private:
+	posit32 re;
+	posit32 im;
+};
+
+}
+
+inline posit16 abs(const std::complex<posit16> &a){
+	posit16 z;
+	z.value = castUI(cp16_abs(a.toC()));
+	return z;
+}
+inline posit16 norm(const std::complex<posit16> &a){
+	posit16 z;
+	z.value = castUI(cp16_norm(a.toC()));
+	return z;
+}
+inline std::complex<posit16> conj(const std::complex<posit16> &a){
+	return std::complex<posit16>::fromC(cp16_conj(a.toC()));
+}
+//sum of conj(a[i])*b[i], each component rounded once
+inline std::complex<posit16> dotc(const std::complex<posit16> *a, const std::complex<posit16> *b, size_t n){
+	quire16_t qR = q16Clr(), qI = q16Clr();
+	for (size_t i=0; i<n; i++){
+		cposit16_t x = a[i].toC(), y = b[i].toC();
+		qR = q16_fdp_add(q16_fdp_add(qR, x.re, y.re), x.im, y.im);
+		qI = q16_fdp_sub(q16_fdp_add(qI, x.re, y.im), x.im, y.re);
+	}
+	posit16 re, im;
+	re.value = castUI(q16_to_p16(qR));
+	im.value = castUI(q16_to_p16(qI));
+	return std::complex<posit16>(re, im);
+}
+
+inline posit32 abs(const std::complex<posit32> &a){
+	posit32 z;
+	z.value = castUI(cp32_abs(a.toC()));
+	return z;
+}
+inline posit32 norm(const std::complex<posit32> &a){
+	posit32 z;
+	z.value = castUI(cp32_norm(a.toC()));
+	return z;
+}
+inline std::complex<posit32> conj(const std::complex<posit32> &a){
+	return std::complex<posit32>::fromC(cp32_conj(a.toC()));
+}
+//sum of conj(a[i])*b[i], each component rounded once
+inline std::complex<posit32> dotc(const std::complex<posit32> *a, const std::complex<posit32> *b, size_t n){
+	quire32_t qR = q32Clr(), qI = q32Clr();
+	for (size_t i=0; i<n; i++){
+		cposit32_t x = a[i].toC(), y = b[i].toC();
+		qR = q32_fdp_add(q32_fdp_add(qR, x.re, y.re), x.im, y.im);
+		qI = q32_fdp_sub(q32_fdp_add(qI, x.re, y.im), x.im, y.re);
+	}
+	posit32 re, im;
+	re.value = castUI(q32_to_p32(qR));
+	im.value = castUI(q32_to_p32(qI));
+	return std::complex<posit32>(re, im);
+}
+
+//Generic math.  The functions below are templates restricted to the posit
+//types, so that they never compete with the double overloads of math.h for
+//int or double arguments.  namespace std forwards to them further down,
+//which lets std::abs(x), std::floor(x), ... and generic code written as
+//"using std::sqrt; sqrt(x)" instantiate on posits.  NaR propagates like NaN.
+template<class P> struct softposit_isPosit : std::false_type{};
+template<> struct softposit_isPosit<posit8> : std::true_type{};
+template<> struct softposit_isPosit<posit16> : std::true_type{};
+template<> struct softposit_isPosit<posit32> : std::true_type{};
+template<> struct softposit_isPosit<posit64> : std::true_type{};
+
+template<class P, class R=P> using softposit_ifPosit = typename std::enable_if<softposit_isPosit<P>::value, R>::type;
+
+template<class P> SOFTPOSIT_CONSTEXPR inline softposit_ifPosit<P> abs(P a){
+	return a < P(0) ? -a : a;
+}
+template<class P> SOFTPOSIT_CONSTEXPR inline softposit_ifPosit<P> fabs(P a){
+	return abs(a);
+}
+template<class P> SOFTPOSIT_CONSTEXPR inline softposit_ifPosit<P> copysign(P a, P b){
+	return (a.isNaR() || (a < P(0)) == (b < P(0))) ? a : -a;
+}
+template<class P> SOFTPOSIT_CONSTEXPR inline softposit_ifPosit<P, bool> signbit(P a){
+	return a < P(0);
+}
+template<class P> SOFTPOSIT_CONSTEXPR inline softposit_ifPosit<P, bool> isnan(P a){
+	return a.isNaR();
+}
+template<class P> SOFTPOSIT_CONSTEXPR inline softposit_ifPosit<P, bool> isinf(P){
+	return false;
+}
+template<class P> SOFTPOSIT_CONSTEXPR inline softposit_ifPosit<P, bool> isfinite(P a){
+	return !a.isNaR();
+}
+template<class P> SOFTPOSIT_CONSTEXPR inline softposit_ifPosit<P, bool> isnormal(P a){
+	return !a.isNaR() && a.value != 0;
+}
+
+//Like IEEE 754 minNum/maxNum, a NaR operand gives the other one
+template<class P> SOFTPOSIT_CONSTEXPR inline softposit_ifPosit<P> fmin(P a, P b){
+	return a.isNaR() ? b : (b.isNaR() || a < b) ? a : b;
+}
+template<class P> SOFTPOSIT_CONSTEXPR inline softposit_ifPosit<P> fmax(P a, P b){
+	return a.isNaR() ? b : (b.isNaR() || b < a) ? a : b;
+}
+
+//Adjacent posits are adjacent integers, so the step is on the bit pattern
+template<class P> SOFTPOSIT_CONSTEXPR inline softposit_ifPosit<P> nextafter(P a, P b){
+	if (a.isNaR() || b.isNaR()) return a.toNaR();
+	if (a < b) a.value = a.value + 1;
+	else if (b < a) a.value = a.value - 1;
+	return a;
+}
+
+//rint is exact, and so is stepping an integer-valued posit by one below the
+//width where every posit is already an integer
+template<class P> inline softposit_ifPosit<P> floor(P a){
+	P r = rint(a);
+	return a < r ? r - P(1) : r;
+}
+template<class P> inline softposit_ifPosit<P> ceil(P a){
+	P r = rint(a);
+	return r < a ? r + P(1) : r;
+}
+template<class P> inline softposit_ifPosit<P> trunc(P a){
+	return a < P(0) ? ceil(a) : floor(a);
+}
+//Halfway cases away from zero
+template<class P> inline softposit_ifPosit<P> round(P a){
+	P r = trunc(a);
+	if (abs(a - r) >= P(0.5)) r = a < P(0) ? r - P(1) : r + P(1);
+	return r;
+}
+
+#define SOFTPOSIT_MATH1(P, w, fn) \
+inline P fn(P a){ \
+	a.value = castUI(p##w##_##fn(castP##w(a.value))); \
+	return a; \
+}
+#define SOFTPOSIT_MATH2(P, w, fn) \
+inline P fn(P a, P b){ \
+	a.value = castUI(p##w##_##fn(castP##w(a.value), castP##w(b.value))); \
+	return a; \
+}
+SOFTPOSIT_MATH1(posit8, 8, exp) SOFTPOSIT_MATH1(posit8, 8, log)
+SOFTPOSIT_MATH1(posit8, 8, sin) SOFTPOSIT_MATH1(posit8, 8, cos) SOFTPOSIT_MATH1(posit8, 8, tanh)
+SOFTPOSIT_MATH1(posit16, 16, exp) SOFTPOSIT_MATH1(posit16, 16, log)
+SOFTPOSIT_MATH1(posit16, 16, sin) SOFTPOSIT_MATH1(posit16, 16, cos) SOFTPOSIT_MATH1(posit16, 16, tanh)
+SOFTPOSIT_MATH1(posit32, 32, exp) SOFTPOSIT_MATH1(posit32, 32, exp2) SOFTPOSIT_MATH1(posit32, 32, log) SOFTPOSIT_MATH1(posit32, 32, log2)
+SOFTPOSIT_MATH1(posit32, 32, sin) SOFTPOSIT_MATH1(posit32, 32, cos) SOFTPOSIT_MATH1(posit32, 32, tanh)
+SOFTPOSIT_MATH2(posit32, 32, pow) SOFTPOSIT_MATH2(posit32, 32, atan2)
+SOFTPOSIT_MATH1(posit64, 64, exp) SOFTPOSIT_MATH1(posit64, 64, exp2) SOFTPOSIT_MATH1(posit64, 64, log) SOFTPOSIT_MATH1(posit64, 64, log2)
+SOFTPOSIT_MATH1(posit64, 64, sin) SOFTPOSIT_MATH1(posit64, 64, cos) SOFTPOSIT_MATH1(posit64, 64, tanh)
+SOFTPOSIT_MATH2(posit64, 64, pow) SOFTPOSIT_MATH2(posit64, 64, atan2)
+#undef SOFTPOSIT_MATH1
+#undef SOFTPOSIT_MATH2
+
+//What std::numeric_limits has in common across the posit formats: no
+//infinity, no subnormals, a single NaR standing in for quiet_NaN (and for
+//infinity, which callers must not rely on since has_infinity is false)
+template<class P> struct softposit_numericLimits{
+	static constexpr bool is_specialized = true;
+	static constexpr bool is_signed = true;
+	static constexpr bool is_integer = false;
+	static constexpr bool is_exact = false;
+	static constexpr bool has_infinity = false;
+	static constexpr bool has_quiet_NaN = true;
+	static constexpr bool has_signaling_NaN = false;
+	static constexpr std::float_denorm_style has_denorm = std::denorm_absent;
+	static constexpr bool has_denorm_loss = false;
+	static constexpr std::float_round_style round_style = std::round_to_nearest;
+	static constexpr bool is_iec559 = false;
+	static constexpr bool is_bounded = true;
+	static constexpr bool is_modulo = false;
+	static constexpr int radix = 2;
+	static constexpr bool traps = false;
+	static constexpr bool tinyness_before = false;
+
+	static SOFTPOSIT_CONSTEXPR P min() noexcept{
+		return bits(1);
+	}
+	static SOFTPOSIT_CONSTEXPR P max() noexcept{
+		return bits(mask() - 1);
+	}
+	static SOFTPOSIT_CONSTEXPR P lowest() noexcept{
+		return -max();
+	}
+	static SOFTPOSIT_CONSTEXPR P round_error() noexcept{
+		return P(0.5);
+	}
+	static SOFTPOSIT_CONSTEXPR P infinity() noexcept{
+		return bits(mask());
+	}
+	static SOFTPOSIT_CONSTEXPR P quiet_NaN() noexcept{
+		return bits(mask());
+	}
+	static SOFTPOSIT_CONSTEXPR P signaling_NaN() noexcept{
+		return bits(mask());
+	}
+	static SOFTPOSIT_CONSTEXPR P denorm_min() noexcept{
+		return bits(1);
+	}
+
+protected:
+	typedef decltype(P().value) ui;
+	//The sign bit alone, i.e. NaR
+	static constexpr ui mask() noexcept{
+		return ui(ui(1) << (8*sizeof(ui) - 1));
+	}
+	static SOFTPOSIT_CONSTEXPR P bits(ui v) noexcept{
+		P a;
+		a.value = v;
+		return a;
+	}
+};
+
+template<class P> struct softposit_hash{
+	size_t operator()(const P &a) const noexcept{
+		return std::hash<decltype(a.value)>()(a.value);
+	}
+};
+
+namespace std{
+
+template<> class numeric_limits<posit8> : public softposit_numericLimits<posit8>{
+public:
+	static constexpr int digits = 6;
+	static constexpr int digits10 = 1;
+	static constexpr int max_digits10 = 3;
+	static constexpr int min_exponent = -5;
+	static constexpr int min_exponent10 = -1;
+	static constexpr int max_exponent = 7;
+	static constexpr int max_exponent10 = 1;
+
+	static SOFTPOSIT_CONSTEXPR posit8 epsilon() noexcept{ // 2^-5
+		return bits(0x2);
+	}
+};
+
+template<> class numeric_limits<posit16> : public softposit_numericLimits<posit16>{
+public:
+	static constexpr int digits = 13;
+	static constexpr int digits10 = 3;
+	static constexpr int max_digits10 = 5;
+	static constexpr int min_exponent = -27;
+	static constexpr int min_exponent10 = -8;
+	static constexpr int max_exponent = 29;
+	static constexpr int max_exponent10 = 8;
+
+	static SOFTPOSIT_CONSTEXPR posit16 epsilon() noexcept{ // 2^-12
+		return bits(0x100);
+	}
+};
+
+template<> class numeric_limits<posit32> : public softposit_numericLimits<posit32>{
+public:
+	static constexpr int digits = 28;
+	static constexpr int digits10 = 8;
+	static constexpr int max_digits10 = 10;
+	static constexpr int min_exponent = -119;
+	static constexpr int min_exponent10 = -36;
+	static constexpr int max_exponent = 121;
+	static constexpr int max_exponent10 = 36;
+
+	static SOFTPOSIT_CONSTEXPR posit32 epsilon() noexcept{ // 2^-27
+		return bits(0xA00000);
+	}
+};
+
+template<> class numeric_limits<posit64> : public softposit_numericLimits<posit64>{
+public:
+	static constexpr int digits = 60;
+	static constexpr int digits10 = 17;
+	static constexpr int max_digits10 = 20;
+	static constexpr int min_exponent = -247;
+	static constexpr int min_exponent10 = -74;
+	static constexpr int max_exponent = 249;
+	static constexpr int max_exponent10 = 74;
+
+	static posit64 epsilon() noexcept{ // 2^-59
+		return bits(0x0000A00000000000);
+	}
+};
+
+template<> struct hash<posit8> : softposit_hash<posit8>{};
+template<> struct hash<posit16> : softposit_hash<posit16>{};
+template<> struct hash<posit32> : softposit_hash<posit32>{};
+template<> struct hash<posit64> : softposit_hash<posit64>{};
+//Equality on posit_2 compares the pattern only
+template<> struct hash<posit_2> : softposit_hash<posit_2>{};
+
+using ::abs; using ::fabs; using ::sqrt; using ::fma; using ::rint;
+using ::floor; using ::ceil; using ::trunc; using ::round; using ::nextafter;
+using ::fmin; using ::fmax; using ::copysign; using ::signbit;
+using ::isnan; using ::isinf; using ::isfinite; using ::isnormal;
+using ::exp; using ::exp2; using ::log; using ::log2; using ::pow;
+using ::sin; using ::cos; using ::tanh; using ::atan2;
+
+}
+
+/*----------------------------------------------------------------------------
+| posit_array<T>: a contiguous, 64-byte aligned array of posit8, posit16,
+| posit32 or posit64 with whole-array arithmetic.  a + b, a * s, ... do not
+| compute anything; they build an expression, which is evaluated when it is
+| assigned to (or constructs) a posit_array.  Evaluation walks the operands
+| once, SOFTPOSIT_ARRAY_BLOCK elements at a time: every operation of the
+| expression runs the batch kernel (p32_add_n, ...) on a block that is
+| still in L1, and only the result block is written back.  a*b + c goes to
+| p32_mulAdd_n and, like the posit32 expression templates, is rounded once.
+| dot, sum, min and max reduce arrays or expressions the same way; dot and
+| sum are exact in the quire and round once.  Operands of one expression
+| must have the same size; building an expression or a dot product from
+| arrays of different sizes throws std::length_error.  The destination may
+| appear in the expression.
+*----------------------------------------------------------------------------*/
+#ifndef SOFTPOSIT_ARRAY_BLOCK
+#define SOFTPOSIT_ARRAY_BLOCK 256
+#endif
+
+//64-byte aligned heap blocks; the pointer malloc returned sits just below
+inline void* softposit_alignedAlloc(size_t bytes){
+	if (bytes > std::numeric_limits<size_t>::max() - 63 - sizeof(void*)) throw std::bad_array_new_length();
+	void *raw = std::malloc(bytes + 63 + sizeof(void*));
+	if (!raw) throw std::bad_alloc();
+	uintptr_t p = (reinterpret_cast<uintptr_t>(raw) + sizeof(void*) + 63) & ~(uintptr_t) 63;
+	reinterpret_cast<void**>(p)[-1] = raw;
+	return reinterpret_cast<void*>(p);
+}
+inline void softposit_alignedFree(void *p){
+	if (p) std::free(static_cast<void**>(p)[-1]);
+}
 
+//The default posit_array allocator
+template<class T> struct softposit_alignedAllocator{
+	typedef T value_type;
+
+	softposit_alignedAllocator(){
+	}
+	template<class U> softposit_alignedAllocator(const softposit_alignedAllocator<U>&){
+	}
+
+	T* allocate(size_t n){
+		if (n > std::numeric_limits<size_t>::max() / sizeof(T)) throw std::bad_array_new_length();
+		return static_cast<T*>(softposit_alignedAlloc(n*sizeof(T)));
+	}
+	void deallocate(T *p, size_t){
+		softposit_alignedFree(p);
+	}
+	bool operator==(const softposit_alignedAllocator&) const{
+		return true;
+	}
+	bool operator!=(const softposit_alignedAllocator&) const{
+		return false;
+	}
+};
+
+//Bump allocator for many short-lived arrays.  Allocations are 64-byte
+//aligned slices of large chunks; nothing is returned until reset() or the
+//destructor, which free every chunk at once.
+class softposit_arena{
+public:
+	explicit softposit_arena(size_t chunkBytes=1<<20) : chunkBytes(chunkBytes), head(0), used(0), cap(0){
+	}
+	~softposit_arena(){
+		reset();
+	}
+	softposit_arena(const softposit_arena&) = delete;
+	softposit_arena& operator=(const softposit_arena&) = delete;
+
+	void* allocate(size_t bytes){
+		//Room for the rounding below and the chunk header in grow()
+		if (bytes > std::numeric_limits<size_t>::max() - 128) throw std::bad_array_new_length();
+		bytes = (bytes + 63) & ~(size_t) 63;
+		if (!head || cap-used < bytes) grow(bytes);
+		void *p = reinterpret_cast<char*>(head) + used;
+		used += bytes;
+		return p;
+	}
+	void reset(){
+		while (head){
+			chunk *next = head->next;
+			softposit_alignedFree(head);
+			head = next;
+		}
+		used = cap = 0;
+	}
+
+private:
+	//Chunk header, padded to 64 bytes so the slices stay aligned
+	struct chunk{
+		chunk *next;
+	};
+	void grow(size_t bytes){
+		size_t size = 64 + (bytes > chunkBytes ? bytes : chunkBytes);
+		chunk *c = static_cast<chunk*>(softposit_alignedAlloc(size));
+		c->next = head;
+		head = c;
+		used = 64;
+		cap = size;
+	}
+
+	size_t chunkBytes;
+	chunk *head;
+	size_t used, cap;
+};
+
+template<class T> struct softposit_arenaAllocator{
+	typedef T value_type;
+	softposit_arena *arena;
+
+	softposit_arenaAllocator(softposit_arena &arena) : arena(&arena){
+	}
+	template<class U> softposit_arenaAllocator(const softposit_arenaAllocator<U> &a) : arena(a.arena){
+	}
+
+	T* allocate(size_t n){
+		if (n > std::numeric_limits<size_t>::max() / sizeof(T)) throw std::bad_array_new_length();
+		return static_cast<T*>(arena->allocate(n*sizeof(T)));
+	}
+	void deallocate(T*, size_t){
+	}
+	bool operator==(const softposit_arenaAllocator &a) const{
+		return arena == a.arena;
+	}
+	bool operator!=(const softposit_arenaAllocator &a) const{
+		return arena != a.arena;
+	}
+};
+
+//Batch kernels and quire per element type.  The C++ types share the
+//layout of their C counterparts, so arrays are passed to the kernels as is.
+template<class T> struct softposit_batch;
+
+#define SOFTPOSIT_BATCH(w) \
+static_assert(std::is_trivially_copyable<posit##w>::value && sizeof(posit##w)==sizeof(posit##w##_t), "posit" #w " must keep the posit" #w "_t layout"); \
+template<> struct softposit_batch<posit##w>{ \
+	typedef posit##w T; \
+	typedef posit##w##_t C; \
+	typedef quire##w##_t Q; \
+	static const C* c(const T *a){ \
+		return reinterpret_cast<const C*>(a); \
+	} \
+	static C* c(T *a){ \
+		return reinterpret_cast<C*>(a); \
+	} \
+	static void add(const T *a, const T *b, size_t n, T *z){ \
+		p##w##_add_n(c(a), c(b), n, c(z)); \
+	} \
+	static void sub(const T *a, const T *b, size_t n, T *z){ \
+		p##w##_sub_n(c(a), c(b), n, c(z)); \
+	} \
+	static void mul(const T *a, const T *b, size_t n, T *z){ \
+		p##w##_mul_n(c(a), c(b), n, c(z)); \
+	} \
+	static void div(const T *a, const T *b, size_t n, T *z){ \
+		p##w##_div_n(c(a), c(b), n, c(z)); \
+	} \
+	static void mulAdd(const T *a, const T *b, const T *d, size_t n, T *z){ \
+		p##w##_mulAdd_n(c(a), c(b), c(d), n, c(z)); \
+	} \
+	static Q clr(){ \
+		return q##w##Clr(); \
+	} \
+	static void fdp(Q &q, const T *a, const T *b, size_t n){ \
+		for (size_t i=0; i<n; i++) q = q##w##_fdp_add(q, c(a)[i], c(b)[i]); \
+	} \
+	static void sum(Q &q, const T *a, size_t n){ \
+		const T one(1); \
+		for (size_t i=0; i<n; i++) q = q##w##_fdp_add(q, c(a)[i], *c(&one)); \
+	} \
+	static T round(const Q &q){ \
+		T z; \
+		z.value = castUI(q##w##_to_p##w(q)); \
+		return z; \
+	} \
+	static T min(const T *a, size_t n){ \
+		T z; \
+		z.value = castUI(p##w##_min_n(c(a), n)); \
+		return z; \
+	} \
+	static T max(const T *a, size_t n){ \
+		T z; \
+		z.value = castUI(p##w##_max_n(c(a), n)); \
+		return z; \
+	} \
+};
+SOFTPOSIT_BATCH(8)
+SOFTPOSIT_BATCH(16)
+SOFTPOSIT_BATCH(32)
+#undef SOFTPOSIT_BATCH
+
+//posit64 has no elementwise batch kernels; loop over the scalar ones
+template<> struct softposit_batch<posit64>{
+	typedef posit64 T;
+	typedef posit64_t C;
+	typedef quire64_t Q;
+	static const C* c(const T *a){
+		return reinterpret_cast<const C*>(a);
+	}
+	static void add(const T *a, const T *b, size_t n, T *z){
+		for (size_t i=0; i<n; i++) z[i].value = castUI(p64_add(c(a)[i], c(b)[i]));
+	}
+	static void sub(const T *a, const T *b, size_t n, T *z){
+		for (size_t i=0; i<n; i++) z[i].value = castUI(p64_sub(c(a)[i], c(b)[i]));
+	}
+	static void mul(const T *a, const T *b, size_t n, T *z){
+		for (size_t i=0; i<n; i++) z[i].value = castUI(p64_mul(c(a)[i], c(b)[i]));
+	}
+	static void div(const T *a, const T *b, size_t n, T *z){
+		for (size_t i=0; i<n; i++) z[i].value = castUI(p64_div(c(a)[i], c(b)[i]));
+	}
+	static void mulAdd(const T *a, const T *b, const T *d, size_t n, T *z){
+		for (size_t i=0; i<n; i++) z[i].value = castUI(p64_mulAdd(c(a)[i], c(b)[i], c(d)[i]));
+	}
+	static Q clr(){
+		return q64Clr();
+	}
+	static void fdp(Q &q, const T *a, const T *b, size_t n){
+		for (size_t i=0; i<n; i++) q = q64_fdp_add(q, c(a)[i], c(b)[i]);
+	}
+	static void sum(Q &q, const T *a, size_t n){
+		for (size_t i=0; i<n; i++) q = q64_fdp_add(q, c(a)[i], castP64(0x4000000000000000));
+	}
+	static T round(const Q &q){
+		T z;
+		z.value = castUI(q64_to_p64(q));
+		return z;
+	}
+	static T min(const T *a, size_t n){
+		T z;
+		z.value = castUI(p64_min_n(c(a), n));
+		return z;
+	}
+	static T max(const T *a, size_t n){
+		T z;
+		z.value = castUI(p64_max_n(c(a), n));
+		return z;
+	}
+};
+
+//Expression nodes.  block(i, n, out) returns elements i..i+n-1 of the
+//node's value, either where they already are or computed into out.
+template<class T> struct softposit_arrayRef{
+	typedef T value_type;
+	const T *p;
+	size_t n;
+
+	size_t size() const{
+		return n;
+	}
+	const T* block(size_t i, size_t, T*) const{
+		return p + i;
+	}
+};
+
+template<class T> struct softposit_arrayScalar{
+	typedef T value_type;
+	T s;
+
+	size_t size() const{
+		return 0;
+	}
+	const T* block(size_t, size_t n, T *out) const{
+		std::fill(out, out + n, s);
+		return out;
+	}
+};
+
+//Scratch for one block, left uninitialized: the posit constructors would
+//otherwise run a conversion per element
+template<class T> struct softposit_arrayBuffer{
+	typename std::aligned_storage<SOFTPOSIT_ARRAY_BLOCK*sizeof(T), 64>::type raw;
+
+	T* get(){
+		return reinterpret_cast<T*>(&raw);
+	}
+};
+
+struct softposit_arrayAdd{
+	template<class T> static void apply(const T *a, const T *b, size_t n, T *z){
+		softposit_batch<T>::add(a, b, n, z);
+	}
+};
+struct softposit_arraySub{
+	template<class T> static void apply(const T *a, const T *b, size_t n, T *z){
+		softposit_batch<T>::sub(a, b, n, z);
+	}
+};
+struct softposit_arrayMul{
+	template<class T> static void apply(const T *a, const T *b, size_t n, T *z){
+		softposit_batch<T>::mul(a, b, n, z);
+	}
+};
+struct softposit_arrayDiv{
+	template<class T> static void apply(const T *a, const T *b, size_t n, T *z){
+		softposit_batch<T>::div(a, b, n, z);
+	}
+};
+
+template<class Op, class L, class R> struct softposit_arrayBinary{
+	typedef typename L::value_type value_type;
+	L l;
+	R r;
+
+	size_t size() const{
+		return l.size() ? l.size() : r.size();
+	}
+	const value_type* block(size_t i, size_t n, value_type *out) const{
+		softposit_arrayBuffer<value_type> tmp;
+		const value_type *a = l.block(i, n, tmp.get());
+		const value_type *b = r.block(i, n, out);
+		Op::apply(a, b, n, out);
+		return out;
+	}
+};
+
+//a*b + c, c + a*b and a*b + c*d fuse into one mulAdd kernel
+template<class A, class B, class C> struct softposit_arrayBinary<softposit_arrayAdd, softposit_arrayBinary<softposit_arrayMul, A, B>, C>{
+	typedef typename A::value_type value_type;
+	softposit_arrayBinary<softposit_arrayMul, A, B> l;
+	C r;
+
+	size_t size() const{
+		return l.size() ? l.size() : r.size();
+	}
+	const value_type* block(size_t i, size_t n, value_type *out) const{
+		softposit_arrayBuffer<value_type> tmpA, tmpB;
+		const value_type *a = l.l.block(i, n, tmpA.get());
+		const value_type *b = l.r.block(i, n, tmpB.get());
+		const value_type *c = r.block(i, n, out);
+		softposit_batch<value_type>::mulAdd(a, b, c, n, out);
+		return out;
+	}
+};
+template<class C, class A, class B> struct softposit_arrayBinary<softposit_arrayAdd, C, softposit_arrayBinary<softposit_arrayMul, A, B> >{
+	typedef typename A::value_type value_type;
+	C l;
+	softposit_arrayBinary<softposit_arrayMul, A, B> r;
+
+	size_t size() const{
+		return l.size() ? l.size() : r.size();
+	}
+	const value_type* block(size_t i, size_t n, value_type *out) const{
+		softposit_arrayBuffer<value_type> tmpA, tmpB;
+		const value_type *a = r.l.block(i, n, tmpA.get());
+		const value_type *b = r.r.block(i, n, tmpB.get());
+		const value_type *c = l.block(i, n, out);
+		softposit_batch<value_type>::mulAdd(a, b, c, n, out);
+		return out;
+	}
+};
+template<class A, class B, class C, class D> struct softposit_arrayBinary<softposit_arrayAdd, softposit_arrayBinary<softposit_arrayMul, A, B>, softposit_arrayBinary<softposit_arrayMul, C, D> >{
+	typedef typename A::value_type value_type;
+	softposit_arrayBinary<softposit_arrayMul, A, B> l;
+	softposit_arrayBinary<softposit_arrayMul, C, D> r;
+
+	size_t size() const{
+		return l.size() ? l.size() : r.size();
+	}
+	const value_type* block(size_t i, size_t n, value_type *out) const{
+		softposit_arrayBuffer<value_type> tmpA, tmpB;
+		const value_type *a = l.l.block(i, n, tmpA.get());
+		const value_type *b = l.r.block(i, n, tmpB.get());
+		const value_type *c = r.block(i, n, out);
+		softposit_batch<value_type>::mulAdd(a, b, c, n, out);
+		return out;
+	}
+};
+
+template<class T, class Alloc=softposit_alignedAllocator<T> > class posit_array;
+
+//What may appear in an array expression, and how it is held by the nodes:
+//arrays by pointer and size, expressions by value
+template<class X> struct softposit_arrayOperand{
+	static const bool value = false;
+};
+template<class T, class Alloc> struct softposit_arrayOperand<posit_array<T, Alloc> >{
+	static const bool value = true;
+	typedef T value_type;
+	typedef softposit_arrayRef<T> type;
+	static type make(const posit_array<T, Alloc> &a){
+		type z = {a.data(), a.size()};
+		return z;
+	}
+};
+template<class Op, class L, class R> struct softposit_arrayOperand<softposit_arrayBinary<Op, L, R> >{
+	static const bool value = true;
+	typedef typename L::value_type value_type;
+	typedef softposit_arrayBinary<Op, L, R> type;
+	static const type& make(const type &a){
+		return a;
+	}
+};
+
+//Scalars broadcast: the element type itself, or any arithmetic type
+template<class S, class T> struct softposit_arrayIsScalar{
+	static const bool value = std::is_same<S, T>::value || std::is_arithmetic<S>::value;
+};
+
+template<class Op, class L, class R, class=void> struct softposit_arrayResult{
+};
+template<class Op, class L, class R> struct softposit_arrayResult<Op, L, R, typename std::enable_if<softposit_arrayOperand<L>::value && softposit_arrayOperand<R>::value
+		&& std::is_same<typename softposit_arrayOperand<L>::value_type, typename softposit_arrayOperand<R>::value_type>::value>::type>{
+	typedef softposit_arrayBinary<Op, typename softposit_arrayOperand<L>::type, typename softposit_arrayOperand<R>::type> type;
+	//Only scalars broadcast; two array operands must match element for element
+	static type make(const L &a, const R &b){
+		type z = {softposit_arrayOperand<L>::make(a), softposit_arrayOperand<R>::make(b)};
+		if (z.l.size() != z.r.size()) throw std::length_error("posit_array: operand sizes differ");
+		return z;
+	}
+};
+template<class Op, class L, class R> struct softposit_arrayResult<Op, L, R, typename std::enable_if<softposit_arrayOperand<L>::value
+		&& softposit_arrayIsScalar<R, typename softposit_arrayOperand<L>::value_type>::value>::type>{
+	typedef typename softposit_arrayOperand<L>::value_type T;
+	typedef softposit_arrayBinary<Op, typename softposit_arrayOperand<L>::type, softposit_arrayScalar<T> > type;
+	static type make(const L &a, const R &b){
+		softposit_arrayScalar<T> s = {T(b)};
+		type z = {softposit_arrayOperand<L>::make(a), s};
+		return z;
+	}
+};
+template<class Op, class L, class R> struct softposit_arrayResult<Op, L, R, typename std::enable_if<softposit_arrayOperand<R>::value
+		&& softposit_arrayIsScalar<L, typename softposit_arrayOperand<R>::value_type>::value>::type>{
+	typedef typename softposit_arrayOperand<R>::value_type T;
+	typedef softposit_arrayBinary<Op, softposit_arrayScalar<T>, typename softposit_arrayOperand<R>::type> type;
+	static type make(const L &a, const R &b){
+		softposit_arrayScalar<T> s = {T(a)};
+		type z = {s, softposit_arrayOperand<R>::make(b)};
+		return z;
+	}
+};
+
+template<class L, class R> inline typename softposit_arrayResult<softposit_arrayAdd, L, R>::type operator+(const L &a, const R &b){
+	return softposit_arrayResult<softposit_arrayAdd, L, R>::make(a, b);
+}
+template<class L, class R> inline typename softposit_arrayResult<softposit_arraySub, L, R>::type operator-(const L &a, const R &b){
+	return softposit_arrayResult<softposit_arraySub, L, R>::make(a, b);
+}
+template<class L, class R> inline typename softposit_arrayResult<softposit_arrayMul, L, R>::type operator*(const L &a, const R &b){
+	return softposit_arrayResult<softposit_arrayMul, L, R>::make(a, b);
+}
+template<class L, class R> inline typename softposit_arrayResult<softposit_arrayDiv, L, R>::type operator/(const L &a, const R &b){
+	return softposit_arrayResult<softposit_arrayDiv, L, R>::make(a, b);
+}
+
+template<class T, class Alloc> class posit_array{
+public:
+	typedef T value_type;
+	typedef T* iterator;
+	typedef const T* const_iterator;
+	typedef Alloc allocator_type;
+
+	explicit posit_array(size_t n=0, const Alloc &alloc=Alloc()) : alloc(alloc), p(0), n(0){
+		resize(n);
+	}
+	posit_array(size_t n, T v, const Alloc &alloc=Alloc()) : alloc(alloc), p(0), n(0){
+		resize(n);
+		std::fill(p, p + n, v);
+	}
+	posit_array(std::initializer_list<T> v, const Alloc &alloc=Alloc()) : alloc(alloc), p(0), n(0){
+		resize(v.size());
+		std::copy(v.begin(), v.end(), p);
+	}
+	template<class E, class=typename std::enable_if<softposit_arrayOperand<E>::value>::type>
+	posit_array(const E &e, const Alloc &alloc=Alloc()) : alloc(alloc), p(0), n(0){
+		assign(softposit_arrayOperand<E>::make(e));
+	}
+	posit_array(const posit_array &a) : alloc(a.alloc), p(0), n(0){
+		resize(a.n);
+		std::copy(a.p, a.p + n, p);
+	}
+	posit_array(posit_array &&a) noexcept : alloc(a.alloc), p(a.p), n(a.n){
+		a.p = 0;
+		a.n = 0;
+	}
+	~posit_array(){
+		if (p) alloc.deallocate(p, n);
+	}
+
+	posit_array& operator=(const posit_array &a){
+		if (this != &a){
+			resize(a.n);
+			std::copy(a.p, a.p + n, p);
+		}
+		return *this;
+	}
+	posit_array& operator=(posit_array &&a) noexcept{
+		std::swap(alloc, a.alloc);
+		std::swap(p, a.p);
+		std::swap(n, a.n);
+		return *this;
+	}
+	//Evaluates the expression in one blocked pass
+	template<class E> typename std::enable_if<softposit_arrayOperand<E>::value, posit_array&>::type operator=(const E &e){
+		assign(softposit_arrayOperand<E>::make(e));
+		return *this;
+	}
+
+	template<class E> posit_array& operator+=(const E &e){
+		return *this = *this + e;
+	}
+	template<class E> posit_array& operator-=(const E &e){
+		return *this = *this - e;
+	}
+	template<class E> posit_array& operator*=(const E &e){
+		return *this = *this * e;
+	}
+	template<class E> posit_array& operator/=(const E &e){
+		return *this = *this / e;
+	}
+
+	//New elements are zero; the old contents are not kept
+	void resize(size_t size){
+		if (size == n) return;
+		if (p) alloc.deallocate(p, n);
+		p = size ? alloc.allocate(size) : 0;
+		n = size;
+		if (p) std::memset(static_cast<void*>(p), 0, n*sizeof(T));
+	}
+	void fill(T v){
+		std::fill(p, p + n, v);
+	}
+
+	size_t size() const{
+		return n;
+	}
+	bool empty() const{
+		return n == 0;
+	}
+	T* data(){
+		return p;
+	}
+	const T* data() const{
+		return p;
+	}
+	T& operator[](size_t i){
+		return p[i];
+	}
+	const T& operator[](size_t i) const{
+		return p[i];
+	}
+	iterator begin(){
+		return p;
+	}
+	iterator end(){
+		return p + n;
+	}
+	const_iterator begin() const{
+		return p;
+	}
+	const_iterator end() const{
+		return p + n;
+	}
+	allocator_type get_allocator() const{
+		return alloc;
+	}
+
+private:
+	//Each block is finished in scratch before it is stored, so the
+	//destination may also be an operand
+	template<class E> void assign(const E &e){
+		softposit_arrayBuffer<T> buf;
+		size_t size = e.size();
+
+		if (size != n){
+			posit_array z(size, alloc);
+			z.assign(e);
+			*this = std::move(z);
+			return;
+		}
+		for (size_t i=0; i<n; i+=SOFTPOSIT_ARRAY_BLOCK){
+			size_t m = (n-i < SOFTPOSIT_ARRAY_BLOCK) ? n-i : SOFTPOSIT_ARRAY_BLOCK;
+			const T *z = e.block(i, m, buf.get());
+			if (z != p + i) std::copy(z, z + m, p + i);
+		}
+	}
+
+	Alloc alloc;
+	T *p;
+	size_t n;
+};
+
+//Reductions over an array or an expression, evaluated block by block
+template<class E> inline typename std::enable_if<softposit_arrayOperand<E>::value, typename softposit_arrayOperand<E>::value_type>::type
+sum(const E &x){
+	typedef typename softposit_arrayOperand<E>::value_type T;
+	const typename softposit_arrayOperand<E>::type &e = softposit_arrayOperand<E>::make(x);
+	softposit_arrayBuffer<T> buf;
+	typename softposit_batch<T>::Q q = softposit_batch<T>::clr();
+
+	for (size_t i=0, n=e.size(); i<n; i+=SOFTPOSIT_ARRAY_BLOCK){
+		size_t m = (n-i < SOFTPOSIT_ARRAY_BLOCK) ? n-i : SOFTPOSIT_ARRAY_BLOCK;
+		softposit_batch<T>::sum(q, e.block(i, m, buf.get()), m);
+	}
+	return softposit_batch<T>::round(q);
+}
+
+template<class L, class R> inline typename std::enable_if<softposit_arrayOperand<L>::value && softposit_arrayOperand<R>::value
+		&& std::is_same<typename softposit_arrayOperand<L>::value_type, typename softposit_arrayOperand<R>::value_type>::value,
+		typename softposit_arrayOperand<L>::value_type>::type
+dot(const L &x, const R &y){
+	typedef typename softposit_arrayOperand<L>::value_type T;
+	const typename softposit_arrayOperand<L>::type &a = softposit_arrayOperand<L>::make(x);
+	const typename softposit_arrayOperand<R>::type &b = softposit_arrayOperand<R>::make(y);
+	softposit_arrayBuffer<T> bufA, bufB;
+	typename softposit_batch<T>::Q q = softposit_batch<T>::clr();
+
+	if (a.size() != b.size()) throw std::length_error("dot: operand sizes differ");
+	for (size_t i=0, n=a.size(); i<n; i+=SOFTPOSIT_ARRAY_BLOCK){
+		size_t m = (n-i < SOFTPOSIT_ARRAY_BLOCK) ? n-i : SOFTPOSIT_ARRAY_BLOCK;
+		softposit_batch<T>::fdp(q, a.block(i, m, bufA.get()), b.block(i, m, bufB.get()), m);
+	}
+	return softposit_batch<T>::round(q);
+}
+
+//NaR orders below every real value, as in p32_min_n and p32_max_n; an
+//empty operand gives NaR
+template<class E> inline typename std::enable_if<softposit_arrayOperand<E>::value, typename softposit_arrayOperand<E>::value_type>::type
+min(const E &x){
+	typedef typename softposit_arrayOperand<E>::value_type T;
+	const typename softposit_arrayOperand<E>::type &e = softposit_arrayOperand<E>::make(x);
+	softposit_arrayBuffer<T> buf;
+	T z = softposit_batch<T>::min(buf.get(), 0);
+
+	for (size_t i=0, n=e.size(); i<n; i+=SOFTPOSIT_ARRAY_BLOCK){
+		size_t m = (n-i < SOFTPOSIT_ARRAY_BLOCK) ? n-i : SOFTPOSIT_ARRAY_BLOCK;
+		T b = softposit_batch<T>::min(e.block(i, m, buf.get()), m);
+		if (i == 0 || b < z) z = b;
+	}
+	return z;
+}
+
+template<class E> inline typename std::enable_if<softposit_arrayOperand<E>::value, typename softposit_arrayOperand<E>::value_type>::type
+max(const E &x){
+	typedef typename softposit_arrayOperand<E>::value_type T;
+	const typename softposit_arrayOperand<E>::type &e = softposit_arrayOperand<E>::make(x);
+	softposit_arrayBuffer<T> buf;
+	T z = softposit_batch<T>::max(buf.get(), 0);
+
+	for (size_t i=0, n=e.size(); i<n; i+=SOFTPOSIT_ARRAY_BLOCK){
+		size_t m = (n-i < SOFTPOSIT_ARRAY_BLOCK) ? n-i : SOFTPOSIT_ARRAY_BLOCK;
+		T b = softposit_batch<T>::max(e.block(i, m, buf.get()), m);
+		if (i == 0 || z < b) z = b;
+	}
+	return z;
+}
 
 //cout helper functions
 
@@ -1775,6 +4025,11 @@ inline std::ostream& operator<<(std::ostream& os, const posit_2& p) {
     return os;
 }
 
+inline std::ostream& operator<<(std::ostream& os, const posit64& p) {
+    os << p.toDouble();
+    return os;
+}
+
 //Math lib
 
 /*inline posit8 abs(posit8 a){
@@ -53,15 +53,6 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 | (typically 'float' and 'double', and possibly 'long double').
 *----------------------------------------------------------------------------*/
 
-#ifdef SOFTPOSIT_EXACT
-	typedef struct { uint8_t v; bool exact; } posit8_t;
-	typedef struct { uint_fast16_t v; bool exact; } posit16_t;
-	typedef struct { uint32_t v; bool exact; } posit32_t;
-	typedef struct { uint64_t v; bool exact; } posit64_t;
-	typedef struct { uint64_t v[2]; bool exact; } posit128_t;
-
-	typedef struct { uint64_t v[2]; bool exact; } quire16_t;
-#else
 	typedef struct { uint8_t v; } posit8_t;
 	typedef struct { uint16_t v; } posit16_t;
 	typedef struct { uint32_t v; } posit32_t;
@@ -71,6 +62,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 	typedef struct { uint32_t v; } quire8_t;
 	typedef struct { uint64_t v[2]; } quire16_t;
 	typedef struct { uint64_t v[8]; } quire32_t;
+	typedef struct { uint64_t v[16]; } quire64_t;
 
 	typedef struct { uint32_t v; } posit_2_t;
 	typedef struct { uint32_t v; } posit_1_t;
@@ -80,23 +72,6 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 	typedef struct { uint64_t v[8]; } quire_1_t;
 	typedef struct { uint64_t v[8]; } quire_0_t;
 
-#endif
-
-
-#ifdef SOFTPOSIT_EXACT
-	typedef struct { uint8_t v; bool exact; } uint8e_t;
-	typedef struct { uint16_t v; bool exact; } uint16e_t;
-	typedef struct { uint32_t v; bool exact; } uint32e_t;
-	typedef struct { uint64_t v; bool exact; } uint64e_t;
-	typedef struct { uint64_t v[2]; bool exact; } uint128e_t;
-
-	union ui8_p8   { uint8e_t ui; posit8_t p; };
-	union ui16_p16 { uint16e_t ui; posit16_t p; };
-	union ui32_p32 { uint32e_t ui; posit32_t p; };
-	union ui64_p64 { uint64e_t ui; posit64_t p; };
-
-	union ui128_q16 { uint64_t ui[2]; quire16_t q; };
-#else
 	union ui8_p8   { uint8_t ui; posit8_t p; };
 	union ui16_p16 { uint16_t ui; posit16_t p; };
 	union ui32_p32 { uint32_t ui; posit32_t p; };
@@ -105,7 +80,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 	union ui32_pX2 { uint32_t ui; posit_2_t p; };
 	union ui32_pX1 { uint32_t ui; posit_1_t p; };
-	union ui32_pX0 { uint32_t ui; posit_1_t p; };
+	union ui32_pX0 { uint32_t ui; posit_0_t p; };
 
 	union ui64_double   { uint64_t ui; double d; };
 
@@ -132,7 +107,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 		uint64_t ui[8];
 		quire_1_t q;
 	};
-#endif
+
+	union ui512_qX0 {
+		uint64_t ui[8];
+		quire_0_t q;
+	};
 
 
 #endif
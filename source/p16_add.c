@@ -47,6 +47,7 @@ posit16_t p16_add( posit16_t a, posit16_t b ){
     uint_fast16_t uiA, uiB;
     union ui16_p16 uZ;
 
+    SOFTPOSIT_STAT_OP( add, p16 );
     uA.p = a;
 	uiA = uA.ui;
 	uB.p = b;
@@ -59,6 +60,7 @@ posit16_t p16_add( posit16_t a, posit16_t b ){
 		return uZ.p;
 	}
 	else if ( uiA==0x8000 || uiB==0x8000 ){
+		SOFTPOSIT_STAT_NAR( p16 );
 		uZ.ui = 0x8000;
 		return uZ.p;
 	}
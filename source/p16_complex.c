@@ -0,0 +1,138 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Complex 16-bit posits.  Products and dot products accumulate the real and
+| imaginary parts in separate quires, so each component is rounded once
+| instead of after every multiply and add.  The _n kernels work on split
+| (structure of arrays) real and imaginary arrays; outputs may alias inputs.
+*----------------------------------------------------------------------------*/
+cposit16_t cp16_add( cposit16_t a, cposit16_t b ){
+	cposit16_t z;
+
+	z.re = p16_add( a.re, b.re );
+	z.im = p16_add( a.im, b.im );
+	return z;
+}
+
+cposit16_t cp16_sub( cposit16_t a, cposit16_t b ){
+	cposit16_t z;
+
+	z.re = p16_sub( a.re, b.re );
+	z.im = p16_sub( a.im, b.im );
+	return z;
+}
+
+cposit16_t cp16_mul( cposit16_t a, cposit16_t b ){
+	cposit16_t z;
+
+	z.re = q16_to_p16( q16_fdp_sub( q16_fdp_add( q16Clr(), a.re, b.re ), a.im, b.im ) );
+	z.im = q16_to_p16( q16_fdp_add( q16_fdp_add( q16Clr(), a.re, b.im ), a.im, b.re ) );
+	return z;
+}
+
+//a*conj(b) and |b|^2 are each rounded once before the final divisions
+cposit16_t cp16_div( cposit16_t a, cposit16_t b ){
+	posit16_t d;
+	cposit16_t z;
+
+	d = q16_to_p16( q16_fdp_add( q16_fdp_add( q16Clr(), b.re, b.re ), b.im, b.im ) );
+	z.re = q16_to_p16( q16_fdp_add( q16_fdp_add( q16Clr(), a.re, b.re ), a.im, b.im ) );
+	z.im = q16_to_p16( q16_fdp_sub( q16_fdp_add( q16Clr(), a.im, b.re ), a.re, b.im ) );
+	z.re = p16_div( z.re, d );
+	z.im = p16_div( z.im, d );
+	return z;
+}
+
+cposit16_t cp16_conj( cposit16_t a ){
+	a.im.v = -a.im.v;
+	return a;
+}
+
+//|a|^2, rounded once
+posit16_t cp16_norm( cposit16_t a ){
+	return q16_to_p16( q16_fdp_add( q16_fdp_add( q16Clr(), a.re, a.re ), a.im, a.im ) );
+}
+
+posit16_t cp16_abs( cposit16_t a ){
+	return p16_sqrt( cp16_norm( a ) );
+}
+
+void cp16_mul_n( const posit16_t * ar, const posit16_t * ai, const posit16_t * br, const posit16_t * bi, size_t n,
+		posit16_t * zr, posit16_t * zi ){
+	cposit16_t a, b, z;
+	size_t i;
+
+	for (i=0; i<n; i++){
+		a.re = ar[i]; a.im = ai[i];
+		b.re = br[i]; b.im = bi[i];
+		z = cp16_mul( a, b );
+		zr[i] = z.re;
+		zi[i] = z.im;
+	}
+}
+
+//sum of conj(a[i])*b[i], rounded once per component
+cposit16_t cp16_dotc_n( const posit16_t * ar, const posit16_t * ai, const posit16_t * br, const posit16_t * bi, size_t n ){
+	quire16_t qR = q16Clr(), qI = q16Clr();
+	cposit16_t z;
+	size_t i;
+
+	for (i=0; i<n; i++){
+		qR = q16_fdp_add( q16_fdp_add( qR, ar[i], br[i] ), ai[i], bi[i] );
+		qI = q16_fdp_sub( q16_fdp_add( qI, ar[i], bi[i] ), ai[i], br[i] );
+	}
+	z.re = q16_to_p16( qR );
+	z.im = q16_to_p16( qI );
+	return z;
+}
+
+void cp16_abs_n( const posit16_t * ar, const posit16_t * ai, size_t n, posit16_t * z ){
+	cposit16_t a;
+	size_t i;
+
+	for (i=0; i<n; i++){
+		a.re = ar[i]; a.im = ai[i];
+		z[i] = cp16_abs( a );
+	}
+}
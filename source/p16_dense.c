@@ -0,0 +1,238 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Dense LU (partial pivoting) and Cholesky factorisation for 16-bit posits,
+| row-major with leading dimension lda.  Both are blocked and right-looking:
+| a narrow panel is factored, then the trailing matrix is updated by
+| threads, each updated entry being its old value minus a panel-wide dot
+| product accumulated in the quire and rounded once.  The triangular solves
+| round every component once from the quire too.
+*----------------------------------------------------------------------------*/
+#define P16_BLOCK 32
+
+static inline quire16_t p16_quireFrom( posit16_t a ){
+	posit16_t one = { .v = 0x4000 };
+	return q16_fdp_add( q16Clr(), a, one );
+}
+
+//Orders magnitudes like their bit patterns; NaR ranks above every real
+//value, so a column holding it pivots on it and the factors show NaR
+static inline uint16_t p16_absOrder( posit16_t a ){
+	if (a.v==0x8000) return UINT16_MAX;
+	return (a.v>>15) ? (uint16_t) (0u-a.v) : a.v;
+}
+
+typedef struct {
+	posit16_t * A;
+	size_t n, lda, k0, kb;
+} p16_denseTask;
+
+//Rows k0+kb.. of A22 -= L21*U12
+static void p16_luUpdatePart( void * arg, int part, int nParts ){
+	const p16_denseTask * t = arg;
+	posit16_t * A = t->A;
+	size_t first = t->k0 + t->kb, rows = t->n - first, lda = t->lda, i, j, m;
+	size_t i0 = first + rows*part/nParts, i1 = first + rows*(part+1)/nParts;
+	quire16_t qZ;
+
+	for (i=i0; i<i1; i++){
+		for (j=first; j<t->n; j++){
+			qZ = p16_quireFrom( A[i*lda+j] );
+			for (m=t->k0; m<first; m++) qZ = q16_fdp_sub( qZ, A[i*lda+m], A[m*lda+j] );
+			A[i*lda+j] = q16_to_p16( qZ );
+		}
+	}
+}
+
+//U12 = L11^-1 * A12, by columns
+static void p16_luSolvePanelPart( void * arg, int part, int nParts ){
+	const p16_denseTask * t = arg;
+	posit16_t * A = t->A;
+	size_t first = t->k0 + t->kb, cols = t->n - first, lda = t->lda, j, k, m;
+	size_t j0 = first + cols*part/nParts, j1 = first + cols*(part+1)/nParts;
+	quire16_t qZ;
+
+	for (j=j0; j<j1; j++){
+		for (k=t->k0+1; k<first; k++){
+			qZ = p16_quireFrom( A[k*lda+j] );
+			for (m=t->k0; m<k; m++) qZ = q16_fdp_sub( qZ, A[k*lda+m], A[m*lda+j] );
+			A[k*lda+j] = q16_to_p16( qZ );
+		}
+	}
+}
+
+/*----------------------------------------------------------------------------
+| PA = LU in place, L unit lower.  piv[k] is the row swapped with row k.
+| Returns 0, or k+1 if U[k][k] is zero (the factorisation is still completed).
+*----------------------------------------------------------------------------*/
+int p16_luFactor( posit16_t * A, size_t n, size_t lda, size_t * piv, int nThreads ){
+	p16_denseTask t = { A, n, lda, 0, 0 };
+	size_t k0, k, i, j, p;
+	posit16_t pivot, tmp, l;
+	int info = 0;
+
+	for (k0=0; k0<n; k0+=P16_BLOCK){
+		t.k0 = k0;
+		t.kb = (n-k0<P16_BLOCK) ? n-k0 : P16_BLOCK;
+		for (k=k0; k<k0+t.kb; k++){
+			p = k;
+			for (i=k+1; i<n; i++)
+				if (p16_absOrder( A[i*lda+k] )>p16_absOrder( A[p*lda+k] )) p = i;
+			piv[k] = p;
+			if (p!=k){
+				for (j=0; j<n; j++){
+					tmp = A[k*lda+j];
+					A[k*lda+j] = A[p*lda+j];
+					A[p*lda+j] = tmp;
+				}
+			}
+			pivot = A[k*lda+k];
+			if (pivot.v==0){
+				if (!info) info = (int) k+1;
+				continue;
+			}
+			for (i=k+1; i<n; i++){
+				l = p16_div( A[i*lda+k], pivot );
+				A[i*lda+k] = l;
+				l.v = -l.v;
+				for (j=k+1; j<k0+t.kb; j++) A[i*lda+j] = p16_mulAdd( l, A[k*lda+j], A[i*lda+j] );
+			}
+		}
+		if (k0+t.kb<n){
+			softposit_parallelRun( nThreads, p16_luSolvePanelPart, &t );
+			softposit_parallelRun( nThreads, p16_luUpdatePart, &t );
+		}
+	}
+	return info;
+}
+
+//Solves A*x = b in place in b using the factors from p16_luFactor
+void p16_luSolve( const posit16_t * LU, size_t n, size_t lda, const size_t * piv, posit16_t * b ){
+	size_t i, m;
+	posit16_t tmp;
+	quire16_t qZ;
+
+	for (i=0; i<n; i++){
+		if (piv[i]!=i){
+			tmp = b[i];
+			b[i] = b[piv[i]];
+			b[piv[i]] = tmp;
+		}
+	}
+	for (i=0; i<n; i++){
+		qZ = p16_quireFrom( b[i] );
+		for (m=0; m<i; m++) qZ = q16_fdp_sub( qZ, LU[i*lda+m], b[m] );
+		b[i] = q16_to_p16( qZ );
+	}
+	for (i=n; i-->0;){
+		qZ = p16_quireFrom( b[i] );
+		for (m=i+1; m<n; m++) qZ = q16_fdp_sub( qZ, LU[i*lda+m], b[m] );
+		b[i] = p16_div( q16_to_p16( qZ ), LU[i*lda+i] );
+	}
+}
+
+//Lower triangle of rows k0+kb.. -= L21*L21^T; rows dealt round-robin for balance
+static void p16_cholUpdatePart( void * arg, int part, int nParts ){
+	const p16_denseTask * t = arg;
+	posit16_t * A = t->A;
+	size_t first = t->k0 + t->kb, lda = t->lda, i, j, m;
+	quire16_t qZ;
+
+	for (i=first+part; i<t->n; i+=nParts){
+		for (j=first; j<=i; j++){
+			qZ = p16_quireFrom( A[i*lda+j] );
+			for (m=t->k0; m<first; m++) qZ = q16_fdp_sub( qZ, A[i*lda+m], A[j*lda+m] );
+			A[i*lda+j] = q16_to_p16( qZ );
+		}
+	}
+}
+
+/*----------------------------------------------------------------------------
+| A = L*L^T in place in the lower triangle; the strict upper triangle is not
+| referenced.  Returns 0, or k+1 if the leading minor of order k+1 is not
+| positive (factorisation stops there).
+*----------------------------------------------------------------------------*/
+int p16_cholFactor( posit16_t * A, size_t n, size_t lda, int nThreads ){
+	p16_denseTask t = { A, n, lda, 0, 0 };
+	size_t k0, k, i, m;
+	posit16_t d;
+	quire16_t qZ;
+
+	for (k0=0; k0<n; k0+=P16_BLOCK){
+		t.k0 = k0;
+		t.kb = (n-k0<P16_BLOCK) ? n-k0 : P16_BLOCK;
+		for (k=k0; k<k0+t.kb; k++){
+			qZ = p16_quireFrom( A[k*lda+k] );
+			for (m=k0; m<k; m++) qZ = q16_fdp_sub( qZ, A[k*lda+m], A[k*lda+m] );
+			d = q16_to_p16( qZ );
+			if ((int16_t) d.v<=0) return (int) k+1;
+			d = p16_sqrt( d );
+			A[k*lda+k] = d;
+			for (i=k+1; i<n; i++){
+				qZ = p16_quireFrom( A[i*lda+k] );
+				for (m=k0; m<k; m++) qZ = q16_fdp_sub( qZ, A[i*lda+m], A[k*lda+m] );
+				A[i*lda+k] = p16_div( q16_to_p16( qZ ), d );
+			}
+		}
+		if (k0+t.kb<n) softposit_parallelRun( nThreads, p16_cholUpdatePart, &t );
+	}
+	return 0;
+}
+
+//Solves A*x = b in place in b using the factor from p16_cholFactor
+void p16_cholSolve( const posit16_t * L, size_t n, size_t lda, posit16_t * b ){
+	size_t i, m;
+	quire16_t qZ;
+
+	for (i=0; i<n; i++){
+		qZ = p16_quireFrom( b[i] );
+		for (m=0; m<i; m++) qZ = q16_fdp_sub( qZ, L[i*lda+m], b[m] );
+		b[i] = p16_div( q16_to_p16( qZ ), L[i*lda+i] );
+	}
+	for (i=n; i-->0;){
+		qZ = p16_quireFrom( b[i] );
+		for (m=i+1; m<n; m++) qZ = q16_fdp_sub( qZ, L[m*lda+i], b[m] );
+		b[i] = p16_div( q16_to_p16( qZ ), L[i*lda+i] );
+	}
+}
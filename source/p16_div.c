@@ -52,6 +52,7 @@ posit16_t p16_div( posit16_t pA, posit16_t pB ) {
 	uint_fast32_t frac32A, frac32Z, rem;
 	div_t divresult;
 
+	SOFTPOSIT_STAT_OP( div, p16 );
 	uA.p = pA;
 	uiA = uA.ui;
 	uB.p = pB;
@@ -59,24 +60,12 @@ posit16_t p16_div( posit16_t pA, posit16_t pB ) {
 
 	//Zero or infinity
 	if ( uiA==0x8000 || uiB==0x8000 || uiB==0){
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = 0x8000;
-		uZ.ui.exact = 0;
-#else
+		SOFTPOSIT_STAT_NAR( p16 );
 		uZ.ui = 0x8000;
-#endif
 		return uZ.p;
 	}
 	else if (uiA==0){
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = 0;
-		if ( (uiA==0 && uiA.ui.exact) || (uiB==0 && uiB.ui.exact) )
-			uZ.ui.exact = 1;
-		else
-			uZ.ui.exact = 0;
-#else
 		uZ.ui = 0;
-#endif
 		return uZ.p;
 	}
 
@@ -156,6 +145,7 @@ posit16_t p16_div( posit16_t pA, posit16_t pB ) {
 	if(regA>14){
 		//max or min pos. exp and frac does not matter.
 		(regSA) ? (uZ.ui= 0x7FFF): (uZ.ui=0x1);
+		SOFTPOSIT_SATURATED( p16, regSA, !regSA || regA>15 || expA || (frac32Z&0x3FFF) || rem );
 	}
 	else{
 		//remove carry and rcarry bits and shift to correct position
@@ -172,6 +162,7 @@ posit16_t p16_div( posit16_t pA, posit16_t pB ) {
 		//sign is always zero
 		uZ.ui = packToP16UI(regime, regA, expA, fracA);
 
+		SOFTPOSIT_ROUNDED( p16, bitNPlusOne, bitsMore || (((1<<regA)-1) & frac32Z) || rem, uZ.ui&1 );
 		if (bitNPlusOne){
 			( ((1<<regA)-1) & frac32Z ) ? (bitsMore=1) : (bitsMore=0);
 			if (rem) bitsMore =1;
@@ -0,0 +1,68 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Posit16 functions by table lookup.  Each function is a 65536-entry table
+| (128 KiB) of correctly rounded results produced when the library is built
+| (see gen_elementaryTables.c), so a call costs one load.
+*----------------------------------------------------------------------------*/
+#define P16_TABLE_FUNCTION( name ) \
+	posit16_t p16_##name( posit16_t a ){ \
+		union ui16_p16 uZ; \
+		uZ.ui = softposit_##name##P16[castUI(a)]; \
+		return uZ.p; \
+	} \
+	void p16_##name##_n( const posit16_t * a, size_t n, posit16_t * z ){ \
+		size_t i; \
+		for (i=0; i<n; i++) z[i].v = softposit_##name##P16[a[i].v]; \
+	}
+
+P16_TABLE_FUNCTION( exp )
+P16_TABLE_FUNCTION( log )
+P16_TABLE_FUNCTION( sigmoid )
+P16_TABLE_FUNCTION( tanh )
+P16_TABLE_FUNCTION( gelu )
+P16_TABLE_FUNCTION( reciprocal )
+P16_TABLE_FUNCTION( rsqrt )
+P16_TABLE_FUNCTION( sin )
+P16_TABLE_FUNCTION( cos )
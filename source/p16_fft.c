@@ -0,0 +1,437 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <errno.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Complex and real FFTs for 16-bit posits on split real/imaginary arrays.
+| Power-of-two sizes only; transforms are unnormalised in both directions.
+| After a bit-reversal permutation the butterflies run depth-first (each
+| radix-4 step recurses into its four quarters before combining them), so
+| the working set shrinks to fit any cache level without tuning; an odd
+| power of two ends in radix-2 steps at the leaves.  With
+| SOFTPOSIT_FFT_QUIRE each butterfly output component is an exact quire sum
+| of twiddle products rounded once, instead of being rounded three or four
+| times.  Twiddles are rounded once from long double, computed in the first
+| octant and mapped out by symmetry.
+*----------------------------------------------------------------------------*/
+typedef struct {
+	const p16_fftPlan_t * plan;
+	posit16_t * re, * im;
+	bool inverse;
+} p16_fftRun;
+
+static posit16_t p16_fromLongDouble( long double v ){
+	posit16_t z;
+	uint_fast64_t sig;
+	int e;
+
+	if (v==0){
+		z.v = 0;
+		return z;
+	}
+	sig = (uint_fast64_t) ldexpl( frexpl( fabsl( v ), &e ), 64 );
+	z.v = softposit_packPX( v<0, e-1, sig, 0, 16, 1 ) >> (32-16);
+	return z;
+}
+
+static inline posit16_t p16_negate( posit16_t a ){
+	a.v = -a.v;
+	return a;
+}
+
+static inline quire16_t p16_quireFrom( posit16_t a ){
+	posit16_t one = { .v = 0x4000 };
+	return q16_fdp_add( q16Clr(), a, one );
+}
+
+/*----------------------------------------------------------------------------
+| cos and sin of 2*pi*k/n, evaluated only in the first octant and mapped out
+| by symmetry, so multiples of a quarter turn give exact 0 and +-1 and the
+| table is exactly symmetric.  Angles are counted in units of 1/(8n) turn.
+*----------------------------------------------------------------------------*/
+static void p16_unitRoot( size_t k, size_t n, long double * c, long double * s ){
+	const long double pi = 3.141592653589793238462643383279502884L;
+	size_t u = 8*k, quadrant = u/(2*n), r = u%(2*n);
+	long double c0, s0;
+
+	if (r==0){
+		c0 = 1;
+		s0 = 0;
+	}
+	else if (r==n){
+		c0 = s0 = sqrtl( 0.5L );
+	}
+	else if (r<n){
+		c0 = cosl( pi*r/(4*n) );
+		s0 = sinl( pi*r/(4*n) );
+	}
+	else{
+		c0 = sinl( pi*(2*n-r)/(4*n) );
+		s0 = cosl( pi*(2*n-r)/(4*n) );
+	}
+	switch (quadrant){
+		case 0: *c = c0; *s = s0; break;
+		case 1: *c = -s0; *s = c0; break;
+		case 2: *c = -c0; *s = -s0; break;
+		default: *c = s0; *s = -c0; break;
+	}
+}
+
+int p16_fftPlan( p16_fftPlan_t * plan, size_t n, int flags ){
+	long double c, s;
+	size_t k;
+
+	plan->wr = plan->wi = plan->hwr = plan->hwi = 0;
+	if (n<1 || (n&(n-1))){
+		errno = EINVAL;
+		return -1;
+	}
+	plan->n = n;
+	plan->flags = flags;
+	plan->wr = malloc( n*sizeof *plan->wr );
+	plan->wi = malloc( n*sizeof *plan->wi );
+	plan->hwr = malloc( (n/2+1)*sizeof *plan->hwr );
+	plan->hwi = malloc( (n/2+1)*sizeof *plan->hwi );
+	if (!plan->wr || !plan->wi || !plan->hwr || !plan->hwi){
+		p16_fftPlanFree( plan );
+		errno = ENOMEM;
+		return -1;
+	}
+	//w^k = exp(-2*pi*i*k/n)
+	for (k=0; k<n; k++){
+		p16_unitRoot( k, n, &c, &s );
+		plan->wr[k] = p16_fromLongDouble( c );
+		plan->wi[k] = p16_fromLongDouble( -s );
+		if (k<=n/2){
+			plan->hwr[k] = p16_fromLongDouble( c/2 );
+			plan->hwi[k] = p16_fromLongDouble( -s/2 );
+		}
+	}
+	return 0;
+}
+
+void p16_fftPlanFree( p16_fftPlan_t * plan ){
+	free( plan->wr );
+	free( plan->wi );
+	free( plan->hwr );
+	free( plan->hwi );
+	plan->wr = plan->wi = plan->hwr = plan->hwi = 0;
+}
+
+static void p16_bitReverse( posit16_t * re, posit16_t * im, size_t n ){
+	size_t i, j = 0, bit;
+	posit16_t t;
+
+	for (i=1; i<n; i++){
+		for (bit=n>>1; j&bit; bit>>=1) j ^= bit;
+		j |= bit;
+		if (i<j){
+			t = re[i]; re[i] = re[j]; re[j] = t;
+			t = im[i]; im[i] = im[j]; im[j] = t;
+		}
+	}
+}
+
+//w^k for a butterfly spanning size points, conjugated for the inverse
+static inline void p16_twiddle( const p16_fftRun * r, size_t k, size_t size, posit16_t * wr, posit16_t * wi ){
+	size_t index = k * (r->plan->n/size);
+	*wr = r->plan->wr[index];
+	*wi = r->inverse ? p16_negate( r->plan->wi[index] ) : r->plan->wi[index];
+}
+
+//Real and imaginary parts of w*a, each rounded twice
+static inline posit16_t p16_mulRe( posit16_t wr, posit16_t wi, posit16_t ar, posit16_t ai ){
+	return p16_mulAdd( wr, ar, p16_negate( p16_mul( wi, ai ) ) );
+}
+
+static inline posit16_t p16_mulIm( posit16_t wr, posit16_t wi, posit16_t ar, posit16_t ai ){
+	return p16_mulAdd( wr, ai, p16_mul( wi, ar ) );
+}
+
+//q +/- Re(w*a) and q +/- Im(w*a), exactly
+static inline quire16_t p16_quireRe( quire16_t qZ, posit16_t wr, posit16_t wi, posit16_t ar, posit16_t ai, bool negative ){
+	if (negative) return q16_fdp_add( q16_fdp_sub( qZ, wr, ar ), wi, ai );
+	return q16_fdp_sub( q16_fdp_add( qZ, wr, ar ), wi, ai );
+}
+
+static inline quire16_t p16_quireIm( quire16_t qZ, posit16_t wr, posit16_t wi, posit16_t ar, posit16_t ai, bool negative ){
+	if (negative) return q16_fdp_sub( q16_fdp_sub( qZ, wr, ai ), wi, ar );
+	return q16_fdp_add( q16_fdp_add( qZ, wr, ai ), wi, ar );
+}
+
+static void p16_radix2( const p16_fftRun * r, size_t start, size_t size ){
+	posit16_t * re = r->re, * im = r->im, wr, wi, ar, ai, br, bi, tr, ti;
+	size_t half = size/2, k, a, b;
+
+	for (k=0; k<half; k++){
+		a = start + k;
+		b = a + half;
+		ar = re[a]; ai = im[a];
+		br = re[b]; bi = im[b];
+		p16_twiddle( r, k, size, &wr, &wi );
+		if (r->plan->flags & SOFTPOSIT_FFT_QUIRE){
+			re[a] = q16_to_p16( p16_quireRe( p16_quireFrom( ar ), wr, wi, br, bi, 0 ) );
+			im[a] = q16_to_p16( p16_quireIm( p16_quireFrom( ai ), wr, wi, br, bi, 0 ) );
+			re[b] = q16_to_p16( p16_quireRe( p16_quireFrom( ar ), wr, wi, br, bi, 1 ) );
+			im[b] = q16_to_p16( p16_quireIm( p16_quireFrom( ai ), wr, wi, br, bi, 1 ) );
+		}
+		else{
+			tr = p16_mulRe( wr, wi, br, bi );
+			ti = p16_mulIm( wr, wi, br, bi );
+			re[a] = p16_add( ar, tr );
+			im[a] = p16_add( ai, ti );
+			re[b] = p16_sub( ar, tr );
+			im[b] = p16_sub( ai, ti );
+		}
+	}
+}
+
+/*----------------------------------------------------------------------------
+| Two radix-2 levels at once on bit-reversed data: with A1 = w^2k a1,
+| A2 = w^k a2 and A3 = w^3k a3,
+|   x0 = a0 + A1 + (A2 + A3)      x2 = a0 + A1 - (A2 + A3)
+|   x1 = a0 - A1 -+ i(A2 - A3)    x3 = a0 - A1 +- i(A2 - A3)
+| the upper signs for the forward transform.
+*----------------------------------------------------------------------------*/
+static void p16_radix4( const p16_fftRun * r, size_t start, size_t size ){
+	posit16_t * re = r->re, * im = r->im;
+	posit16_t w1r, w1i, w2r, w2i, w3r, w3i, a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i;
+	posit16_t t1r, t1i, t2r, t2i, t3r, t3i, sr, si, dr, di, er, ei, fr, fi;
+	size_t quarter = size/4, k, i0, i1, i2, i3;
+	bool f = !r->inverse;
+
+	for (k=0; k<quarter; k++){
+		i0 = start + k;
+		i1 = i0 + quarter;
+		i2 = i1 + quarter;
+		i3 = i2 + quarter;
+		a0r = re[i0]; a0i = im[i0];
+		a1r = re[i1]; a1i = im[i1];
+		a2r = re[i2]; a2i = im[i2];
+		a3r = re[i3]; a3i = im[i3];
+		p16_twiddle( r, k, size, &w1r, &w1i );
+		p16_twiddle( r, 2*k, size, &w2r, &w2i );
+		p16_twiddle( r, 3*k, size, &w3r, &w3i );
+		if (r->plan->flags & SOFTPOSIT_FFT_QUIRE){
+			quire16_t q0r = p16_quireFrom( a0r ), q0i = p16_quireFrom( a0i );
+			quire16_t qr, qi;
+
+			qr = p16_quireRe( p16_quireRe( p16_quireRe( q0r, w2r, w2i, a1r, a1i, 0 ), w1r, w1i, a2r, a2i, 0 ), w3r, w3i, a3r, a3i, 0 );
+			qi = p16_quireIm( p16_quireIm( p16_quireIm( q0i, w2r, w2i, a1r, a1i, 0 ), w1r, w1i, a2r, a2i, 0 ), w3r, w3i, a3r, a3i, 0 );
+			re[i0] = q16_to_p16( qr );
+			im[i0] = q16_to_p16( qi );
+			qr = p16_quireRe( p16_quireRe( p16_quireRe( q0r, w2r, w2i, a1r, a1i, 0 ), w1r, w1i, a2r, a2i, 1 ), w3r, w3i, a3r, a3i, 1 );
+			qi = p16_quireIm( p16_quireIm( p16_quireIm( q0i, w2r, w2i, a1r, a1i, 0 ), w1r, w1i, a2r, a2i, 1 ), w3r, w3i, a3r, a3i, 1 );
+			re[i2] = q16_to_p16( qr );
+			im[i2] = q16_to_p16( qi );
+			qr = p16_quireIm( p16_quireIm( p16_quireRe( q0r, w2r, w2i, a1r, a1i, 1 ), w1r, w1i, a2r, a2i, !f ), w3r, w3i, a3r, a3i, f );
+			qi = p16_quireRe( p16_quireRe( p16_quireIm( q0i, w2r, w2i, a1r, a1i, 1 ), w1r, w1i, a2r, a2i, f ), w3r, w3i, a3r, a3i, !f );
+			re[i1] = q16_to_p16( qr );
+			im[i1] = q16_to_p16( qi );
+			qr = p16_quireIm( p16_quireIm( p16_quireRe( q0r, w2r, w2i, a1r, a1i, 1 ), w1r, w1i, a2r, a2i, f ), w3r, w3i, a3r, a3i, !f );
+			qi = p16_quireRe( p16_quireRe( p16_quireIm( q0i, w2r, w2i, a1r, a1i, 1 ), w1r, w1i, a2r, a2i, !f ), w3r, w3i, a3r, a3i, f );
+			re[i3] = q16_to_p16( qr );
+			im[i3] = q16_to_p16( qi );
+		}
+		else{
+			t1r = p16_mulRe( w2r, w2i, a1r, a1i );
+			t1i = p16_mulIm( w2r, w2i, a1r, a1i );
+			t2r = p16_mulRe( w1r, w1i, a2r, a2i );
+			t2i = p16_mulIm( w1r, w1i, a2r, a2i );
+			t3r = p16_mulRe( w3r, w3i, a3r, a3i );
+			t3i = p16_mulIm( w3r, w3i, a3r, a3i );
+			sr = p16_add( a0r, t1r ); si = p16_add( a0i, t1i );
+			dr = p16_sub( a0r, t1r ); di = p16_sub( a0i, t1i );
+			er = p16_add( t2r, t3r ); ei = p16_add( t2i, t3i );
+			fr = p16_sub( t2r, t3r ); fi = p16_sub( t2i, t3i );
+			if (r->inverse){
+				fr = p16_negate( fr );
+				fi = p16_negate( fi );
+			}
+			re[i0] = p16_add( sr, er ); im[i0] = p16_add( si, ei );
+			re[i2] = p16_sub( sr, er ); im[i2] = p16_sub( si, ei );
+			re[i1] = p16_add( dr, fi ); im[i1] = p16_sub( di, fr );
+			re[i3] = p16_sub( dr, fi ); im[i3] = p16_add( di, fr );
+		}
+	}
+}
+
+static void p16_fftRecurse( const p16_fftRun * r, size_t start, size_t size ){
+	size_t quarter = size/4;
+
+	if (size<2) return;
+	if (size==2){
+		p16_radix2( r, start, 2 );
+		return;
+	}
+	p16_fftRecurse( r, start, quarter );
+	p16_fftRecurse( r, start + quarter, quarter );
+	p16_fftRecurse( r, start + 2*quarter, quarter );
+	p16_fftRecurse( r, start + 3*quarter, quarter );
+	p16_radix4( r, start, size );
+}
+
+//Transform of size n (a power of two dividing plan->n) in place
+static void p16_fftSized( const p16_fftPlan_t * plan, posit16_t * re, posit16_t * im, size_t n, bool inverse ){
+	p16_fftRun r = { plan, re, im, inverse };
+
+	p16_bitReverse( re, im, n );
+	p16_fftRecurse( &r, 0, n );
+}
+
+void p16_fft( const p16_fftPlan_t * plan, posit16_t * re, posit16_t * im, bool inverse ){
+	p16_fftSized( plan, re, im, plan->n, inverse );
+}
+
+typedef struct {
+	const p16_fftPlan_t * plan;
+	posit16_t * re, * im;
+	size_t count, dist;
+	bool inverse;
+} p16_fftBatch;
+
+static void p16_fftBatchPart( void * arg, int part, int nParts ){
+	const p16_fftBatch * b = arg;
+	size_t i;
+
+	for (i=b->count*part/nParts; i<b->count*(part+1)/nParts; i++)
+		p16_fftSized( b->plan, b->re + i*b->dist, b->im + i*b->dist, b->plan->n, b->inverse );
+}
+
+//count transforms, the i-th at re + i*dist and im + i*dist
+void p16_fft_batch( const p16_fftPlan_t * plan, posit16_t * re, posit16_t * im, size_t count, size_t dist,
+		bool inverse, int nThreads ){
+	p16_fftBatch b = { plan, re, im, count, dist, inverse };
+
+	softposit_parallelRun( nThreads, p16_fftBatchPart, &b );
+}
+
+/*----------------------------------------------------------------------------
+| Real transforms through a half-size complex transform.  With Z the FFT of
+| z[k] = x[2k] + i*x[2k+1], A = Z[k] and B = Z[n/2-k],
+|   X[k] = ( A + conj(B) - i w^k (A - conj(B)) ) / 2
+| and each component of X is one quire sum over the halved twiddles.  The
+| inverse undoes this with the full twiddles, giving 2*Z[k] conjugated.
+*----------------------------------------------------------------------------*/
+static void p16_realSplit( const p16_fftPlan_t * plan, size_t k, posit16_t ar, posit16_t ai, posit16_t br, posit16_t bi,
+		posit16_t * zr, posit16_t * zi ){
+	posit16_t half = { .v = 0x3800 }, hwr = plan->hwr[k], hwi = plan->hwi[k];
+	quire16_t qZ;
+
+	qZ = q16_fdp_add( q16_fdp_add( q16Clr(), half, ar ), half, br );
+	qZ = q16_fdp_add( q16_fdp_add( qZ, hwr, ai ), hwr, bi );
+	*zr = q16_to_p16( q16_fdp_sub( q16_fdp_add( qZ, hwi, ar ), hwi, br ) );
+	qZ = q16_fdp_sub( q16_fdp_add( q16Clr(), half, ai ), half, bi );
+	qZ = q16_fdp_add( q16_fdp_sub( qZ, hwr, ar ), hwr, br );
+	*zi = q16_to_p16( q16_fdp_add( q16_fdp_add( qZ, hwi, ai ), hwi, bi ) );
+}
+
+static void p16_realMerge( const p16_fftPlan_t * plan, size_t k, posit16_t ar, posit16_t ai, posit16_t br, posit16_t bi,
+		posit16_t * zr, posit16_t * zi ){
+	posit16_t one = { .v = 0x4000 }, wr = plan->wr[k], wi = plan->wi[k];
+	quire16_t qZ;
+
+	qZ = q16_fdp_add( p16_quireFrom( ar ), one, br );
+	qZ = q16_fdp_sub( q16_fdp_add( qZ, wi, ar ), wi, br );
+	*zr = q16_to_p16( q16_fdp_sub( q16_fdp_sub( qZ, wr, ai ), wr, bi ) );
+	qZ = q16_fdp_sub( p16_quireFrom( ai ), one, bi );
+	qZ = q16_fdp_sub( q16_fdp_add( qZ, wr, ar ), wr, br );
+	*zi = q16_to_p16( q16_fdp_add( q16_fdp_add( qZ, wi, ai ), wi, bi ) );
+}
+
+//x has plan->n values; re and im receive plan->n/2+1 bins
+void p16_rfft( const p16_fftPlan_t * plan, const posit16_t * x, posit16_t * re, posit16_t * im ){
+	size_t n = plan->n/2, k;
+	posit16_t ar, ai, br, bi;
+
+	//A single real value is its own transform
+	if (plan->n==1){
+		re[0] = x[0];
+		im[0].v = 0;
+		return;
+	}
+
+	for (k=0; k<n; k++){
+		re[k] = x[2*k];
+		im[k] = x[2*k+1];
+	}
+	p16_fftSized( plan, re, im, n, 0 );
+	ar = re[0];
+	ai = im[0];
+	re[0] = p16_add( ar, ai );
+	re[n] = p16_sub( ar, ai );
+	im[0].v = im[n].v = 0;
+	for (k=1; 2*k<=n; k++){
+		ar = re[k]; ai = im[k];
+		br = re[n-k]; bi = im[n-k];
+		p16_realSplit( plan, k, ar, ai, br, bi, &re[k], &im[k] );
+		if (2*k<n) p16_realSplit( plan, n-k, br, bi, ar, ai, &re[n-k], &im[n-k] );
+	}
+}
+
+//Unnormalised inverse of p16_rfft: x receives plan->n times the signal.
+//re and im hold plan->n/2+1 bins and are overwritten.
+void p16_irfft( const p16_fftPlan_t * plan, posit16_t * re, posit16_t * im, posit16_t * x ){
+	size_t n = plan->n/2, k;
+	posit16_t ar, ai, br, bi;
+
+	if (plan->n==1){
+		x[0] = re[0];
+		return;
+	}
+
+	for (k=0; 2*k<=n; k++){
+		ar = re[k]; ai = im[k];
+		br = re[n-k]; bi = im[n-k];
+		p16_realMerge( plan, k, ar, ai, br, bi, &re[k], &im[k] );
+		if (k>0 && 2*k<n) p16_realMerge( plan, n-k, br, bi, ar, ai, &re[n-k], &im[n-k] );
+	}
+	p16_fftSized( plan, re, im, n, 1 );
+	for (k=0; k<n; k++){
+		x[2*k] = re[k];
+		x[2*k+1] = im[k];
+	}
+}
@@ -53,6 +53,7 @@ posit16_t p16_mul( posit16_t pA, posit16_t pB ){
 	int_fast8_t kA=0;
 	uint_fast32_t frac32Z;
 
+	SOFTPOSIT_STAT_OP( mul, p16 );
 	uA.p = pA;
 	uiA = uA.ui;
 	uB.p = pB;
@@ -61,6 +62,7 @@ posit16_t p16_mul( posit16_t pA, posit16_t pB ){
 
 	//NaR or Zero
 	if ( uiA==0x8000 || uiB==0x8000 ){
+		SOFTPOSIT_STAT_NAR( p16 );
 		uZ.ui = 0x8000;
 		return uZ.p;
 	}
@@ -141,14 +143,16 @@ posit16_t p16_mul( posit16_t pA, posit16_t pB ){
 	if(regA>14){
 		//max or min pos. exp and frac does not matter.
 		(regSA) ? (uZ.ui= 0x7FFF): (uZ.ui=0x1);
+		SOFTPOSIT_SATURATED( p16, regSA, !regSA || regA>15 || expA || (frac32Z&0xFFFFFFF) );
 	}
 	else{
 		//remove carry and rcarry bits and shift to correct position
+		if (frac32Z & ((1<<(regA-1))-1)) bitsMore=1;
 		frac32Z = (frac32Z&0xFFFFFFF) >> (regA-1);
 		fracA = (uint_fast16_t) (frac32Z>>16);
 
 		if (regA!=14) bitNPlusOne |= (0x8000 & frac32Z) ;
-		else if (fracA>0){
+		else if (frac32Z>0){
 			fracA=0;
 			bitsMore =1;
 		}
@@ -156,6 +160,7 @@ posit16_t p16_mul( posit16_t pA, posit16_t pB ){
 
 		//sign is always zero
 		uZ.ui = packToP16UI(regime, regA, expA, fracA);
+		SOFTPOSIT_ROUNDED( p16, bitNPlusOne, bitsMore || (0x7FFF & frac32Z), uZ.ui&1 );
 		//n+1 frac bit is 1. Need to check if another bit is 1 too if not round to even
 		if (bitNPlusOne){
 			if (0x7FFF & frac32Z) bitsMore=1;
@@ -51,6 +51,7 @@ posit16_t p16_mulAdd( posit16_t a, posit16_t b, posit16_t c )
     union ui16_p16 uC;
     uint_fast16_t uiC;
 
+    SOFTPOSIT_STAT_OP( mulAdd, p16 );
     uA.p = a;
     uiA = uA.ui;
     uB.p = b;
@@ -53,11 +53,13 @@ posit16_t p16_sqrt( posit16_t pA ) {
     int_fast16_t kZ;
     bool bitNPlusOne;
 
+    SOFTPOSIT_STAT_OP( sqrt, p16 );
     uA.p = pA;
     uiA = uA.ui;
 
     // If sign bit is set, return NaR.
     if (uiA>>15) {
+        SOFTPOSIT_STAT_NAR( p16 );
         uA.ui = 0x8000;
         return uA.p;
     }
@@ -66,6 +68,13 @@ posit16_t p16_sqrt( posit16_t pA ) {
         uA.ui = 0;
         return uA.p;
     }
+    // maxpos = 2^28 has the exact root 2^14, which the off-by-one trick below
+    // cannot tell apart from an inexact one once the fraction is shifted out.
+    if (uiA==0x7FFF) {
+        SOFTPOSIT_ROUNDED( p16, 0, 0, 0 );
+        uA.ui = 0x7F80;
+        return uA.p;
+    }
     // Compute the square root. Here, kZ is the net power-of-2 scaling of the result.
     // Decode the regime and exponent bit; scale the input to be in the range 1 to 4:
 	if (uiA >> 14) {
@@ -133,6 +142,7 @@ posit16_t p16_sqrt( posit16_t pA ) {
 	// Strip off the hidden bit and round-to-nearest using last 4 bits.
 	fracZ -= (0x10000 >> shift);
 	bitNPlusOne = (fracZ >> 3) & 1;
+	SOFTPOSIT_ROUNDED( p16, bitNPlusOne, fracZ & 7, (fracZ >> 4) & 1 );
 	if (bitNPlusOne) {
 		if (((fracZ >> 4) & 1) | (fracZ & 7)) fracZ += 0x10;
 	}
@@ -50,33 +50,21 @@ posit16_t p16_sub( posit16_t a, posit16_t b ){
     uint_fast16_t uiA, uiB;
     union ui16_p16 uZ;
 
+    SOFTPOSIT_STAT_OP( sub, p16 );
     uA.p = a;
 	uiA = uA.ui;
 	uB.p = b;
 	uiB = uB.ui;
 
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.exact = (uiA.ui.exact & uiB.ui.exact);
-#endif
-
     //infinity
 	if ( uiA==0x8000 || uiB==0x8000 ){
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = 0x8000;
-		uZ.ui.exact = 0;
-#else
+		SOFTPOSIT_STAT_NAR( p16 );
 		uZ.ui = 0x8000;
-#endif
 		return uZ.p;
 	}
     //Zero
 	else if ( uiA==0 || uiB==0 ){
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = (uiA | -uiB);
-		uZ.ui.exact = 0;
-#else
 		uZ.ui = (uiA | -uiB);
-#endif
 		return uZ.p;
 	}
 
@@ -46,33 +46,21 @@ posit32_t p32_add( posit32_t a, posit32_t b ){
     union ui32_p32 uA, uB, uZ;
     uint_fast32_t uiA, uiB;
 
+    SOFTPOSIT_STAT_OP( add, p32 );
     uA.p = a;
 	uiA = uA.ui;
 	uB.p = b;
 	uiB = uB.ui;
 
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.exact = (uiA.ui.exact & uiB.ui.exact);
-#endif
-
     //Zero or infinity
 	if (uiA==0 || uiB==0){ // Not required but put here for speed
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = uiA | uiB;
-		uZ.ui.exact = (uiA.ui.exact & uiB.ui.exact);
-#else
 		uZ.ui = uiA | uiB;
-#endif
 		return uZ.p;
 	}
 	else if ( uiA==0x80000000 || uiB==0x80000000 ){
+		SOFTPOSIT_STAT_NAR( p32 );
 		//printf("in infinity\n");
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = 0x80000000;
-		uZ.ui.exact = 0;
-#else
 		uZ.ui = 0x80000000;
-#endif
 		return uZ.p;
 	}
 
@@ -0,0 +1,138 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Complex 32-bit posits.  Products and dot products accumulate the real and
+| imaginary parts in separate quires, so each component is rounded once
+| instead of after every multiply and add.  The _n kernels work on split
+| (structure of arrays) real and imaginary arrays; outputs may alias inputs.
+*----------------------------------------------------------------------------*/
+cposit32_t cp32_add( cposit32_t a, cposit32_t b ){
+	cposit32_t z;
+
+	z.re = p32_add( a.re, b.re );
+	z.im = p32_add( a.im, b.im );
+	return z;
+}
+
+cposit32_t cp32_sub( cposit32_t a, cposit32_t b ){
+	cposit32_t z;
+
+	z.re = p32_sub( a.re, b.re );
+	z.im = p32_sub( a.im, b.im );
+	return z;
+}
+
+cposit32_t cp32_mul( cposit32_t a, cposit32_t b ){
+	cposit32_t z;
+
+	z.re = q32_to_p32( q32_fdp_sub( q32_fdp_add( q32Clr(), a.re, b.re ), a.im, b.im ) );
+	z.im = q32_to_p32( q32_fdp_add( q32_fdp_add( q32Clr(), a.re, b.im ), a.im, b.re ) );
+	return z;
+}
+
+//a*conj(b) and |b|^2 are each rounded once before the final divisions
+cposit32_t cp32_div( cposit32_t a, cposit32_t b ){
+	posit32_t d;
+	cposit32_t z;
+
+	d = q32_to_p32( q32_fdp_add( q32_fdp_add( q32Clr(), b.re, b.re ), b.im, b.im ) );
+	z.re = q32_to_p32( q32_fdp_add( q32_fdp_add( q32Clr(), a.re, b.re ), a.im, b.im ) );
+	z.im = q32_to_p32( q32_fdp_sub( q32_fdp_add( q32Clr(), a.im, b.re ), a.re, b.im ) );
+	z.re = p32_div( z.re, d );
+	z.im = p32_div( z.im, d );
+	return z;
+}
+
+cposit32_t cp32_conj( cposit32_t a ){
+	a.im.v = -a.im.v;
+	return a;
+}
+
+//|a|^2, rounded once
+posit32_t cp32_norm( cposit32_t a ){
+	return q32_to_p32( q32_fdp_add( q32_fdp_add( q32Clr(), a.re, a.re ), a.im, a.im ) );
+}
+
+posit32_t cp32_abs( cposit32_t a ){
+	return p32_sqrt( cp32_norm( a ) );
+}
+
+void cp32_mul_n( const posit32_t * ar, const posit32_t * ai, const posit32_t * br, const posit32_t * bi, size_t n,
+		posit32_t * zr, posit32_t * zi ){
+	cposit32_t a, b, z;
+	size_t i;
+
+	for (i=0; i<n; i++){
+		a.re = ar[i]; a.im = ai[i];
+		b.re = br[i]; b.im = bi[i];
+		z = cp32_mul( a, b );
+		zr[i] = z.re;
+		zi[i] = z.im;
+	}
+}
+
+//sum of conj(a[i])*b[i], rounded once per component
+cposit32_t cp32_dotc_n( const posit32_t * ar, const posit32_t * ai, const posit32_t * br, const posit32_t * bi, size_t n ){
+	quire32_t qR = q32Clr(), qI = q32Clr();
+	cposit32_t z;
+	size_t i;
+
+	for (i=0; i<n; i++){
+		qR = q32_fdp_add( q32_fdp_add( qR, ar[i], br[i] ), ai[i], bi[i] );
+		qI = q32_fdp_sub( q32_fdp_add( qI, ar[i], bi[i] ), ai[i], br[i] );
+	}
+	z.re = q32_to_p32( qR );
+	z.im = q32_to_p32( qI );
+	return z;
+}
+
+void cp32_abs_n( const posit32_t * ar, const posit32_t * ai, size_t n, posit32_t * z ){
+	cposit32_t a;
+	size_t i;
+
+	for (i=0; i<n; i++){
+		a.re = ar[i]; a.im = ai[i];
+		z[i] = cp32_abs( a );
+	}
+}
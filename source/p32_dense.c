@@ -0,0 +1,321 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Dense LU (partial pivoting) and Cholesky factorisation for 32-bit posits,
+| row-major with leading dimension lda.  Both are blocked and right-looking:
+| a narrow panel is factored, then the trailing matrix is updated by
+| threads, each updated entry being its old value minus a panel-wide dot
+| product accumulated in the quire and rounded once.  The triangular solves
+| round every component once from the quire too.
+*----------------------------------------------------------------------------*/
+#define P32_BLOCK 32
+
+static inline quire32_t p32_quireFrom( posit32_t a ){
+	posit32_t one = { .v = 0x40000000 };
+	return q32_fdp_add( q32Clr(), a, one );
+}
+
+//Orders magnitudes like their bit patterns; NaR ranks above every real
+//value, so a column holding it pivots on it and the factors show NaR
+static inline uint32_t p32_absOrder( posit32_t a ){
+	if (a.v==0x80000000) return UINT32_MAX;
+	return (a.v>>31) ? 0u-a.v : a.v;
+}
+
+typedef struct {
+	posit32_t * A;
+	size_t n, lda, k0, kb;
+} p32_denseTask;
+
+//Rows k0+kb.. of A22 -= L21*U12
+static void p32_luUpdatePart( void * arg, int part, int nParts ){
+	const p32_denseTask * t = arg;
+	posit32_t * A = t->A;
+	size_t first = t->k0 + t->kb, rows = t->n - first, lda = t->lda, i, j, m;
+	size_t i0 = first + rows*part/nParts, i1 = first + rows*(part+1)/nParts;
+	quire32_t qZ;
+
+	for (i=i0; i<i1; i++){
+		for (j=first; j<t->n; j++){
+			qZ = p32_quireFrom( A[i*lda+j] );
+			for (m=t->k0; m<first; m++) qZ = q32_fdp_sub( qZ, A[i*lda+m], A[m*lda+j] );
+			A[i*lda+j] = q32_to_p32( qZ );
+		}
+	}
+}
+
+//U12 = L11^-1 * A12, by columns
+static void p32_luSolvePanelPart( void * arg, int part, int nParts ){
+	const p32_denseTask * t = arg;
+	posit32_t * A = t->A;
+	size_t first = t->k0 + t->kb, cols = t->n - first, lda = t->lda, j, k, m;
+	size_t j0 = first + cols*part/nParts, j1 = first + cols*(part+1)/nParts;
+	quire32_t qZ;
+
+	for (j=j0; j<j1; j++){
+		for (k=t->k0+1; k<first; k++){
+			qZ = p32_quireFrom( A[k*lda+j] );
+			for (m=t->k0; m<k; m++) qZ = q32_fdp_sub( qZ, A[k*lda+m], A[m*lda+j] );
+			A[k*lda+j] = q32_to_p32( qZ );
+		}
+	}
+}
+
+/*----------------------------------------------------------------------------
+| PA = LU in place, L unit lower.  piv[k] is the row swapped with row k.
+| Returns 0, or k+1 if U[k][k] is zero (the factorisation is still completed).
+*----------------------------------------------------------------------------*/
+int p32_luFactor( posit32_t * A, size_t n, size_t lda, size_t * piv, int nThreads ){
+	p32_denseTask t = { A, n, lda, 0, 0 };
+	size_t k0, k, i, j, p;
+	posit32_t pivot, tmp, l;
+	int info = 0;
+
+	for (k0=0; k0<n; k0+=P32_BLOCK){
+		t.k0 = k0;
+		t.kb = (n-k0<P32_BLOCK) ? n-k0 : P32_BLOCK;
+		for (k=k0; k<k0+t.kb; k++){
+			p = k;
+			for (i=k+1; i<n; i++)
+				if (p32_absOrder( A[i*lda+k] )>p32_absOrder( A[p*lda+k] )) p = i;
+			piv[k] = p;
+			if (p!=k){
+				for (j=0; j<n; j++){
+					tmp = A[k*lda+j];
+					A[k*lda+j] = A[p*lda+j];
+					A[p*lda+j] = tmp;
+				}
+			}
+			pivot = A[k*lda+k];
+			if (pivot.v==0){
+				if (!info) info = (int) k+1;
+				continue;
+			}
+			for (i=k+1; i<n; i++){
+				l = p32_div( A[i*lda+k], pivot );
+				A[i*lda+k] = l;
+				l.v = -l.v;
+				for (j=k+1; j<k0+t.kb; j++) A[i*lda+j] = p32_mulAdd( l, A[k*lda+j], A[i*lda+j] );
+			}
+		}
+		if (k0+t.kb<n){
+			softposit_parallelRun( nThreads, p32_luSolvePanelPart, &t );
+			softposit_parallelRun( nThreads, p32_luUpdatePart, &t );
+		}
+	}
+	return info;
+}
+
+//Solves A*x = b in place in b using the factors from p32_luFactor
+void p32_luSolve( const posit32_t * LU, size_t n, size_t lda, const size_t * piv, posit32_t * b ){
+	size_t i, m;
+	posit32_t tmp;
+	quire32_t qZ;
+
+	for (i=0; i<n; i++){
+		if (piv[i]!=i){
+			tmp = b[i];
+			b[i] = b[piv[i]];
+			b[piv[i]] = tmp;
+		}
+	}
+	for (i=0; i<n; i++){
+		qZ = p32_quireFrom( b[i] );
+		for (m=0; m<i; m++) qZ = q32_fdp_sub( qZ, LU[i*lda+m], b[m] );
+		b[i] = q32_to_p32( qZ );
+	}
+	for (i=n; i-->0;){
+		qZ = p32_quireFrom( b[i] );
+		for (m=i+1; m<n; m++) qZ = q32_fdp_sub( qZ, LU[i*lda+m], b[m] );
+		b[i] = p32_div( q32_to_p32( qZ ), LU[i*lda+i] );
+	}
+}
+
+//Lower triangle of rows k0+kb.. -= L21*L21^T; rows dealt round-robin for balance
+static void p32_cholUpdatePart( void * arg, int part, int nParts ){
+	const p32_denseTask * t = arg;
+	posit32_t * A = t->A;
+	size_t first = t->k0 + t->kb, lda = t->lda, i, j, m;
+	quire32_t qZ;
+
+	for (i=first+part; i<t->n; i+=nParts){
+		for (j=first; j<=i; j++){
+			qZ = p32_quireFrom( A[i*lda+j] );
+			for (m=t->k0; m<first; m++) qZ = q32_fdp_sub( qZ, A[i*lda+m], A[j*lda+m] );
+			A[i*lda+j] = q32_to_p32( qZ );
+		}
+	}
+}
+
+/*----------------------------------------------------------------------------
+| A = L*L^T in place in the lower triangle; the strict upper triangle is not
+| referenced.  Returns 0, or k+1 if the leading minor of order k+1 is not
+| positive (factorisation stops there).
+*----------------------------------------------------------------------------*/
+int p32_cholFactor( posit32_t * A, size_t n, size_t lda, int nThreads ){
+	p32_denseTask t = { A, n, lda, 0, 0 };
+	size_t k0, k, i, m;
+	posit32_t d;
+	quire32_t qZ;
+
+	for (k0=0; k0<n; k0+=P32_BLOCK){
+		t.k0 = k0;
+		t.kb = (n-k0<P32_BLOCK) ? n-k0 : P32_BLOCK;
+		for (k=k0; k<k0+t.kb; k++){
+			qZ = p32_quireFrom( A[k*lda+k] );
+			for (m=k0; m<k; m++) qZ = q32_fdp_sub( qZ, A[k*lda+m], A[k*lda+m] );
+			d = q32_to_p32( qZ );
+			if ((int32_t) d.v<=0) return (int) k+1;
+			d = p32_sqrt( d );
+			A[k*lda+k] = d;
+			for (i=k+1; i<n; i++){
+				qZ = p32_quireFrom( A[i*lda+k] );
+				for (m=k0; m<k; m++) qZ = q32_fdp_sub( qZ, A[i*lda+m], A[k*lda+m] );
+				A[i*lda+k] = p32_div( q32_to_p32( qZ ), d );
+			}
+		}
+		if (k0+t.kb<n) softposit_parallelRun( nThreads, p32_cholUpdatePart, &t );
+	}
+	return 0;
+}
+
+//Solves A*x = b in place in b using the factor from p32_cholFactor
+void p32_cholSolve( const posit32_t * L, size_t n, size_t lda, posit32_t * b ){
+	size_t i, m;
+	quire32_t qZ;
+
+	for (i=0; i<n; i++){
+		qZ = p32_quireFrom( b[i] );
+		for (m=0; m<i; m++) qZ = q32_fdp_sub( qZ, L[i*lda+m], b[m] );
+		b[i] = p32_div( q32_to_p32( qZ ), L[i*lda+i] );
+	}
+	for (i=n; i-->0;){
+		qZ = p32_quireFrom( b[i] );
+		for (m=i+1; m<n; m++) qZ = q32_fdp_sub( qZ, L[m*lda+i], b[m] );
+		b[i] = p32_div( q32_to_p32( qZ ), L[i*lda+i] );
+	}
+}
+
+/*----------------------------------------------------------------------------
+| Mixed-precision solve of A*x = b: A is factored in posit16, then x is
+| refined in posit32 with residuals b - A*x computed exactly in the quire.
+| Each residual is scaled by a power of two to sit near 1, where posit16
+| is most precise, before the posit16 correction solve.  Stops when a
+| correction no longer changes x, when the residual stops shrinking, or
+| after maxIter steps.  Returns the number of refinement steps, or -1 if
+| the posit16 factorisation fails or memory runs out.
+*----------------------------------------------------------------------------*/
+static int p32_refine( const posit32_t * A, size_t n, size_t lda, const posit32_t * b, posit32_t * x,
+		const posit16_t * F, size_t ldf, const size_t * piv, posit32_t * r, posit16_t * d, int maxIter ){
+
+	posit32_t one = { .v = 0x40000000 }, xNew;
+	quire32_t qZ;
+	double norm, lastNorm = HUGE_VAL, v;
+	size_t i, j;
+	int iter, e, changed;
+
+	for (iter=0; iter<maxIter; iter++){
+		norm = 0;
+		for (i=0; i<n; i++){
+			qZ = q32_fdp_add( q32Clr(), b[i], one );
+			for (j=0; j<n; j++) qZ = q32_fdp_sub( qZ, A[i*lda+j], x[j] );
+			r[i] = q32_to_p32( qZ );
+			v = fabs( convertP32ToDouble( r[i] ) );
+			if (v>norm) norm = v;
+		}
+		if (norm==0 || !(norm<lastNorm)) break;
+		lastNorm = norm;
+		frexp( norm, &e );
+		for (i=0; i<n; i++) d[i] = convertDoubleToP16( ldexp( convertP32ToDouble( r[i] ), -e ) );
+		if (piv) p16_luSolve( F, n, ldf, piv, d );
+		else p16_cholSolve( F, n, ldf, d );
+		changed = 0;
+		for (i=0; i<n; i++){
+			xNew = p32_add( x[i], convertDoubleToP32( ldexp( convertP16ToDouble( d[i] ), e ) ) );
+			changed |= xNew.v!=x[i].v;
+			x[i] = xNew;
+		}
+		if (!changed) break;
+	}
+	return iter;
+}
+
+static int p32_solveRefine( const posit32_t * A, size_t n, size_t lda, const posit32_t * b, posit32_t * x,
+		int maxIter, int nThreads, bool cholesky ){
+
+	posit16_t * F = malloc( n*n*sizeof *F + 1 ), * d = malloc( n*sizeof *d + 1 );
+	posit32_t * r = malloc( n*sizeof *r + 1 );
+	size_t * piv = cholesky ? 0 : malloc( n*sizeof *piv + 1 ), i, j;
+	int rc = -1;
+
+	if (!F || !d || !r || (!cholesky && !piv)) goto done;
+	for (i=0; i<n; i++)
+		for (j=0; j<n; j++) F[i*n+j].v = softposit_convertPX( A[i*lda+j].v, 2, 16, 1 )>>16;
+	if (cholesky ? p16_cholFactor( F, n, n, nThreads ) : p16_luFactor( F, n, n, piv, nThreads )) goto done;
+	for (i=0; i<n; i++) d[i].v = softposit_convertPX( b[i].v, 2, 16, 1 )>>16;
+	if (cholesky) p16_cholSolve( F, n, n, d );
+	else p16_luSolve( F, n, n, piv, d );
+	for (i=0; i<n; i++) x[i].v = softposit_convertPX( (uint_fast32_t) d[i].v<<16, 1, 32, 2 );
+	rc = p32_refine( A, n, lda, b, x, F, n, piv, r, d, maxIter );
+
+done:
+	free( F );
+	free( d );
+	free( r );
+	free( piv );
+	return rc;
+}
+
+int p32_luSolveRefine( const posit32_t * A, size_t n, size_t lda, const posit32_t * b, posit32_t * x,
+		int maxIter, int nThreads ){
+	return p32_solveRefine( A, n, lda, b, x, maxIter, nThreads, 0 );
+}
+
+int p32_cholSolveRefine( const posit32_t * A, size_t n, size_t lda, const posit32_t * b, posit32_t * x,
+		int maxIter, int nThreads ){
+	return p32_solveRefine( A, n, lda, b, x, maxIter, nThreads, 1 );
+}
@@ -53,6 +53,7 @@ posit32_t p32_div( posit32_t pA, posit32_t pB )
 	uint_fast64_t frac64A, frac64Z, rem;
 	lldiv_t divresult;
 
+	SOFTPOSIT_STAT_OP( div, p32 );
 	uA.p = pA;
 	uiA = uA.ui;
 	uB.p = pB;
@@ -60,25 +61,12 @@ posit32_t p32_div( posit32_t pA, posit32_t pB )
 
 	//Zero or infinity
 	if ( uiA==0x80000000 || uiB==0x80000000 || uiB==0){
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = 0x80000000;
-		uZ.ui.exact = 0;
-#else
+		SOFTPOSIT_STAT_NAR( p32 );
 		uZ.ui = 0x80000000;
-#endif
 		return uZ.p;
 	}
 	else if (uiA==0){
-#ifdef SOFTPOSIT_EXACT
-
-		uZ.ui.v = 0;
-		if ( (uiA==0 && uiA.ui.exact) || (uiB==0 && uiB.ui.exact) )
-			uZ.ui.exact = 1;
-		else
-			uZ.ui.exact = 0;
-#else
 		uZ.ui = 0;
-#endif
 		return uZ.p;
 	}
 
@@ -161,6 +149,7 @@ posit32_t p32_div( posit32_t pA, posit32_t pB )
 	if(regA>30){
 		//max or min pos. exp and frac does not matter.
 		(regSA) ? (uZ.ui= 0x7FFFFFFF): (uZ.ui=0x1);
+		SOFTPOSIT_SATURATED( p32, regSA, !regSA || regA>31 || expA || (frac64Z&0x3FFFFFFF) || rem );
 	}
 	else{
 		//remove carry and rcarry bits and shift to correct position
@@ -192,6 +181,7 @@ posit32_t p32_div( posit32_t pA, posit32_t pB )
 		if (rem) bitsMore =1;
 
 		uZ.ui = packToP32UI(regime, expA, fracA);
+		SOFTPOSIT_ROUNDED( p32, bitNPlusOne, bitsMore || (regA<=28 && (((1<<(regA+1))-1) & frac64Z)), uZ.ui&1 );
 		if (bitNPlusOne) uZ.ui += (uZ.ui&1) | bitsMore;
 	}
 
@@ -0,0 +1,466 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <math.h>
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Elementary functions for posit32.  A posit32 has at most 28 significant
+| bits, so arguments decode exactly into doubles and the kernels below run in
+| double precision.  That leaves over 20 guard bits for the single final
+| rounding, which is therefore correct except in very rare near-tie cases and
+| never more than 1 ulp off.  Results that can leave the double range are
+| carried as m * 2^k and k is added to the scale when packing.
+*----------------------------------------------------------------------------*/
+#define P32_PIO2_1  0x1.921fb544p+0       //pi/2 in three 33-bit pieces
+#define P32_PIO2_2  0x1.0b4611a6p-34
+#define P32_PIO2_3  0x1.3198a2e037073p-69
+#define P32_INVPIO2 0x1.45f306dc9c883p-1
+#define P32_PIO2    0x1.921fb54442d18p+0
+#define P32_PI      0x1.921fb54442d18p+1
+#define P32_LN2_HI  0x1.62e42feep-1       //ln 2 in a 32-bit and a full piece
+#define P32_LN2_LO  0x1.a39ef35793c76p-33
+#define P32_LN2     0x1.62e42fefa39efp-1
+#define P32_LOG2E   0x1.71547652b82fep+0
+#define P32_SQRT2   0x1.6a09e667f3bcdp+0
+
+//Taylor coefficients, each truncated where the next term drops below 2^-55
+static const double p32_expCoeffs[] = {
+	1.0/2, 1.0/6, 1.0/24, 1.0/120, 1.0/720, 1.0/5040, 1.0/40320, 1.0/362880,
+	1.0/3628800, 1.0/39916800, 1.0/479001600, 1.0/6227020800, 1.0/87178291200,
+	1.0/1307674368000, 1.0/20922789888000, 1.0/355687428096000,
+	1.0/6402373705728000
+};
+static const double p32_sinCoeffs[] = {
+	-1.0/6, 1.0/120, -1.0/5040, 1.0/362880, -1.0/39916800, 1.0/6227020800,
+	-1.0/1307674368000, 1.0/355687428096000
+};
+static const double p32_cosCoeffs[] = {
+	-1.0/2, 1.0/24, -1.0/720, 1.0/40320, -1.0/3628800, 1.0/479001600,
+	-1.0/87178291200, 1.0/20922789888000, -1.0/6402373705728000
+};
+static const double p32_atanCoeffs[] = {
+	-1.0/3, 1.0/5, -1.0/7, 1.0/9, -1.0/11, 1.0/13, -1.0/15, 1.0/17, -1.0/19
+};
+static const double p32_atanhCoeffs[] = {
+	1.0/3, 1.0/5, 1.0/7, 1.0/9, 1.0/11, 1.0/13, 1.0/15, 1.0/17, 1.0/19, 1.0/21
+};
+
+static double p32_horner( const double * c, int n, double x ){
+	double p = c[n-1];
+	for (int i=n-2; i>=0; i--) p = p*x + c[i];
+	return p;
+}
+
+/*----------------------------------------------------------------------------
+| Decodes a nonzero, non-NaR magnitude into 2^scale * m with m in [1, 2).
+*----------------------------------------------------------------------------*/
+static int_fast32_t p32_decode( uint_fast32_t uiA, double * m ){
+	uint_fast64_t sig;
+	int_fast32_t scale = softposit_decodeMagPX((uint_fast64_t)uiA<<32, 2, &sig);
+	*m = (double)(sig>>11) * 0x1p-52;
+	return scale;
+}
+
+static double p32_toDouble( uint_fast32_t uiA ){
+	union ui64_double uZ;
+	uint_fast64_t sig;
+	bool sign = signP32UI( uiA );
+	int_fast32_t scale;
+
+	if (sign) uiA = -uiA & 0xFFFFFFFF;
+	scale = softposit_decodeMagPX((uint_fast64_t)uiA<<32, 2, &sig);
+	uZ.ui = ((uint64_t)sign<<63) | ((uint64_t)(scale+1023)<<52) | ((sig<<1)>>12);
+	return uZ.d;
+}
+
+//Rounds the nonzero value d * 2^k to posit32
+static posit32_t p32_fromScaledDouble( double d, int_fast32_t k ){
+	union ui64_double uD;
+	union ui32_p32 uZ;
+	int_fast32_t expD;
+	bool sign;
+
+	uD.d = d;
+	sign = uD.ui>>63;
+	expD = (uD.ui>>52) & 0x7FF;
+	if (expD==0)
+		uZ.ui = 1;
+	else
+		uZ.ui = softposit_roundPackMagPX(
+				expD-1023+k, (uD.ui<<11) | 0x8000000000000000ULL, 0, 32, 2);
+	if (sign) uZ.ui = -uZ.ui & 0xFFFFFFFF;
+	return uZ.p;
+}
+
+//e^r - 1 for |r| < 1.1
+static double p32_expm1Kernel( double r ){
+	return r + r*r*p32_horner(p32_expCoeffs, 17, r);
+}
+
+//e^x = m * 2^k with m in [0.7, 1.42]
+static double p32_expScaled( double x, int_fast32_t * k ){
+	double n = nearbyint(x*P32_LOG2E);
+	double r = (x - n*P32_LN2_HI) - n*P32_LN2_LO;
+	*k = (int_fast32_t) n;
+	return 1 + p32_expm1Kernel(r);
+}
+
+//ln m for m in [sqrt(1/2), sqrt(2)], as 2 atanh((m-1)/(m+1))
+static double p32_logKernel( double m ){
+	double s = (m-1)/(m+1);
+	double z = s*s;
+	return 2*s + 2*s*z*p32_horner(p32_atanhCoeffs, 10, z);
+}
+
+static int_fast32_t p32_logDecode( uint_fast32_t uiA, double * lnM ){
+	double m;
+	int_fast32_t scale = p32_decode(uiA, &m);
+	if (m>P32_SQRT2){
+		m *= 0.5;
+		scale++;
+	}
+	*lnM = p32_logKernel(m);
+	return scale;
+}
+
+static double p32_sinKernel( double r ){
+	double z = r*r;
+	return r + r*z*p32_horner(p32_sinCoeffs, 8, z);
+}
+
+static double p32_cosKernel( double r ){
+	double z = r*r;
+	return 1 + z*p32_horner(p32_cosCoeffs, 9, z);
+}
+
+//Cody-Waite reduction, exact enough for |x| < 2^20
+static int p32_reducePio2( double x, double * r ){
+	double n = nearbyint(x*P32_INVPIO2);
+	*r = ((x - n*P32_PIO2_1) - n*P32_PIO2_2) - n*P32_PIO2_3;
+	return (int) ((int_fast64_t) n & 3);
+}
+
+//atan t for 0 <= t <= 1; three argument halvings bring t below tan(pi/32)
+static double p32_atanKernel( double t ){
+	double z;
+	for (int i=0; i<3; i++)
+		t = t/(1 + sqrt(1 + t*t));
+	z = t*t;
+	return 8*(t + t*z*p32_horner(p32_atanCoeffs, 9, z));
+}
+
+posit32_t p32_exp( posit32_t pA ){
+	union ui32_p32 uA, uZ;
+	int_fast32_t k;
+	double x, m;
+
+	uA.p = pA;
+	if (uA.ui==0x80000000) return pA;
+	if (uA.ui==0){
+		uZ.ui = 0x40000000;
+		return uZ.p;
+	}
+	x = p32_toDouble(uA.ui);
+	//|x| > 128 ln 2 is far past maxpos = 2^120
+	if (x>89){
+		uZ.ui = 0x7FFFFFFF;
+		return uZ.p;
+	}
+	if (x<-89){
+		uZ.ui = 0x1;
+		return uZ.p;
+	}
+	m = p32_expScaled(x, &k);
+	return p32_fromScaledDouble(m, k);
+}
+
+posit32_t p32_exp2( posit32_t pA ){
+	union ui32_p32 uA, uZ;
+	double x, n;
+
+	uA.p = pA;
+	if (uA.ui==0x80000000) return pA;
+	if (uA.ui==0){
+		uZ.ui = 0x40000000;
+		return uZ.p;
+	}
+	x = p32_toDouble(uA.ui);
+	if (x>128){
+		uZ.ui = 0x7FFFFFFF;
+		return uZ.p;
+	}
+	if (x<-128){
+		uZ.ui = 0x1;
+		return uZ.p;
+	}
+	n = nearbyint(x);
+	//x - n is exact, and zero for integer x so powers of two come out exact
+	return p32_fromScaledDouble(1 + p32_expm1Kernel((x-n)*P32_LN2), (int_fast32_t)n);
+}
+
+posit32_t p32_log( posit32_t pA ){
+	union ui32_p32 uA, uZ;
+	int_fast32_t scale;
+	double lnM;
+
+	uA.p = pA;
+	//log of zero and of negative numbers is NaR
+	if (uA.ui==0 || signP32UI(uA.ui)){
+		uZ.ui = 0x80000000;
+		return uZ.p;
+	}
+	if (uA.ui==0x40000000){
+		uZ.ui = 0;
+		return uZ.p;
+	}
+	scale = p32_logDecode(uA.ui, &lnM);
+	return p32_fromScaledDouble(scale*P32_LN2_HI + (scale*P32_LN2_LO + lnM), 0);
+}
+
+posit32_t p32_log2( posit32_t pA ){
+	union ui32_p32 uA, uZ;
+	int_fast32_t scale;
+	double lnM;
+
+	uA.p = pA;
+	if (uA.ui==0 || signP32UI(uA.ui)){
+		uZ.ui = 0x80000000;
+		return uZ.p;
+	}
+	scale = p32_logDecode(uA.ui, &lnM);
+	if (lnM==0){
+		//exact power of two
+		if (scale==0){
+			uZ.ui = 0;
+			return uZ.p;
+		}
+		return p32_fromScaledDouble((double)scale, 0);
+	}
+	return p32_fromScaledDouble(scale + lnM*P32_LOG2E, 0);
+}
+
+posit32_t p32_sin( posit32_t pA ){
+	union ui32_p32 uA;
+	double x, r, z;
+
+	uA.p = pA;
+	if (uA.ui==0 || uA.ui==0x80000000) return pA;
+	x = p32_toDouble(uA.ui);
+	if (fabs(x)>=0x1p20)
+		return p32_fromScaledDouble(sin(x), 0);
+	switch (p32_reducePio2(x, &r)){
+		case 0: z = p32_sinKernel(r); break;
+		case 1: z = p32_cosKernel(r); break;
+		case 2: z = -p32_sinKernel(r); break;
+		default: z = -p32_cosKernel(r); break;
+	}
+	return p32_fromScaledDouble(z, 0);
+}
+
+posit32_t p32_cos( posit32_t pA ){
+	union ui32_p32 uA, uZ;
+	double x, r, z;
+
+	uA.p = pA;
+	if (uA.ui==0x80000000) return pA;
+	if (uA.ui==0){
+		uZ.ui = 0x40000000;
+		return uZ.p;
+	}
+	x = p32_toDouble(uA.ui);
+	if (fabs(x)>=0x1p20)
+		return p32_fromScaledDouble(cos(x), 0);
+	switch (p32_reducePio2(x, &r)){
+		case 0: z = p32_cosKernel(r); break;
+		case 1: z = -p32_sinKernel(r); break;
+		case 2: z = -p32_cosKernel(r); break;
+		default: z = p32_sinKernel(r); break;
+	}
+	return p32_fromScaledDouble(z, 0);
+}
+
+posit32_t p32_tanh( posit32_t pA ){
+	union ui32_p32 uA, uZ;
+	int_fast32_t k;
+	double x, z, e;
+
+	uA.p = pA;
+	if (uA.ui==0 || uA.ui==0x80000000) return pA;
+	x = fabs(p32_toDouble(uA.ui));
+	//1 - tanh x < 2^-29 already rounds to 1
+	if (x>22)
+		uZ.ui = 0x40000000;
+	else{
+		if (x<0.55){
+			//no cancellation near 0
+			e = p32_expm1Kernel(2*x);
+			z = e/(e+2);
+		}
+		else{
+			e = p32_expScaled(2*x, &k);
+			z = 1 - 2/(ldexp(e, k)+1);
+		}
+		uZ.p = p32_fromScaledDouble(z, 0);
+	}
+	if (signP32UI(uA.ui)) uZ.ui = -uZ.ui & 0xFFFFFFFF;
+	return uZ.p;
+}
+
+/*----------------------------------------------------------------------------
+| pow is NaR when either argument is NaR, for 0 to a non-positive power, and
+| for a negative base with a non-integer exponent.  x^0 is 1 for any other x.
+*----------------------------------------------------------------------------*/
+posit32_t p32_pow( posit32_t pA, posit32_t pB ){
+	union ui32_p32 uA, uB, uZ;
+	int_fast32_t scale;
+	double y, t, n, lnM;
+	bool sign = 0;
+
+	uA.p = pA;
+	uB.p = pB;
+	if (uA.ui==0x80000000 || uB.ui==0x80000000 || (uA.ui==0 && (uB.ui==0 || signP32UI(uB.ui)))){
+		uZ.ui = 0x80000000;
+		return uZ.p;
+	}
+	if (uB.ui==0 || uA.ui==0x40000000){
+		uZ.ui = 0x40000000;
+		return uZ.p;
+	}
+	if (uA.ui==0) return pA;
+
+	y = p32_toDouble(uB.ui);
+	if (signP32UI(uA.ui)){
+		if (nearbyint(y)!=y){
+			uZ.ui = 0x80000000;
+			return uZ.p;
+		}
+		sign = fmod(y, 2)!=0;
+		uA.ui = -uA.ui & 0xFFFFFFFF;
+	}
+
+	//|x|^y = 2^(y log2 |x|)
+	scale = p32_logDecode(uA.ui, &lnM);
+	t = y*(scale + lnM*P32_LOG2E);
+	if (t>128)
+		uZ.ui = 0x7FFFFFFF;
+	else if (t<-128)
+		uZ.ui = 0x1;
+	else{
+		n = nearbyint(t);
+		uZ.p = p32_fromScaledDouble(1 + p32_expm1Kernel((t-n)*P32_LN2), (int_fast32_t)n);
+	}
+	if (sign) uZ.ui = -uZ.ui & 0xFFFFFFFF;
+	return uZ.p;
+}
+
+/*----------------------------------------------------------------------------
+| atan2(y, x) in (-pi, pi].  atan2(0, 0) has no meaningful value and is NaR.
+*----------------------------------------------------------------------------*/
+posit32_t p32_atan2( posit32_t pY, posit32_t pX ){
+	union ui32_p32 uY, uX, uZ;
+	double y, x, z;
+
+	uY.p = pY;
+	uX.p = pX;
+	if (uY.ui==0x80000000 || uX.ui==0x80000000 || (uY.ui==0 && uX.ui==0)){
+		uZ.ui = 0x80000000;
+		return uZ.p;
+	}
+	if (uY.ui==0){
+		//+0 or pi
+		uZ.p = signP32UI(uX.ui) ? p32_fromScaledDouble(P32_PI, 0) : pY;
+		return uZ.p;
+	}
+	y = fabs(p32_toDouble(uY.ui));
+	x = (uX.ui==0) ? 0 : p32_toDouble(uX.ui);
+
+	if (y<=fabs(x))
+		z = p32_atanKernel(y/fabs(x));
+	else
+		z = P32_PIO2 - p32_atanKernel(fabs(x)/y);
+	if (x<0) z = P32_PI - z;
+
+	uZ.p = p32_fromScaledDouble(z, 0);
+	if (signP32UI(uY.ui)) uZ.ui = -uZ.ui & 0xFFFFFFFF;
+	return uZ.p;
+}
+
+/*----------------------------------------------------------------------------
+| Array forms.
+*----------------------------------------------------------------------------*/
+void p32_exp_n( const posit32_t * a, size_t n, posit32_t * z ){
+	for (size_t i=0; i<n; i++) z[i] = p32_exp(a[i]);
+}
+
+void p32_exp2_n( const posit32_t * a, size_t n, posit32_t * z ){
+	for (size_t i=0; i<n; i++) z[i] = p32_exp2(a[i]);
+}
+
+void p32_log_n( const posit32_t * a, size_t n, posit32_t * z ){
+	for (size_t i=0; i<n; i++) z[i] = p32_log(a[i]);
+}
+
+void p32_log2_n( const posit32_t * a, size_t n, posit32_t * z ){
+	for (size_t i=0; i<n; i++) z[i] = p32_log2(a[i]);
+}
+
+void p32_sin_n( const posit32_t * a, size_t n, posit32_t * z ){
+	for (size_t i=0; i<n; i++) z[i] = p32_sin(a[i]);
+}
+
+void p32_cos_n( const posit32_t * a, size_t n, posit32_t * z ){
+	for (size_t i=0; i<n; i++) z[i] = p32_cos(a[i]);
+}
+
+void p32_tanh_n( const posit32_t * a, size_t n, posit32_t * z ){
+	for (size_t i=0; i<n; i++) z[i] = p32_tanh(a[i]);
+}
+
+void p32_pow_n( const posit32_t * a, const posit32_t * b, size_t n, posit32_t * z ){
+	for (size_t i=0; i<n; i++) z[i] = p32_pow(a[i], b[i]);
+}
+
+void p32_atan2_n( const posit32_t * y, const posit32_t * x, size_t n, posit32_t * z ){
+	for (size_t i=0; i<n; i++) z[i] = p32_atan2(y[i], x[i]);
+}
+
@@ -0,0 +1,437 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <errno.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Complex and real FFTs for 32-bit posits on split real/imaginary arrays.
+| Power-of-two sizes only; transforms are unnormalised in both directions.
+| After a bit-reversal permutation the butterflies run depth-first (each
+| radix-4 step recurses into its four quarters before combining them), so
+| the working set shrinks to fit any cache level without tuning; an odd
+| power of two ends in radix-2 steps at the leaves.  With
+| SOFTPOSIT_FFT_QUIRE each butterfly output component is an exact quire sum
+| of twiddle products rounded once, instead of being rounded three or four
+| times.  Twiddles are rounded once from long double, computed in the first
+| octant and mapped out by symmetry.
+*----------------------------------------------------------------------------*/
+typedef struct {
+	const p32_fftPlan_t * plan;
+	posit32_t * re, * im;
+	bool inverse;
+} p32_fftRun;
+
+static posit32_t p32_fromLongDouble( long double v ){
+	posit32_t z;
+	uint_fast64_t sig;
+	int e;
+
+	if (v==0){
+		z.v = 0;
+		return z;
+	}
+	sig = (uint_fast64_t) ldexpl( frexpl( fabsl( v ), &e ), 64 );
+	z.v = softposit_packPX( v<0, e-1, sig, 0, 32, 2 );
+	return z;
+}
+
+static inline posit32_t p32_negate( posit32_t a ){
+	a.v = -a.v;
+	return a;
+}
+
+static inline quire32_t p32_quireFrom( posit32_t a ){
+	posit32_t one = { .v = 0x40000000 };
+	return q32_fdp_add( q32Clr(), a, one );
+}
+
+/*----------------------------------------------------------------------------
+| cos and sin of 2*pi*k/n, evaluated only in the first octant and mapped out
+| by symmetry, so multiples of a quarter turn give exact 0 and +-1 and the
+| table is exactly symmetric.  Angles are counted in units of 1/(8n) turn.
+*----------------------------------------------------------------------------*/
+static void p32_unitRoot( size_t k, size_t n, long double * c, long double * s ){
+	const long double pi = 3.141592653589793238462643383279502884L;
+	size_t u = 8*k, quadrant = u/(2*n), r = u%(2*n);
+	long double c0, s0;
+
+	if (r==0){
+		c0 = 1;
+		s0 = 0;
+	}
+	else if (r==n){
+		c0 = s0 = sqrtl( 0.5L );
+	}
+	else if (r<n){
+		c0 = cosl( pi*r/(4*n) );
+		s0 = sinl( pi*r/(4*n) );
+	}
+	else{
+		c0 = sinl( pi*(2*n-r)/(4*n) );
+		s0 = cosl( pi*(2*n-r)/(4*n) );
+	}
+	switch (quadrant){
+		case 0: *c = c0; *s = s0; break;
+		case 1: *c = -s0; *s = c0; break;
+		case 2: *c = -c0; *s = -s0; break;
+		default: *c = s0; *s = -c0; break;
+	}
+}
+
+int p32_fftPlan( p32_fftPlan_t * plan, size_t n, int flags ){
+	long double c, s;
+	size_t k;
+
+	plan->wr = plan->wi = plan->hwr = plan->hwi = 0;
+	if (n<1 || (n&(n-1))){
+		errno = EINVAL;
+		return -1;
+	}
+	plan->n = n;
+	plan->flags = flags;
+	plan->wr = malloc( n*sizeof *plan->wr );
+	plan->wi = malloc( n*sizeof *plan->wi );
+	plan->hwr = malloc( (n/2+1)*sizeof *plan->hwr );
+	plan->hwi = malloc( (n/2+1)*sizeof *plan->hwi );
+	if (!plan->wr || !plan->wi || !plan->hwr || !plan->hwi){
+		p32_fftPlanFree( plan );
+		errno = ENOMEM;
+		return -1;
+	}
+	//w^k = exp(-2*pi*i*k/n)
+	for (k=0; k<n; k++){
+		p32_unitRoot( k, n, &c, &s );
+		plan->wr[k] = p32_fromLongDouble( c );
+		plan->wi[k] = p32_fromLongDouble( -s );
+		if (k<=n/2){
+			plan->hwr[k] = p32_fromLongDouble( c/2 );
+			plan->hwi[k] = p32_fromLongDouble( -s/2 );
+		}
+	}
+	return 0;
+}
+
+void p32_fftPlanFree( p32_fftPlan_t * plan ){
+	free( plan->wr );
+	free( plan->wi );
+	free( plan->hwr );
+	free( plan->hwi );
+	plan->wr = plan->wi = plan->hwr = plan->hwi = 0;
+}
+
+static void p32_bitReverse( posit32_t * re, posit32_t * im, size_t n ){
+	size_t i, j = 0, bit;
+	posit32_t t;
+
+	for (i=1; i<n; i++){
+		for (bit=n>>1; j&bit; bit>>=1) j ^= bit;
+		j |= bit;
+		if (i<j){
+			t = re[i]; re[i] = re[j]; re[j] = t;
+			t = im[i]; im[i] = im[j]; im[j] = t;
+		}
+	}
+}
+
+//w^k for a butterfly spanning size points, conjugated for the inverse
+static inline void p32_twiddle( const p32_fftRun * r, size_t k, size_t size, posit32_t * wr, posit32_t * wi ){
+	size_t index = k * (r->plan->n/size);
+	*wr = r->plan->wr[index];
+	*wi = r->inverse ? p32_negate( r->plan->wi[index] ) : r->plan->wi[index];
+}
+
+//Real and imaginary parts of w*a, each rounded twice
+static inline posit32_t p32_mulRe( posit32_t wr, posit32_t wi, posit32_t ar, posit32_t ai ){
+	return p32_mulAdd( wr, ar, p32_negate( p32_mul( wi, ai ) ) );
+}
+
+static inline posit32_t p32_mulIm( posit32_t wr, posit32_t wi, posit32_t ar, posit32_t ai ){
+	return p32_mulAdd( wr, ai, p32_mul( wi, ar ) );
+}
+
+//q +/- Re(w*a) and q +/- Im(w*a), exactly
+static inline quire32_t p32_quireRe( quire32_t qZ, posit32_t wr, posit32_t wi, posit32_t ar, posit32_t ai, bool negative ){
+	if (negative) return q32_fdp_add( q32_fdp_sub( qZ, wr, ar ), wi, ai );
+	return q32_fdp_sub( q32_fdp_add( qZ, wr, ar ), wi, ai );
+}
+
+static inline quire32_t p32_quireIm( quire32_t qZ, posit32_t wr, posit32_t wi, posit32_t ar, posit32_t ai, bool negative ){
+	if (negative) return q32_fdp_sub( q32_fdp_sub( qZ, wr, ai ), wi, ar );
+	return q32_fdp_add( q32_fdp_add( qZ, wr, ai ), wi, ar );
+}
+
+static void p32_radix2( const p32_fftRun * r, size_t start, size_t size ){
+	posit32_t * re = r->re, * im = r->im, wr, wi, ar, ai, br, bi, tr, ti;
+	size_t half = size/2, k, a, b;
+
+	for (k=0; k<half; k++){
+		a = start + k;
+		b = a + half;
+		ar = re[a]; ai = im[a];
+		br = re[b]; bi = im[b];
+		p32_twiddle( r, k, size, &wr, &wi );
+		if (r->plan->flags & SOFTPOSIT_FFT_QUIRE){
+			re[a] = q32_to_p32( p32_quireRe( p32_quireFrom( ar ), wr, wi, br, bi, 0 ) );
+			im[a] = q32_to_p32( p32_quireIm( p32_quireFrom( ai ), wr, wi, br, bi, 0 ) );
+			re[b] = q32_to_p32( p32_quireRe( p32_quireFrom( ar ), wr, wi, br, bi, 1 ) );
+			im[b] = q32_to_p32( p32_quireIm( p32_quireFrom( ai ), wr, wi, br, bi, 1 ) );
+		}
+		else{
+			tr = p32_mulRe( wr, wi, br, bi );
+			ti = p32_mulIm( wr, wi, br, bi );
+			re[a] = p32_add( ar, tr );
+			im[a] = p32_add( ai, ti );
+			re[b] = p32_sub( ar, tr );
+			im[b] = p32_sub( ai, ti );
+		}
+	}
+}
+
+/*----------------------------------------------------------------------------
+| Two radix-2 levels at once on bit-reversed data: with A1 = w^2k a1,
+| A2 = w^k a2 and A3 = w^3k a3,
+|   x0 = a0 + A1 + (A2 + A3)      x2 = a0 + A1 - (A2 + A3)
+|   x1 = a0 - A1 -+ i(A2 - A3)    x3 = a0 - A1 +- i(A2 - A3)
+| the upper signs for the forward transform.
+*----------------------------------------------------------------------------*/
+static void p32_radix4( const p32_fftRun * r, size_t start, size_t size ){
+	posit32_t * re = r->re, * im = r->im;
+	posit32_t w1r, w1i, w2r, w2i, w3r, w3i, a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i;
+	posit32_t t1r, t1i, t2r, t2i, t3r, t3i, sr, si, dr, di, er, ei, fr, fi;
+	size_t quarter = size/4, k, i0, i1, i2, i3;
+	bool f = !r->inverse;
+
+	for (k=0; k<quarter; k++){
+		i0 = start + k;
+		i1 = i0 + quarter;
+		i2 = i1 + quarter;
+		i3 = i2 + quarter;
+		a0r = re[i0]; a0i = im[i0];
+		a1r = re[i1]; a1i = im[i1];
+		a2r = re[i2]; a2i = im[i2];
+		a3r = re[i3]; a3i = im[i3];
+		p32_twiddle( r, k, size, &w1r, &w1i );
+		p32_twiddle( r, 2*k, size, &w2r, &w2i );
+		p32_twiddle( r, 3*k, size, &w3r, &w3i );
+		if (r->plan->flags & SOFTPOSIT_FFT_QUIRE){
+			quire32_t q0r = p32_quireFrom( a0r ), q0i = p32_quireFrom( a0i );
+			quire32_t qr, qi;
+
+			qr = p32_quireRe( p32_quireRe( p32_quireRe( q0r, w2r, w2i, a1r, a1i, 0 ), w1r, w1i, a2r, a2i, 0 ), w3r, w3i, a3r, a3i, 0 );
+			qi = p32_quireIm( p32_quireIm( p32_quireIm( q0i, w2r, w2i, a1r, a1i, 0 ), w1r, w1i, a2r, a2i, 0 ), w3r, w3i, a3r, a3i, 0 );
+			re[i0] = q32_to_p32( qr );
+			im[i0] = q32_to_p32( qi );
+			qr = p32_quireRe( p32_quireRe( p32_quireRe( q0r, w2r, w2i, a1r, a1i, 0 ), w1r, w1i, a2r, a2i, 1 ), w3r, w3i, a3r, a3i, 1 );
+			qi = p32_quireIm( p32_quireIm( p32_quireIm( q0i, w2r, w2i, a1r, a1i, 0 ), w1r, w1i, a2r, a2i, 1 ), w3r, w3i, a3r, a3i, 1 );
+			re[i2] = q32_to_p32( qr );
+			im[i2] = q32_to_p32( qi );
+			qr = p32_quireIm( p32_quireIm( p32_quireRe( q0r, w2r, w2i, a1r, a1i, 1 ), w1r, w1i, a2r, a2i, !f ), w3r, w3i, a3r, a3i, f );
+			qi = p32_quireRe( p32_quireRe( p32_quireIm( q0i, w2r, w2i, a1r, a1i, 1 ), w1r, w1i, a2r, a2i, f ), w3r, w3i, a3r, a3i, !f );
+			re[i1] = q32_to_p32( qr );
+			im[i1] = q32_to_p32( qi );
+			qr = p32_quireIm( p32_quireIm( p32_quireRe( q0r, w2r, w2i, a1r, a1i, 1 ), w1r, w1i, a2r, a2i, f ), w3r, w3i, a3r, a3i, !f );
+			qi = p32_quireRe( p32_quireRe( p32_quireIm( q0i, w2r, w2i, a1r, a1i, 1 ), w1r, w1i, a2r, a2i, !f ), w3r, w3i, a3r, a3i, f );
+			re[i3] = q32_to_p32( qr );
+			im[i3] = q32_to_p32( qi );
+		}
+		else{
+			t1r = p32_mulRe( w2r, w2i, a1r, a1i );
+			t1i = p32_mulIm( w2r, w2i, a1r, a1i );
+			t2r = p32_mulRe( w1r, w1i, a2r, a2i );
+			t2i = p32_mulIm( w1r, w1i, a2r, a2i );
+			t3r = p32_mulRe( w3r, w3i, a3r, a3i );
+			t3i = p32_mulIm( w3r, w3i, a3r, a3i );
+			sr = p32_add( a0r, t1r ); si = p32_add( a0i, t1i );
+			dr = p32_sub( a0r, t1r ); di = p32_sub( a0i, t1i );
+			er = p32_add( t2r, t3r ); ei = p32_add( t2i, t3i );
+			fr = p32_sub( t2r, t3r ); fi = p32_sub( t2i, t3i );
+			if (r->inverse){
+				fr = p32_negate( fr );
+				fi = p32_negate( fi );
+			}
+			re[i0] = p32_add( sr, er ); im[i0] = p32_add( si, ei );
+			re[i2] = p32_sub( sr, er ); im[i2] = p32_sub( si, ei );
+			re[i1] = p32_add( dr, fi ); im[i1] = p32_sub( di, fr );
+			re[i3] = p32_sub( dr, fi ); im[i3] = p32_add( di, fr );
+		}
+	}
+}
+
+static void p32_fftRecurse( const p32_fftRun * r, size_t start, size_t size ){
+	size_t quarter = size/4;
+
+	if (size<2) return;
+	if (size==2){
+		p32_radix2( r, start, 2 );
+		return;
+	}
+	p32_fftRecurse( r, start, quarter );
+	p32_fftRecurse( r, start + quarter, quarter );
+	p32_fftRecurse( r, start + 2*quarter, quarter );
+	p32_fftRecurse( r, start + 3*quarter, quarter );
+	p32_radix4( r, start, size );
+}
+
+//Transform of size n (a power of two dividing plan->n) in place
+static void p32_fftSized( const p32_fftPlan_t * plan, posit32_t * re, posit32_t * im, size_t n, bool inverse ){
+	p32_fftRun r = { plan, re, im, inverse };
+
+	p32_bitReverse( re, im, n );
+	p32_fftRecurse( &r, 0, n );
+}
+
+void p32_fft( const p32_fftPlan_t * plan, posit32_t * re, posit32_t * im, bool inverse ){
+	p32_fftSized( plan, re, im, plan->n, inverse );
+}
+
+typedef struct {
+	const p32_fftPlan_t * plan;
+	posit32_t * re, * im;
+	size_t count, dist;
+	bool inverse;
+} p32_fftBatch;
+
+static void p32_fftBatchPart( void * arg, int part, int nParts ){
+	const p32_fftBatch * b = arg;
+	size_t i;
+
+	for (i=b->count*part/nParts; i<b->count*(part+1)/nParts; i++)
+		p32_fftSized( b->plan, b->re + i*b->dist, b->im + i*b->dist, b->plan->n, b->inverse );
+}
+
+//count transforms, the i-th at re + i*dist and im + i*dist
+void p32_fft_batch( const p32_fftPlan_t * plan, posit32_t * re, posit32_t * im, size_t count, size_t dist,
+		bool inverse, int nThreads ){
+	p32_fftBatch b = { plan, re, im, count, dist, inverse };
+
+	softposit_parallelRun( nThreads, p32_fftBatchPart, &b );
+}
+
+/*----------------------------------------------------------------------------
+| Real transforms through a half-size complex transform.  With Z the FFT of
+| z[k] = x[2k] + i*x[2k+1], A = Z[k] and B = Z[n/2-k],
+|   X[k] = ( A + conj(B) - i w^k (A - conj(B)) ) / 2
+| and each component of X is one quire sum over the halved twiddles.  The
+| inverse undoes this with the full twiddles, giving 2*Z[k] conjugated.
+*----------------------------------------------------------------------------*/
+static void p32_realSplit( const p32_fftPlan_t * plan, size_t k, posit32_t ar, posit32_t ai, posit32_t br, posit32_t bi,
+		posit32_t * zr, posit32_t * zi ){
+	posit32_t half = { .v = 0x38000000 }, hwr = plan->hwr[k], hwi = plan->hwi[k];
+	quire32_t qZ;
+
+	qZ = q32_fdp_add( q32_fdp_add( q32Clr(), half, ar ), half, br );
+	qZ = q32_fdp_add( q32_fdp_add( qZ, hwr, ai ), hwr, bi );
+	*zr = q32_to_p32( q32_fdp_sub( q32_fdp_add( qZ, hwi, ar ), hwi, br ) );
+	qZ = q32_fdp_sub( q32_fdp_add( q32Clr(), half, ai ), half, bi );
+	qZ = q32_fdp_add( q32_fdp_sub( qZ, hwr, ar ), hwr, br );
+	*zi = q32_to_p32( q32_fdp_add( q32_fdp_add( qZ, hwi, ai ), hwi, bi ) );
+}
+
+static void p32_realMerge( const p32_fftPlan_t * plan, size_t k, posit32_t ar, posit32_t ai, posit32_t br, posit32_t bi,
+		posit32_t * zr, posit32_t * zi ){
+	posit32_t one = { .v = 0x40000000 }, wr = plan->wr[k], wi = plan->wi[k];
+	quire32_t qZ;
+
+	qZ = q32_fdp_add( p32_quireFrom( ar ), one, br );
+	qZ = q32_fdp_sub( q32_fdp_add( qZ, wi, ar ), wi, br );
+	*zr = q32_to_p32( q32_fdp_sub( q32_fdp_sub( qZ, wr, ai ), wr, bi ) );
+	qZ = q32_fdp_sub( p32_quireFrom( ai ), one, bi );
+	qZ = q32_fdp_sub( q32_fdp_add( qZ, wr, ar ), wr, br );
+	*zi = q32_to_p32( q32_fdp_add( q32_fdp_add( qZ, wi, ai ), wi, bi ) );
+}
+
+//x has plan->n values; re and im receive plan->n/2+1 bins
+void p32_rfft( const p32_fftPlan_t * plan, const posit32_t * x, posit32_t * re, posit32_t * im ){
+	size_t n = plan->n/2, k;
+	posit32_t ar, ai, br, bi;
+
+	//A single real value is its own transform
+	if (plan->n==1){
+		re[0] = x[0];
+		im[0].v = 0;
+		return;
+	}
+
+	for (k=0; k<n; k++){
+		re[k] = x[2*k];
+		im[k] = x[2*k+1];
+	}
+	p32_fftSized( plan, re, im, n, 0 );
+	ar = re[0];
+	ai = im[0];
+	re[0] = p32_add( ar, ai );
+	re[n] = p32_sub( ar, ai );
+	im[0].v = im[n].v = 0;
+	for (k=1; 2*k<=n; k++){
+		ar = re[k]; ai = im[k];
+		br = re[n-k]; bi = im[n-k];
+		p32_realSplit( plan, k, ar, ai, br, bi, &re[k], &im[k] );
+		if (2*k<n) p32_realSplit( plan, n-k, br, bi, ar, ai, &re[n-k], &im[n-k] );
+	}
+}
+
+//Unnormalised inverse of p32_rfft: x receives plan->n times the signal.
+//re and im hold plan->n/2+1 bins and are overwritten.
+void p32_irfft( const p32_fftPlan_t * plan, posit32_t * re, posit32_t * im, posit32_t * x ){
+	size_t n = plan->n/2, k;
+	posit32_t ar, ai, br, bi;
+
+	if (plan->n==1){
+		x[0] = re[0];
+		return;
+	}
+
+	for (k=0; 2*k<=n; k++){
+		ar = re[k]; ai = im[k];
+		br = re[n-k]; bi = im[n-k];
+		p32_realMerge( plan, k, ar, ai, br, bi, &re[k], &im[k] );
+		if (k>0 && 2*k<n) p32_realMerge( plan, n-k, br, bi, ar, ai, &re[n-k], &im[n-k] );
+	}
+	p32_fftSized( plan, re, im, n, 1 );
+	for (k=0; k<n; k++){
+		x[2*k] = re[k];
+		x[2*k+1] = im[k];
+	}
+}
@@ -54,36 +54,20 @@ posit32_t p32_mul( posit32_t pA, posit32_t pB ){
 	int_fast8_t kA=0;
 	uint_fast64_t frac64Z;
 
+	SOFTPOSIT_STAT_OP( mul, p32 );
 	uA.p = pA;
 	uiA = uA.ui;
 	uB.p = pB;
 	uiB = uB.ui;
 
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.exact = (uiA.ui.exact & uiB.ui.exact);
-#endif
 	//NaR or Zero
 	if ( uiA==0x80000000 || uiB==0x80000000 ){
-
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = 0x80000000;
-		uZ.ui.exact = 0;
-#else
+		SOFTPOSIT_STAT_NAR( p32 );
 		uZ.ui = 0x80000000;
-#endif
 		return uZ.p;
 	}
 	else if (uiA==0 || uiB==0){
-#ifdef SOFTPOSIT_EXACT
-
-		uZ.ui.v = 0;
-		if ( (uiA==0 && uiA.ui.exact) || (uiB==0 && uiB.ui.exact) )
-			uZ.ui.exact = 1;
-		else
-			uZ.ui.exact = 0;
-#else
 		uZ.ui = 0;
-#endif
 		return uZ.p;
 	}
 
@@ -165,9 +149,11 @@ posit32_t p32_mul( posit32_t pA, posit32_t pB ){
 	if(regA>30){
 		//max or min pos. exp and frac does not matter.
 		(regSA) ? (uZ.ui= 0x7FFFFFFF): (uZ.ui=0x1);
+		SOFTPOSIT_SATURATED( p32, regSA, !regSA || regA>31 || expA || (frac64Z&0xFFFFFFFFFFFFFFF) );
 	}
 	else{
 		//remove carry and rcarry bits and shift to correct position (2 bits exp, so + 1 than 16 bits)
+		if (frac64Z & ((1ULL<<regA)-1)) bitsMore=1;
 		frac64Z = (frac64Z&0xFFFFFFFFFFFFFFF) >> regA;
 		fracA = (uint_fast32_t) (frac64Z>>32);
 		if (regA<=28){
@@ -177,14 +163,14 @@ posit32_t p32_mul( posit32_t pA, posit32_t pB ){
 		else {
 			if (regA==30){
 				bitNPlusOne = expA&0x2;
-				bitsMore = (expA&0x1);
+				bitsMore |= (expA&0x1);
 				expA = 0;
 			}
 			else if (regA==29){
 				bitNPlusOne = expA&0x1;
 				expA>>=1; //taken care of by the pack algo
 			}
-			if (fracA>0){
+			if (frac64Z>0){
 				fracA=0;
 				bitsMore =1;
 			}
@@ -192,6 +178,7 @@ posit32_t p32_mul( posit32_t pA, posit32_t pB ){
 		}
 		//sign is always zero
 		uZ.ui = packToP32UI(regime, expA, fracA);
+		SOFTPOSIT_ROUNDED( p32, bitNPlusOne, bitsMore || (0x7FFFFFFF & frac64Z), uZ.ui&1 );
 		//n+1 frac bit is 1. Need to check if another bit is 1 too if not round to even
 		if (bitNPlusOne){
 			if (0x7FFFFFFF & frac64Z)  bitsMore=1;
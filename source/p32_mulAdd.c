@@ -44,6 +44,7 @@ posit32_t p32_mulAdd( posit32_t a, posit32_t b, posit32_t c ) {
     union ui32_p32 uC;
     uint_fast32_t uiC;
 
+    SOFTPOSIT_STAT_OP( mulAdd, p32 );
     uA.p = a;
     uiA = uA.ui;
     uB.p = b;
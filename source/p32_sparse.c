@@ -0,0 +1,227 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <errno.h>
+#include <stdlib.h>
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Sparse matrix-vector products y = A*x for 32-bit posits.  Every row is
+| accumulated exactly in a quire and rounded once, so the result does not
+| depend on the storage format or the number of threads.  Work is split
+| between threads by stored entries rather than by rows.
+*----------------------------------------------------------------------------*/
+int p32_csr_readMatrixMarket( p32_csr_t * A, const char * path ){
+	return softposit_readMatrixMarketCSR( path, 32, 2, &A->rows, &A->cols, &A->nnz,
+			&A->rowPtr, &A->colIdx, (void **) &A->val );
+}
+
+void p32_csr_free( p32_csr_t * A ){
+	free( A->rowPtr );
+	free( A->colIdx );
+	free( A->val );
+	A->rowPtr = 0;
+	A->colIdx = 0;
+	A->val = 0;
+}
+
+typedef struct {
+	const p32_csr_t * A;
+	const posit32_t * x;
+	posit32_t * y;
+} p32_csrTask;
+
+static void p32_csrSpmvPart( void * arg, int part, int nParts ){
+	const p32_csrTask * t = arg;
+	const p32_csr_t * A = t->A;
+	uint64_t row, i, first, last;
+	quire32_t qZ;
+
+	first = softposit_partitionPoint( A->rowPtr, A->rows, part, nParts );
+	last = (part==nParts-1) ? A->rows : softposit_partitionPoint( A->rowPtr, A->rows, part+1, nParts );
+	for (row=first; row<last; row++){
+		qZ = q32Clr();
+		for (i=A->rowPtr[row]; i<A->rowPtr[row+1]; i++)
+			qZ = q32_fdp_add( qZ, A->val[i], t->x[A->colIdx[i]] );
+		t->y[row] = q32_to_p32( qZ );
+	}
+}
+
+void p32_csr_spmv( const p32_csr_t * A, const posit32_t * x, posit32_t * y, int nThreads ){
+	p32_csrTask t = { A, x, y };
+
+	softposit_parallelRun( nThreads, p32_csrSpmvPart, &t );
+}
+
+static int p32_compareKeys( const void * a, const void * b ){
+	uint64_t kA = *(const uint64_t *) a, kB = *(const uint64_t *) b;
+	return (kA>kB) - (kA<kB);
+}
+
+/*----------------------------------------------------------------------------
+| SELL-C-sigma: rows are sorted by decreasing length within windows of sigma
+| rows, then cut into slices of C rows, each padded to its longest row and
+| stored column by column so the C rows advance together.
+*----------------------------------------------------------------------------*/
+int p32_sell_fromCSR( p32_sell_t * S, const p32_csr_t * A, int C, uint64_t sigma ){
+	uint64_t * keys, s, r, w, width, len, row, i, j, idx;
+
+	S->slicePtr = 0;
+	S->perm = 0;
+	S->rowLen = 0;
+	S->colIdx = 0;
+	S->val = 0;
+	if (C<1 || C>SOFTPOSIT_SELL_MAXC || sigma<1){
+		errno = EINVAL;
+		return -1;
+	}
+	S->rows = A->rows;
+	S->cols = A->cols;
+	S->nnz = A->nnz;
+	S->C = C;
+	S->nSlices = (A->rows + C-1) / C;
+
+	keys = malloc( A->rows*sizeof *keys + 1 );
+	S->perm = malloc( A->rows*sizeof *S->perm + 1 );
+	S->rowLen = malloc( A->rows*sizeof *S->rowLen + 1 );
+	S->slicePtr = malloc( (S->nSlices+1)*sizeof *S->slicePtr );
+	if (!keys || !S->perm || !S->rowLen || !S->slicePtr) goto fail;
+	for (row=0; row<A->rows; row++)
+		keys[row] = (~(A->rowPtr[row+1]-A->rowPtr[row]) << 32) | row;
+	for (w=0; w<A->rows; w+=sigma)
+		qsort( keys + w, (A->rows-w<sigma) ? A->rows-w : sigma, sizeof *keys, p32_compareKeys );
+	for (row=0; row<A->rows; row++){
+		S->perm[row] = (uint32_t) keys[row];
+		S->rowLen[row] = (uint32_t) (A->rowPtr[S->perm[row]+1] - A->rowPtr[S->perm[row]]);
+	}
+
+	S->slicePtr[0] = 0;
+	for (s=0; s<S->nSlices; s++){
+		width = 0;
+		for (r=s*C; r<(s+1)*C && r<A->rows; r++)
+			if (S->rowLen[r]>width) width = S->rowLen[r];
+		S->slicePtr[s+1] = S->slicePtr[s] + width*C;
+	}
+	S->colIdx = malloc( S->slicePtr[S->nSlices]*sizeof *S->colIdx + 1 );
+	S->val = malloc( S->slicePtr[S->nSlices]*sizeof *S->val + 1 );
+	if (!S->colIdx || !S->val) goto fail;
+	for (s=0; s<S->nSlices; s++){
+		width = (S->slicePtr[s+1]-S->slicePtr[s]) / C;
+		for (i=0; i<(uint64_t) C; i++){
+			r = s*C + i;
+			len = 0;
+			if (r<A->rows){
+				row = S->perm[r];
+				len = S->rowLen[r];
+			}
+			for (j=0; j<width; j++){
+				idx = S->slicePtr[s] + j*C + i;
+				if (j<len){
+					S->colIdx[idx] = A->colIdx[A->rowPtr[row]+j];
+					S->val[idx] = A->val[A->rowPtr[row]+j];
+				}
+				else{
+					S->colIdx[idx] = 0;
+					S->val[idx].v = 0;
+				}
+			}
+		}
+	}
+	free( keys );
+	return 0;
+
+fail:
+	free( keys );
+	p32_sell_free( S );
+	errno = ENOMEM;
+	return -1;
+}
+
+void p32_sell_free( p32_sell_t * S ){
+	free( S->slicePtr );
+	free( S->perm );
+	free( S->rowLen );
+	free( S->colIdx );
+	free( S->val );
+	S->slicePtr = 0;
+	S->perm = 0;
+	S->rowLen = 0;
+	S->colIdx = 0;
+	S->val = 0;
+}
+
+typedef struct {
+	const p32_sell_t * S;
+	const posit32_t * x;
+	posit32_t * y;
+} p32_sellTask;
+
+static void p32_sellSpmvPart( void * arg, int part, int nParts ){
+	const p32_sellTask * t = arg;
+	const p32_sell_t * S = t->S;
+	quire32_t qZ[SOFTPOSIT_SELL_MAXC];
+	uint32_t len[SOFTPOSIT_SELL_MAXC];
+	uint64_t s, j, idx, first, last, width;
+	int C = S->C, i;
+
+	first = softposit_partitionPoint( S->slicePtr, S->nSlices, part, nParts );
+	last = (part==nParts-1) ? S->nSlices : softposit_partitionPoint( S->slicePtr, S->nSlices, part+1, nParts );
+	for (s=first; s<last; s++){
+		width = (S->slicePtr[s+1]-S->slicePtr[s]) / C;
+		for (i=0; i<C; i++){
+			qZ[i] = q32Clr();
+			len[i] = (s*C+i<S->rows) ? S->rowLen[s*C+i] : 0;
+		}
+		//Padding is never accumulated: 0*x[0] would be NaR when x[0] is
+		idx = S->slicePtr[s];
+		for (j=0; j<width; j++)
+			for (i=0; i<C; i++, idx++)
+				if (j<len[i]) qZ[i] = q32_fdp_add( qZ[i], S->val[idx], t->x[S->colIdx[idx]] );
+		for (i=0; i<C && s*C+i<S->rows; i++) t->y[S->perm[s*C+i]] = q32_to_p32( qZ[i] );
+	}
+}
+
+void p32_sell_spmv( const p32_sell_t * S, const posit32_t * x, posit32_t * y, int nThreads ){
+	p32_sellTask t = { S, x, y };
+
+	softposit_parallelRun( nThreads, p32_sellSpmvPart, &t );
+}
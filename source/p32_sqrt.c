@@ -50,11 +50,13 @@ posit32_t p32_sqrt( posit32_t pA ) {
     uint_fast64_t eSqrR0, fracZ, negRem, recipSqrt, shiftedFracZ, sigma0, sqrSigma0;
     int_fast32_t eps, shiftZ;
 
+    SOFTPOSIT_STAT_OP( sqrt, p32 );
     uA.p = pA;
     uiA = uA.ui;
 
     // If NaR or a negative number, return NaR.
     if (uiA & 0x80000000) {
+        SOFTPOSIT_STAT_NAR( p32 );
         uA.ui = 0x80000000;
         return uA.p;
     }
@@ -128,6 +130,7 @@ posit32_t p32_sqrt( posit32_t pA ) {
     // Strip off the hidden bit and round-to-nearest using last shift+5 bits.
     fracZ &= 0xFFFFFFFF;
     mask = (1 << (4 + shift));
+    SOFTPOSIT_ROUNDED( p32, mask & fracZ, (mask - 1) & fracZ, (mask << 1) & fracZ );
     if (mask & fracZ) {
         if ( ((mask - 1) & fracZ) | ((mask << 1) & fracZ) ) fracZ += (mask << 1);
     }
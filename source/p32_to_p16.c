@@ -87,8 +87,6 @@ posit16_t p32_to_p16( posit32_t pA ){
 		}
 		//exp and frac
 		exp_frac32A = tmp<<1;
-printBinary(&exp_frac32A, 32);
-printf("kA: %d\n", kA);
 		if(kA<0){
 			regA = (-kA)<<1;
 			if (exp_frac32A&0x80000000) regA--;
@@ -38,34 +38,22 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 posit64_t p64_add( posit64_t a, posit64_t b ){
     union ui64_p64 uA, uB, uZ;
-    uint_fast64_t uiA, uiB
+    uint_fast64_t uiA, uiB;
 
+    SOFTPOSIT_STAT_OP( add, p64 );
     uA.p = a;
 	uiA = uA.ui;
 	uB.p = b;
 	uiB = uB.ui;
 
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.exact = (uiA.ui.exact & uiB.ui.exact);
-#endif
-
     //Zero or infinity
 	if (uiA==0 || uiB==0){ // Not required but put here for speed
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = uiA | uiB;
-		uZ.ui.exact = (uiA.ui.exact & uiB.ui.exact);
-#else
 		uZ.ui = uiA | uiB;
-#endif
 		return uZ.p;
 	}
 	else if ( uiA==0x8000000000000000 || uiB==0x8000000000000000 ){
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = 0x8000000000000000;
-		uZ.ui.exact = 0;
-#else
+		SOFTPOSIT_STAT_NAR( p64 );
 		uZ.ui = 0x8000000000000000;
-#endif
 		return uZ.p;
 	}
 
@@ -0,0 +1,207 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Array kernels that only need the two's complement order of posits.  Every
+| loop works on the raw bit patterns with plain integer operations so the
+| compiler can turn it into integer SIMD.
+|
+| min, max, argmin and argmax return NaR (or the position of the first NaR)
+| as soon as the array holds one, like the arithmetic operations do.  For max
+| the bit patterns are shifted down by one so that NaR wraps around to the
+| top of the order and the same vectorised maximum finds it.
+*----------------------------------------------------------------------------*/
+#define P64_ARG_BLOCK 1024
+#define p64MaxKey( a ) ( (int64_t) ((uint64_t) (a) - 1) )
+
+posit64_t p64_min_n( const posit64_t * a, size_t n ){
+	union ui64_p64 uZ;
+	int64_t m = 0x7FFFFFFFFFFFFFFF;
+
+	if (n==0){
+		uZ.ui = 0x8000000000000000;
+		return uZ.p;
+	}
+	for (size_t i=0; i<n; i++){
+		int64_t uiA = (int64_t) a[i].v;
+		m = (uiA<m) ? uiA : m;
+	}
+	uZ.ui = (uint64_t) m;
+	return uZ.p;
+}
+
+posit64_t p64_max_n( const posit64_t * a, size_t n ){
+	union ui64_p64 uZ;
+	int64_t m = INT64_MIN;
+
+	if (n==0){
+		uZ.ui = 0x8000000000000000;
+		return uZ.p;
+	}
+	for (size_t i=0; i<n; i++){
+		int64_t key = p64MaxKey(a[i].v);
+		m = (key>m) ? key : m;
+	}
+	uZ.ui = (uint64_t) m + 1;
+	return uZ.p;
+}
+
+/*----------------------------------------------------------------------------
+| The argument reductions run the vectorised reduction block by block and
+| remember the first block that improved on the best value, then scan only
+| that block for the first position holding it.  Returns 0 when 'n' is 0.
+*----------------------------------------------------------------------------*/
+size_t p64_argmin_n( const posit64_t * a, size_t n ){
+	int64_t best = 0x7FFFFFFFFFFFFFFF;
+	size_t bestBlock = 0, i;
+
+	if (n==0) return 0;
+	for (size_t b=0; b<n; b+=P64_ARG_BLOCK){
+		size_t e = (n-b<P64_ARG_BLOCK) ? n : b+P64_ARG_BLOCK;
+		int64_t m = 0x7FFFFFFFFFFFFFFF;
+		for (i=b; i<e; i++){
+			int64_t uiA = (int64_t) a[i].v;
+			m = (uiA<m) ? uiA : m;
+		}
+		if (b==0 || m<best){
+			best = m;
+			bestBlock = b;
+		}
+	}
+	for (i=bestBlock; (int64_t)a[i].v!=best; i++);
+	return i;
+}
+
+size_t p64_argmax_n( const posit64_t * a, size_t n ){
+	int64_t best = INT64_MIN;
+	size_t bestBlock = 0, i;
+
+	if (n==0) return 0;
+	for (size_t b=0; b<n; b+=P64_ARG_BLOCK){
+		size_t e = (n-b<P64_ARG_BLOCK) ? n : b+P64_ARG_BLOCK;
+		int64_t m = INT64_MIN;
+		for (i=b; i<e; i++){
+			int64_t key = p64MaxKey(a[i].v);
+			m = (key>m) ? key : m;
+		}
+		if (b==0 || m>best){
+			best = m;
+			bestBlock = b;
+		}
+	}
+	for (i=bestBlock; p64MaxKey(a[i].v)!=best; i++);
+	return i;
+}
+
+//NaR elements stay NaR; a NaR bound turns every element into NaR
+void p64_clamp_n( const posit64_t * a, size_t n, posit64_t lo, posit64_t hi, posit64_t * z ){
+	int64_t uiLo = (int64_t) lo.v, uiHi = (int64_t) hi.v;
+
+	if (isNaRP64UI(lo.v) || isNaRP64UI(hi.v)){
+		for (size_t i=0; i<n; i++) z[i].v = 0x8000000000000000;
+		return;
+	}
+	for (size_t i=0; i<n; i++){
+		int64_t uiA = (int64_t) a[i].v;
+		int64_t uiZ = (uiA<uiLo) ? uiLo : uiA;
+		uiZ = (uiZ>uiHi) ? uiHi : uiZ;
+		z[i].v = (uint64_t) ((uiA==INT64_MIN) ? uiA : uiZ);
+	}
+}
+
+//z[i] = mask[i] ? a[i] : b[i]
+void p64_select_n(
+	const uint8_t * mask, const posit64_t * a, const posit64_t * b, size_t n, posit64_t * z ){
+	for (size_t i=0; i<n; i++)
+		z[i].v = mask[i] ? a[i].v : b[i].v;
+}
+
+/*----------------------------------------------------------------------------
+| Elementwise comparisons writing 1 or 0 per element into 'mask', with the
+| same results as p64_eq, p64_le and p64_lt.
+*----------------------------------------------------------------------------*/
+void p64_eq_n( const posit64_t * a, const posit64_t * b, size_t n, uint8_t * mask ){
+	for (size_t i=0; i<n; i++)
+		mask[i] = (a[i].v==b[i].v);
+}
+
+void p64_le_n( const posit64_t * a, const posit64_t * b, size_t n, uint8_t * mask ){
+	for (size_t i=0; i<n; i++)
+		mask[i] = ((int64_t)a[i].v<=(int64_t)b[i].v);
+}
+
+void p64_lt_n( const posit64_t * a, const posit64_t * b, size_t n, uint8_t * mask ){
+	for (size_t i=0; i<n; i++)
+		mask[i] = ((int64_t)a[i].v<(int64_t)b[i].v);
+}
+
+size_t p64_countNaR_n( const posit64_t * a, size_t n ){
+	size_t count = 0;
+
+	//narrow per-block counters keep the SIMD lanes as wide as the data
+	for (size_t b=0; b<n; b+=65536){
+		size_t e = (n-b<65536) ? n : b+65536;
+		uint64_t c = 0;
+		for (size_t i=b; i<e; i++)
+			c += (a[i].v==0x8000000000000000);
+		count += c;
+	}
+	return count;
+}
+
+/*----------------------------------------------------------------------------
+| Array forms of absP64 and negP64; NaR maps to itself.
+*----------------------------------------------------------------------------*/
+void p64_abs_n( const posit64_t * a, size_t n, posit64_t * z ){
+	for (size_t i=0; i<n; i++){
+		uint64_t uiA = a[i].v;
+		uint64_t mask = -(uiA>>63);
+		z[i].v = (uiA + mask) ^ mask;
+	}
+}
+
+void p64_neg_n( const posit64_t * a, size_t n, posit64_t * z ){
+	for (size_t i=0; i<n; i++)
+		z[i].v = -a[i].v;
+}
+
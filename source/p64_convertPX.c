@@ -0,0 +1,107 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Conversions between posit64 and the dynamic-width posits (es = 0, 1, 2).
+| Widening is exact; narrowing rounds once to nearest even.
+*----------------------------------------------------------------------------*/
+static uint_fast32_t p64_toPX( posit64_t pA, int x, int es ){
+	union ui64_p64 uA;
+	uint_fast64_t sig;
+	int_fast32_t scale;
+	bool sign;
+
+	uA.p = pA;
+	if (x<2 || x>32) return 0x80000000;
+	if (uA.ui==0 || uA.ui==0x8000000000000000ULL) return uA.ui>>32;
+	scale = softposit_unpackP64( uA.ui, &sign, &sig );
+	return softposit_packPX( sign, scale, sig, false, x, es );
+}
+
+static posit64_t pX_toP64( uint_fast32_t uiA, int es ){
+	union ui64_p64 uZ;
+	uint_fast64_t sig;
+	int_fast32_t scale;
+	bool sign;
+
+	if (uiA==0 || uiA==0x80000000){
+		uZ.ui = (uint_fast64_t) uiA<<32;
+		return uZ.p;
+	}
+	scale = softposit_unpackPX( uiA, es, &sign, &sig );
+	uZ.ui = softposit_packP64( sign, scale, sig, false );
+	return uZ.p;
+}
+
+posit_0_t p64_to_pX0( posit64_t pA, int x ){
+	union ui32_pX0 uZ;
+
+	uZ.ui = p64_toPX( pA, x, 0 );
+	return uZ.p;
+}
+
+posit_1_t p64_to_pX1( posit64_t pA, int x ){
+	union ui32_pX1 uZ;
+
+	uZ.ui = p64_toPX( pA, x, 1 );
+	return uZ.p;
+}
+
+posit_2_t p64_to_pX2( posit64_t pA, int x ){
+	union ui32_pX2 uZ;
+
+	uZ.ui = p64_toPX( pA, x, 2 );
+	return uZ.p;
+}
+
+posit64_t pX0_to_p64( posit_0_t pA ){
+	return pX_toP64( pA.v, 0 );
+}
+
+posit64_t pX1_to_p64( posit_1_t pA ){
+	return pX_toP64( pA.v, 1 );
+}
+
+posit64_t pX2_to_p64( posit_2_t pA ){
+	return pX_toP64( pA.v, 2 );
+}
@@ -0,0 +1,123 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Batch conversions to and from posit64, bit-exact with the scalar ones.
+*----------------------------------------------------------------------------*/
+void p64_to_p8_n( const posit64_t * a, size_t n, posit8_t * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = p64_to_p8( a[i] );
+}
+
+void p64_to_p16_n( const posit64_t * a, size_t n, posit16_t * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = p64_to_p16( a[i] );
+}
+
+void p64_to_p32_n( const posit64_t * a, size_t n, posit32_t * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = p64_to_p32( a[i] );
+}
+
+void p8_to_p64_n( const posit8_t * a, size_t n, posit64_t * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = p8_to_p64( a[i] );
+}
+
+void p16_to_p64_n( const posit16_t * a, size_t n, posit64_t * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = p16_to_p64( a[i] );
+}
+
+void p32_to_p64_n( const posit32_t * a, size_t n, posit64_t * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = p32_to_p64( a[i] );
+}
+
+void ui32_to_p64_n( const uint32_t * a, size_t n, posit64_t * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = ui32_to_p64( a[i] );
+}
+
+void ui64_to_p64_n( const uint64_t * a, size_t n, posit64_t * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = ui64_to_p64( a[i] );
+}
+
+void i32_to_p64_n( const int32_t * a, size_t n, posit64_t * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = i32_to_p64( a[i] );
+}
+
+void p64_to_ui32_n( const posit64_t * a, size_t n, uint32_t * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = p64_to_ui32( a[i] );
+}
+
+void p64_to_ui64_n( const posit64_t * a, size_t n, uint64_t * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = p64_to_ui64( a[i] );
+}
+
+void p64_to_i32_n( const posit64_t * a, size_t n, int32_t * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = p64_to_i32( a[i] );
+}
+
+void p64_to_i64_n( const posit64_t * a, size_t n, int64_t * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = p64_to_i64( a[i] );
+}
@@ -68,6 +68,7 @@ posit64_t p64_div( posit64_t pA, posit64_t pB )
 	uint128_t frac128A, frac128Z, rem;
 	int128div_t divresult;
 
+	SOFTPOSIT_STAT_OP( div, p64 );
 	uA.p = pA;
 	uiA = uA.ui;
 	uB.p = pB;
@@ -75,25 +76,12 @@ posit64_t p64_div( posit64_t pA, posit64_t pB )
 
 	//Zero or infinity
 	if ( uiA==0x8000000000000000ULL || uiB==0x8000000000000000ULL || uiB==0){
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = 0x8000000000000000ULL;
-		uZ.ui.exact = 0;
-#else
+		SOFTPOSIT_STAT_NAR( p64 );
 		uZ.ui = 0x8000000000000000ULL;
-#endif
 		return uZ.p;
 	}
 	else if (uiA==0){
-#ifdef SOFTPOSIT_EXACT
-
-		uZ.ui.v = 0;
-		if ( (uiA==0 && uiA.ui.exact) || (uiB==0 && uiB.ui.exact) )
-			uZ.ui.exact = 1;
-		else
-			uZ.ui.exact = 0;
-#else
 		uZ.ui = 0;
-#endif
 		return uZ.p;
 	}
 
@@ -176,6 +164,7 @@ posit64_t p64_div( posit64_t pA, posit64_t pB )
 	if(regA>62){
 		//max or min pos. exp and frac does not matter.
 		(regSA) ? (uZ.ui= 0x7FFFFFFFFFFFFFFFULL): (uZ.ui=0x1);
+		SOFTPOSIT_SATURATED( p64, regSA, !regSA || regA>63 || expA || (frac128Z&0x3FFFFFFFFFFFFFFFULL) || rem );
 	}
 	else{
 		//remove carry and rcarry bits and shift to correct position
@@ -207,6 +196,7 @@ posit64_t p64_div( posit64_t pA, posit64_t pB )
 		if (rem) bitsMore =1;
 
 		uZ.ui = packToP64UI(regime, expA, fracA);
+		SOFTPOSIT_ROUNDED( p64, bitNPlusOne, bitsMore || (regA<=60 && ((((uint128_t)1<<(regA+1))-1) & frac128Z)), uZ.ui&1 );
 		if (bitNPlusOne) uZ.ui += (uZ.ui&1) | bitsMore;
 	}
 
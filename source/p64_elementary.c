@@ -0,0 +1,471 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <math.h>
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Elementary functions for posit64.  A posit64 has up to 60 significant bits,
+| so the kernels below run in long double, whose 64-bit significand on x86
+| holds every argument exactly and leaves a few guard bits: results are
+| correctly rounded in the vast majority of cases and within 1 ulp always.
+| Results that can leave the range of the intermediate type are carried as
+| m * 2^k and k is added to the scale when packing.
+*----------------------------------------------------------------------------*/
+#define P64_PIO2_1  0x1.921fb54442p+0L    //pi/2 in two 41-bit pieces and a full one
+#define P64_PIO2_2  0x1.a308d31318p-41L
+#define P64_PIO2_3  0x1.8a2e03707344a40ap-81L
+#define P64_INVPIO2 0x1.45f306dc9c882a54p-1L
+#define P64_PIO2    0x1.921fb54442d1846ap+0L
+#define P64_PI      0x1.921fb54442d1846ap+1L
+#define P64_LN2_HI  0x1.62e42fefa2p-1L    //ln 2 in a 41-bit and a full piece
+#define P64_LN2_LO  0x1.9ef35793c7673008p-41L
+#define P64_LN2     0x1.62e42fefa39ef358p-1L
+#define P64_LOG2E   0x1.71547652b82fe178p+0L
+#define P64_SQRT2   0x1.6a09e667f3bcc908p+0L
+
+//Taylor coefficients, each truncated where the next term drops below 2^-66
+static const long double p64_expCoeffs[] = {
+	1.0L/2, 1.0L/6, 1.0L/24, 1.0L/120, 1.0L/720, 1.0L/5040, 1.0L/40320,
+	1.0L/362880, 1.0L/3628800, 1.0L/39916800, 1.0L/479001600, 1.0L/6227020800,
+	1.0L/87178291200, 1.0L/1307674368000, 1.0L/20922789888000,
+	1.0L/355687428096000, 1.0L/6402373705728000, 1.0L/121645100408832000,
+	1.0L/2432902008176640000, 1.0L/51090942171709440000.0L,
+	1.0L/1124000727777607680000.0L
+};
+static const long double p64_sinCoeffs[] = {
+	-1.0L/6, 1.0L/120, -1.0L/5040, 1.0L/362880, -1.0L/39916800, 1.0L/6227020800,
+	-1.0L/1307674368000, 1.0L/355687428096000, -1.0L/121645100408832000,
+	1.0L/51090942171709440000.0L
+};
+static const long double p64_cosCoeffs[] = {
+	-1.0L/2, 1.0L/24, -1.0L/720, 1.0L/40320, -1.0L/3628800, 1.0L/479001600,
+	-1.0L/87178291200, 1.0L/20922789888000, -1.0L/6402373705728000,
+	1.0L/2432902008176640000, -1.0L/1124000727777607680000.0L
+};
+static const long double p64_atanCoeffs[] = {
+	-1.0L/3, 1.0L/5, -1.0L/7, 1.0L/9, -1.0L/11, 1.0L/13, -1.0L/15, 1.0L/17,
+	-1.0L/19, 1.0L/21, -1.0L/23
+};
+static const long double p64_atanhCoeffs[] = {
+	1.0L/3, 1.0L/5, 1.0L/7, 1.0L/9, 1.0L/11, 1.0L/13, 1.0L/15, 1.0L/17, 1.0L/19,
+	1.0L/21, 1.0L/23, 1.0L/25, 1.0L/27
+};
+
+static long double p64_horner( const long double * c, int n, long double x ){
+	long double p = c[n-1];
+	for (int i=n-2; i>=0; i--) p = p*x + c[i];
+	return p;
+}
+
+/*----------------------------------------------------------------------------
+| Decodes a nonzero, non-NaR magnitude into 2^scale * m with m in [1, 2).
+*----------------------------------------------------------------------------*/
+static int_fast32_t p64_decode( uint_fast64_t uiA, long double * m ){
+	uint_fast64_t sig;
+	int_fast32_t scale = softposit_decodeMagPX(uiA, 2, &sig);
+	*m = ldexpl((long double)sig, -63);
+	return scale;
+}
+
+static long double p64_toLongDouble( uint_fast64_t uiA ){
+	long double m;
+	bool sign = signP64UI( uiA );
+	int_fast32_t scale;
+
+	if (sign) uiA = -uiA;
+	scale = p64_decode(uiA, &m);
+	m = ldexpl(m, scale);
+	return sign ? -m : m;
+}
+
+//Rounds the nonzero value d * 2^k to posit64
+static posit64_t p64_fromScaledLongDouble( long double d, int_fast32_t k ){
+	union ui64_p64 uZ;
+	long double fr, sigD;
+	uint_fast64_t sig;
+	int expD;
+
+	fr = frexpl(fabsl(d), &expD);
+	if (fr==0)
+		uZ.ui = 1;
+	else{
+		sigD = ldexpl(fr, 64);
+		sig = (uint_fast64_t) sigD;
+		uZ.ui = softposit_roundPackMagPX(expD-1+k, sig, sigD!=(long double)sig, 64, 2);
+	}
+	if (d<0) uZ.ui = -uZ.ui;
+	return uZ.p;
+}
+
+//e^r - 1 for |r| < 1.1
+static long double p64_expm1Kernel( long double r ){
+	return r + r*r*p64_horner(p64_expCoeffs, 21, r);
+}
+
+//e^x = m * 2^k with m in [0.7, 1.42]
+static long double p64_expScaled( long double x, int_fast32_t * k ){
+	long double n = nearbyintl(x*P64_LOG2E);
+	long double r = (x - n*P64_LN2_HI) - n*P64_LN2_LO;
+	*k = (int_fast32_t) n;
+	return 1 + p64_expm1Kernel(r);
+}
+
+//ln m for m in [sqrt(1/2), sqrt(2)], as 2 atanh((m-1)/(m+1))
+static long double p64_logKernel( long double m ){
+	long double s = (m-1)/(m+1);
+	long double z = s*s;
+	return 2*s + 2*s*z*p64_horner(p64_atanhCoeffs, 13, z);
+}
+
+static int_fast32_t p64_logDecode( uint_fast64_t uiA, long double * lnM ){
+	long double m;
+	int_fast32_t scale = p64_decode(uiA, &m);
+	if (m>P64_SQRT2){
+		m *= 0.5;
+		scale++;
+	}
+	*lnM = p64_logKernel(m);
+	return scale;
+}
+
+static long double p64_sinKernel( long double r ){
+	long double z = r*r;
+	return r + r*z*p64_horner(p64_sinCoeffs, 10, z);
+}
+
+static long double p64_cosKernel( long double r ){
+	long double z = r*r;
+	return 1 + z*p64_horner(p64_cosCoeffs, 11, z);
+}
+
+//Cody-Waite reduction, exact enough for |x| < 2^20
+static int p64_reducePio2( long double x, long double * r ){
+	long double n = nearbyintl(x*P64_INVPIO2);
+	*r = ((x - n*P64_PIO2_1) - n*P64_PIO2_2) - n*P64_PIO2_3;
+	return (int) ((int_fast64_t) n & 3);
+}
+
+//atan t for 0 <= t <= 1; three argument halvings bring t below tan(pi/32)
+static long double p64_atanKernel( long double t ){
+	long double z;
+	for (int i=0; i<3; i++)
+		t = t/(1 + sqrtl(1 + t*t));
+	z = t*t;
+	return 8*(t + t*z*p64_horner(p64_atanCoeffs, 11, z));
+}
+
+posit64_t p64_exp( posit64_t pA ){
+	union ui64_p64 uA, uZ;
+	int_fast32_t k;
+	long double x, m;
+
+	uA.p = pA;
+	if (uA.ui==0x8000000000000000) return pA;
+	if (uA.ui==0){
+		uZ.ui = 0x4000000000000000;
+		return uZ.p;
+	}
+	x = p64_toLongDouble(uA.ui);
+	//|x| > 256 ln 2 is far past maxpos = 2^248
+	if (x>178){
+		uZ.ui = 0x7FFFFFFFFFFFFFFF;
+		return uZ.p;
+	}
+	if (x<-178){
+		uZ.ui = 0x1;
+		return uZ.p;
+	}
+	m = p64_expScaled(x, &k);
+	return p64_fromScaledLongDouble(m, k);
+}
+
+posit64_t p64_exp2( posit64_t pA ){
+	union ui64_p64 uA, uZ;
+	long double x, n;
+
+	uA.p = pA;
+	if (uA.ui==0x8000000000000000) return pA;
+	if (uA.ui==0){
+		uZ.ui = 0x4000000000000000;
+		return uZ.p;
+	}
+	x = p64_toLongDouble(uA.ui);
+	if (x>256){
+		uZ.ui = 0x7FFFFFFFFFFFFFFF;
+		return uZ.p;
+	}
+	if (x<-256){
+		uZ.ui = 0x1;
+		return uZ.p;
+	}
+	n = nearbyintl(x);
+	//x - n is exact, and zero for integer x so powers of two come out exact
+	return p64_fromScaledLongDouble(1 + p64_expm1Kernel((x-n)*P64_LN2), (int_fast32_t)n);
+}
+
+posit64_t p64_log( posit64_t pA ){
+	union ui64_p64 uA, uZ;
+	int_fast32_t scale;
+	long double lnM;
+
+	uA.p = pA;
+	//log of zero and of negative numbers is NaR
+	if (uA.ui==0 || signP64UI(uA.ui)){
+		uZ.ui = 0x8000000000000000;
+		return uZ.p;
+	}
+	if (uA.ui==0x4000000000000000){
+		uZ.ui = 0;
+		return uZ.p;
+	}
+	scale = p64_logDecode(uA.ui, &lnM);
+	return p64_fromScaledLongDouble(scale*P64_LN2_HI + (scale*P64_LN2_LO + lnM), 0);
+}
+
+posit64_t p64_log2( posit64_t pA ){
+	union ui64_p64 uA, uZ;
+	int_fast32_t scale;
+	long double lnM;
+
+	uA.p = pA;
+	if (uA.ui==0 || signP64UI(uA.ui)){
+		uZ.ui = 0x8000000000000000;
+		return uZ.p;
+	}
+	scale = p64_logDecode(uA.ui, &lnM);
+	if (lnM==0){
+		//exact power of two
+		if (scale==0){
+			uZ.ui = 0;
+			return uZ.p;
+		}
+		return p64_fromScaledLongDouble((long double)scale, 0);
+	}
+	return p64_fromScaledLongDouble(scale + lnM*P64_LOG2E, 0);
+}
+
+posit64_t p64_sin( posit64_t pA ){
+	union ui64_p64 uA;
+	long double x, r, z;
+
+	uA.p = pA;
+	if (uA.ui==0 || uA.ui==0x8000000000000000) return pA;
+	x = p64_toLongDouble(uA.ui);
+	if (fabsl(x)>=0x1p20L)
+		return p64_fromScaledLongDouble(sinl(x), 0);
+	switch (p64_reducePio2(x, &r)){
+		case 0: z = p64_sinKernel(r); break;
+		case 1: z = p64_cosKernel(r); break;
+		case 2: z = -p64_sinKernel(r); break;
+		default: z = -p64_cosKernel(r); break;
+	}
+	return p64_fromScaledLongDouble(z, 0);
+}
+
+posit64_t p64_cos( posit64_t pA ){
+	union ui64_p64 uA, uZ;
+	long double x, r, z;
+
+	uA.p = pA;
+	if (uA.ui==0x8000000000000000) return pA;
+	if (uA.ui==0){
+		uZ.ui = 0x4000000000000000;
+		return uZ.p;
+	}
+	x = p64_toLongDouble(uA.ui);
+	if (fabsl(x)>=0x1p20L)
+		return p64_fromScaledLongDouble(cosl(x), 0);
+	switch (p64_reducePio2(x, &r)){
+		case 0: z = p64_cosKernel(r); break;
+		case 1: z = -p64_sinKernel(r); break;
+		case 2: z = -p64_cosKernel(r); break;
+		default: z = p64_sinKernel(r); break;
+	}
+	return p64_fromScaledLongDouble(z, 0);
+}
+
+posit64_t p64_tanh( posit64_t pA ){
+	union ui64_p64 uA, uZ;
+	int_fast32_t k;
+	long double x, z, e;
+
+	uA.p = pA;
+	if (uA.ui==0 || uA.ui==0x8000000000000000) return pA;
+	x = fabsl(p64_toLongDouble(uA.ui));
+	//1 - tanh x < 2^-61 already rounds to 1
+	if (x>24)
+		uZ.ui = 0x4000000000000000;
+	else{
+		if (x<0.55){
+			//no cancellation near 0
+			e = p64_expm1Kernel(2*x);
+			z = e/(e+2);
+		}
+		else{
+			e = p64_expScaled(2*x, &k);
+			z = 1 - 2/(ldexpl(e, k)+1);
+		}
+		uZ.p = p64_fromScaledLongDouble(z, 0);
+	}
+	if (signP64UI(uA.ui)) uZ.ui = -uZ.ui;
+	return uZ.p;
+}
+
+/*----------------------------------------------------------------------------
+| pow is NaR when either argument is NaR, for 0 to a non-positive power, and
+| for a negative base with a non-integer exponent.  x^0 is 1 for any other x.
+*----------------------------------------------------------------------------*/
+posit64_t p64_pow( posit64_t pA, posit64_t pB ){
+	union ui64_p64 uA, uB, uZ;
+	int_fast32_t scale;
+	long double y, t, n, lnM;
+	bool sign = 0;
+
+	uA.p = pA;
+	uB.p = pB;
+	if (uA.ui==0x8000000000000000 || uB.ui==0x8000000000000000 || (uA.ui==0 && (uB.ui==0 || signP64UI(uB.ui)))){
+		uZ.ui = 0x8000000000000000;
+		return uZ.p;
+	}
+	if (uB.ui==0 || uA.ui==0x4000000000000000){
+		uZ.ui = 0x4000000000000000;
+		return uZ.p;
+	}
+	if (uA.ui==0) return pA;
+
+	y = p64_toLongDouble(uB.ui);
+	if (signP64UI(uA.ui)){
+		if (nearbyintl(y)!=y){
+			uZ.ui = 0x8000000000000000;
+			return uZ.p;
+		}
+		sign = fmodl(y, 2)!=0;
+		uA.ui = -uA.ui;
+	}
+
+	//|x|^y = 2^(y log2 |x|)
+	scale = p64_logDecode(uA.ui, &lnM);
+	t = y*(scale + lnM*P64_LOG2E);
+	if (t>256)
+		uZ.ui = 0x7FFFFFFFFFFFFFFF;
+	else if (t<-256)
+		uZ.ui = 0x1;
+	else{
+		n = nearbyintl(t);
+		uZ.p = p64_fromScaledLongDouble(1 + p64_expm1Kernel((t-n)*P64_LN2), (int_fast32_t)n);
+	}
+	if (sign) uZ.ui = -uZ.ui;
+	return uZ.p;
+}
+
+/*----------------------------------------------------------------------------
+| atan2(y, x) in (-pi, pi].  atan2(0, 0) has no meaningful value and is NaR.
+*----------------------------------------------------------------------------*/
+posit64_t p64_atan2( posit64_t pY, posit64_t pX ){
+	union ui64_p64 uY, uX, uZ;
+	long double y, x, z;
+
+	uY.p = pY;
+	uX.p = pX;
+	if (uY.ui==0x8000000000000000 || uX.ui==0x8000000000000000 || (uY.ui==0 && uX.ui==0)){
+		uZ.ui = 0x8000000000000000;
+		return uZ.p;
+	}
+	if (uY.ui==0){
+		//+0 or pi
+		uZ.p = signP64UI(uX.ui) ? p64_fromScaledLongDouble(P64_PI, 0) : pY;
+		return uZ.p;
+	}
+	y = fabsl(p64_toLongDouble(uY.ui));
+	x = (uX.ui==0) ? 0 : p64_toLongDouble(uX.ui);
+
+	if (y<=fabsl(x))
+		z = p64_atanKernel(y/fabsl(x));
+	else
+		z = P64_PIO2 - p64_atanKernel(fabsl(x)/y);
+	if (x<0) z = P64_PI - z;
+
+	uZ.p = p64_fromScaledLongDouble(z, 0);
+	if (signP64UI(uY.ui)) uZ.ui = -uZ.ui;
+	return uZ.p;
+}
+
+/*----------------------------------------------------------------------------
+| Array forms.
+*----------------------------------------------------------------------------*/
+void p64_exp_n( const posit64_t * a, size_t n, posit64_t * z ){
+	for (size_t i=0; i<n; i++) z[i] = p64_exp(a[i]);
+}
+
+void p64_exp2_n( const posit64_t * a, size_t n, posit64_t * z ){
+	for (size_t i=0; i<n; i++) z[i] = p64_exp2(a[i]);
+}
+
+void p64_log_n( const posit64_t * a, size_t n, posit64_t * z ){
+	for (size_t i=0; i<n; i++) z[i] = p64_log(a[i]);
+}
+
+void p64_log2_n( const posit64_t * a, size_t n, posit64_t * z ){
+	for (size_t i=0; i<n; i++) z[i] = p64_log2(a[i]);
+}
+
+void p64_sin_n( const posit64_t * a, size_t n, posit64_t * z ){
+	for (size_t i=0; i<n; i++) z[i] = p64_sin(a[i]);
+}
+
+void p64_cos_n( const posit64_t * a, size_t n, posit64_t * z ){
+	for (size_t i=0; i<n; i++) z[i] = p64_cos(a[i]);
+}
+
+void p64_tanh_n( const posit64_t * a, size_t n, posit64_t * z ){
+	for (size_t i=0; i<n; i++) z[i] = p64_tanh(a[i]);
+}
+
+void p64_pow_n( const posit64_t * a, const posit64_t * b, size_t n, posit64_t * z ){
+	for (size_t i=0; i<n; i++) z[i] = p64_pow(a[i], b[i]);
+}
+
+void p64_atan2_n( const posit64_t * y, const posit64_t * x, size_t n, posit64_t * z ){
+	for (size_t i=0; i<n; i++) z[i] = p64_atan2(y[i], x[i]);
+}
+
@@ -55,36 +55,20 @@ posit64_t p64_mul( posit64_t pA, posit64_t pB ){
 	int_fast8_t kA=0;
 	uint128_t frac128Z;
 
+	SOFTPOSIT_STAT_OP( mul, p64 );
 	uA.p = pA;
 	uiA = uA.ui;
 	uB.p = pB;
 	uiB = uB.ui;
 
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.exact = (uiA.ui.exact & uiB.ui.exact);
-#endif
 	//NaR or Zero
 	if ( uiA==0x8000000000000000 || uiB==0x8000000000000000 ){
-
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = 0x8000000000000000;
-		uZ.ui.exact = 0;
-#else
+		SOFTPOSIT_STAT_NAR( p64 );
 		uZ.ui = 0x8000000000000000;
-#endif
 		return uZ.p;
 	}
 	else if (uiA==0 || uiB==0){
-#ifdef SOFTPOSIT_EXACT
-
-		uZ.ui.v = 0;
-		if ( (uiA==0 && uiA.ui.exact) || (uiB==0 && uiB.ui.exact) )
-			uZ.ui.exact = 1;
-		else
-			uZ.ui.exact = 0;
-#else
 		uZ.ui = 0;
-#endif
 		return uZ.p;
 	}
 
@@ -164,6 +148,7 @@ posit64_t p64_mul( posit64_t pA, posit64_t pB ){
 	if(regA>62){
 		//max or min pos. exp and frac does not matter.
 		(regSA) ? (uZ.ui= 0x7FFFFFFFFFFFFFFF): (uZ.ui=0x1);
+		SOFTPOSIT_SATURATED( p64, regSA, !regSA || regA>63 || expA || (frac128Z & (((uint128_t)1 << 124) - 1)) );
 	}
 	else{
 		//remove carry and rcarry bits and shift to correct position (2 bits exp, so + 1 than 16 bits)
@@ -191,6 +176,7 @@ posit64_t p64_mul( posit64_t pA, posit64_t pB ){
 		}
 		//sign is always zero
 		uZ.ui = packToP64UI(regime, expA, fracA);
+		SOFTPOSIT_ROUNDED( p64, bitNPlusOne, bitsMore || (0x7FFFFFFFFFFFFFFF & frac128Z), uZ.ui&1 );
 		//n+1 frac bit is 1. Need to check if another bit is 1 too if not round to even
 		if (bitNPlusOne){
 			if (0x7FFFFFFFFFFFFFFF & frac128Z)  bitsMore=1;
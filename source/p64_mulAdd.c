@@ -44,6 +44,7 @@ posit64_t p64_mulAdd( posit64_t a, posit64_t b, posit64_t c ) {
     union ui64_p64 uC;
     uint_fast64_t uiC;
 
+    SOFTPOSIT_STAT_OP( mulAdd, p64 );
     uA.p = a;
     uiA = uA.ui;
     uB.p = b;
@@ -0,0 +1,281 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Posits order exactly like two's complement integers, so sorting never has to
+| decode them.  Flipping the sign bit turns the bit patterns into unsigned keys
+| for an LSD radix sort.  NaR (0x8000000000000000) becomes key 0 and therefore sorts
+| before every real value, the same order p64_lt gives.
+*----------------------------------------------------------------------------*/
+#define p64SortKey( a ) ( (uint64_t) (a) ^ 0x8000000000000000ULL )
+#define P64_SORT_SMALL 32
+
+static void p64_insertionSort( posit64_t * a, size_t n ){
+	for (size_t i=1; i<n; i++){
+		posit64_t pA = a[i];
+		size_t j = i;
+		while (j>0 && (int64_t)a[j-1].v > (int64_t)pA.v){
+			a[j] = a[j-1];
+			j--;
+		}
+		a[j] = pA;
+	}
+}
+
+//Only used when the radix buffers cannot be allocated
+static void p64_siftDown( posit64_t * a, size_t root, size_t n ){
+	size_t child;
+	while ((child = 2*root+1) < n){
+		if (child+1<n && (int64_t)a[child].v < (int64_t)a[child+1].v) child++;
+		if ((int64_t)a[root].v >= (int64_t)a[child].v) return;
+		posit64_t pT = a[root]; a[root] = a[child]; a[child] = pT;
+		root = child;
+	}
+}
+
+static void p64_heapSort( posit64_t * a, size_t n ){
+	for (size_t i=n/2; i-->0;)
+		p64_siftDown(a, i, n);
+	for (size_t i=n; i-->1;){
+		posit64_t pT = a[0]; a[0] = a[i]; a[i] = pT;
+		p64_siftDown(a, 0, i);
+	}
+}
+
+//Heap sort of the indices alone, so argsort needs no memory at all; ties
+//are broken by index, which keeps it as stable as the radix sort
+static bool p64_argLess( const posit64_t * a, size_t i, size_t j ){
+	return (int64_t)a[i].v < (int64_t)a[j].v || (a[i].v==a[j].v && i<j);
+}
+
+static void p64_argSiftDown( const posit64_t * a, size_t * idx, size_t root, size_t n ){
+	size_t child;
+	while ((child = 2*root+1) < n){
+		if (child+1<n && p64_argLess(a, idx[child], idx[child+1])) child++;
+		if (!p64_argLess(a, idx[root], idx[child])) return;
+		size_t t = idx[root]; idx[root] = idx[child]; idx[child] = t;
+		root = child;
+	}
+}
+
+static void p64_argHeapSort( const posit64_t * a, size_t * idx, size_t n ){
+	for (size_t i=n/2; i-->0;)
+		p64_argSiftDown(a, idx, i, n);
+	for (size_t i=n; i-->1;){
+		size_t t = idx[0]; idx[0] = idx[i]; idx[i] = t;
+		p64_argSiftDown(a, idx, 0, i);
+	}
+}
+
+/*----------------------------------------------------------------------------
+| Stable LSD radix sort of 'n' keys (sign bit already flipped) with 8-bit
+| digits.  All eight histograms are built in one read pass and digits on which
+| every key agrees are skipped, so data confined to a narrow range of scales
+| costs fewer passes.  'idx', if not NULL, is permuted along with the keys.
+| The result always ends up back in 'keys'.
+*----------------------------------------------------------------------------*/
+static void p64_radixSort(
+	posit64_t * keys, posit64_t * tmpKeys, size_t * idx, size_t * tmpIdx, size_t n ){
+
+	size_t count[8][256] = {{0}};
+	posit64_t * src = keys, * dst = tmpKeys, * pT;
+	size_t * srcIdx = idx, * dstIdx = tmpIdx, * iT;
+	int pass, shift;
+
+	for (size_t i=0; i<n; i++){
+		uint64_t uiA = keys[i].v;
+		for (pass=0; pass<8; pass++)
+			count[pass][(uiA>>(pass<<3)) & 0xFF]++;
+	}
+
+	for (pass=0; pass<8; pass++){
+		shift = pass<<3;
+		size_t * c = count[pass];
+		if (c[(src[0].v>>shift) & 0xFF]==n) continue;
+
+		size_t sum = 0;
+		for (int d=0; d<256; d++){
+			size_t t = c[d];
+			c[d] = sum;
+			sum += t;
+		}
+		if (srcIdx){
+			for (size_t i=0; i<n; i++){
+				size_t pos = c[(src[i].v>>shift) & 0xFF]++;
+				dst[pos] = src[i];
+				dstIdx[pos] = srcIdx[i];
+			}
+			iT = srcIdx; srcIdx = dstIdx; dstIdx = iT;
+		}
+		else{
+			for (size_t i=0; i<n; i++)
+				dst[c[(src[i].v>>shift) & 0xFF]++] = src[i];
+		}
+		pT = src; src = dst; dst = pT;
+	}
+
+	if (src!=keys){
+		memcpy(keys, src, n*sizeof(posit64_t));
+		if (idx) memcpy(idx, srcIdx, n*sizeof(size_t));
+	}
+}
+
+void p64_sort_n( posit64_t * a, size_t n ){
+	posit64_t * tmp;
+
+	if (n<2) return;
+	if (n<=P64_SORT_SMALL){
+		p64_insertionSort(a, n);
+		return;
+	}
+	tmp = malloc(n*sizeof(posit64_t));
+	if (!tmp){
+		p64_heapSort(a, n);
+		return;
+	}
+	for (size_t i=0; i<n; i++) a[i].v = p64SortKey(a[i].v);
+	p64_radixSort(a, tmp, NULL, NULL, n);
+	for (size_t i=0; i<n; i++) a[i].v = p64SortKey(a[i].v);
+	free(tmp);
+}
+
+void p64_argsort_n( const posit64_t * a, size_t n, size_t * idx ){
+	posit64_t * keys;
+	size_t * tmpIdx;
+
+	for (size_t i=0; i<n; i++) idx[i] = i;
+	if (n<2) return;
+
+	keys = malloc(2*n*sizeof(posit64_t));
+	tmpIdx = malloc(n*sizeof(size_t));
+	if (!keys || !tmpIdx){
+		free(tmpIdx);
+		free(keys);
+		p64_argHeapSort(a, idx, n);
+		return;
+	}
+	for (size_t i=0; i<n; i++) keys[i].v = p64SortKey(a[i].v);
+	p64_radixSort(keys, keys+n, idx, tmpIdx, n);
+	free(tmpIdx);
+	free(keys);
+}
+
+/*----------------------------------------------------------------------------
+| Writes the 'k' largest values of 'a' to 'out' in descending order, and their
+| positions to 'idx' when it is not NULL.  Equal values keep their original
+| order.  NaR is the smallest posit, so it only appears once every real value
+| has been taken.  Returns the number of values written, min(k, n).
+*----------------------------------------------------------------------------*/
+static bool p64_topkWorse( const posit64_t * out, const size_t * idx, size_t i, size_t j ){
+	if (out[i].v!=out[j].v) return (int64_t)out[i].v < (int64_t)out[j].v;
+	return idx && idx[i]>idx[j];
+}
+
+static void p64_topkSiftDown( posit64_t * out, size_t * idx, size_t root, size_t k ){
+	size_t child;
+	while ((child = 2*root+1) < k){
+		if (child+1<k && p64_topkWorse(out, idx, child+1, child)) child++;
+		if (!p64_topkWorse(out, idx, child, root)) return;
+		posit64_t pT = out[root]; out[root] = out[child]; out[child] = pT;
+		if (idx){
+			size_t t = idx[root]; idx[root] = idx[child]; idx[child] = t;
+		}
+		root = child;
+	}
+}
+
+size_t p64_topk_n( const posit64_t * a, size_t n, size_t k, posit64_t * out, size_t * idx ){
+	if (k>n) k = n;
+	if (k==0) return 0;
+
+	//min-heap holding the best k seen so far, the worst of them at the root
+	for (size_t i=0; i<k; i++){
+		out[i] = a[i];
+		if (idx) idx[i] = i;
+	}
+	for (size_t i=k/2; i-->0;)
+		p64_topkSiftDown(out, idx, i, k);
+	for (size_t i=k; i<n; i++){
+		//a later equal value never displaces an earlier one
+		if ((int64_t)a[i].v <= (int64_t)out[0].v) continue;
+		out[0] = a[i];
+		if (idx) idx[0] = i;
+		p64_topkSiftDown(out, idx, 0, k);
+	}
+	//popping the worst to the back leaves the heap sorted best first
+	for (size_t i=k; i-->1;){
+		posit64_t pT = out[0]; out[0] = out[i]; out[i] = pT;
+		if (idx){
+			size_t t = idx[0]; idx[0] = idx[i]; idx[i] = t;
+		}
+		p64_topkSiftDown(out, idx, 0, i);
+	}
+	return k;
+}
+
+/*----------------------------------------------------------------------------
+| Index of the first element of the sorted array 'a' that is not less than
+| 'pB' (lower bound), using a branch-free binary search.
+*----------------------------------------------------------------------------*/
+size_t p64_searchsorted( const posit64_t * a, size_t n, posit64_t pB ){
+	const posit64_t * base = a;
+	int64_t uiB = (int64_t) pB.v;
+
+	if (n==0) return 0;
+	while (n>1){
+		size_t half = n>>1;
+		base = ((int64_t)base[half].v < uiB) ? base+half : base;
+		n -= half;
+	}
+	return (size_t)(base-a) + ((int64_t)base->v < uiB);
+}
+
+void p64_searchsorted_n(
+	const posit64_t * a, size_t n, const posit64_t * b, size_t m, size_t * pos ){
+	for (size_t i=0; i<m; i++)
+		pos[i] = p64_searchsorted(a, n, b[i]);
+}
+
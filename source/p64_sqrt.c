@@ -0,0 +1,78 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <math.h>
+
+#include "platform.h"
+#include "internals.h"
+
+posit64_t p64_sqrt( posit64_t pA ){
+	union ui64_p64 uA;
+	uint_fast64_t uiA, sig, root;
+	unsigned __int128 rad;
+	long double r;
+	int_fast32_t scale;
+	int odd;
+
+	SOFTPOSIT_STAT_OP( sqrt, p64 );
+	uA.p = pA;
+	uiA = uA.ui;
+
+	//NaR and negative arguments give NaR; zero is its own root
+	if (uiA>>63){
+		SOFTPOSIT_STAT_NAR( p64 );
+		uA.ui = 0x8000000000000000;
+		return uA.p;
+	}
+	if (uiA==0) return pA;
+
+	scale = softposit_decodeMagPX( uiA, 2, &sig );
+	odd = scale & 1;
+	//rad = sig * 2^(63+odd) lies in [2^126, 2^128), so its root has 64 bits.
+	//The extended-precision estimate is within a unit or two; fix it up exactly.
+	rad = (unsigned __int128) sig << (63+odd);
+	r = sqrtl( (long double) rad );
+	root = (r >= 18446744073709551616.0L) ? UINT64_MAX : (uint_fast64_t) r;
+	while ((unsigned __int128) root * root > rad) root--;
+	while (root != UINT64_MAX && (unsigned __int128) (root+1) * (root+1) <= rad) root++;
+
+	uA.ui = softposit_roundPackMagPXAt( (scale-odd)/2, root, (unsigned __int128) root * root != rad, 64, 2, softposit_stat_p64 );
+	return uA.p;
+}
@@ -42,32 +42,20 @@ posit8_t p8_add( posit8_t a, posit8_t b )
     uint_fast8_t uiA, uiB;
     union ui8_p8 uZ;
 
+    SOFTPOSIT_STAT_OP( add, p8 );
     uA.p = a;
 	uiA = uA.ui;
 	uB.p = b;
 	uiB = uB.ui;
 
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.exact = (uiA.ui.exact & uiB.ui.exact);
-#endif
-
     //Zero or infinity
 	if (uiA==0 || uiB==0){ // Not required but put here for speed
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = uiA | uiB;
-		uZ.ui.exact = (uiA.ui.exact & uiB.ui.exact);
-#else
 		uZ.ui = uiA | uiB;
-#endif
 		return uZ.p;
 	}
 	else if ( uiA==0x80 || uiB==0x80 ){
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = 0x80;
-		uZ.ui.exact = 0;
-#else
+		SOFTPOSIT_STAT_NAR( p8 );
 		uZ.ui = 0x80;
-#endif
 		return uZ.p;
 	}
 
@@ -0,0 +1,104 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Batch arithmetic for 8-bit posits: elementwise loops over the scalar
+| operations, a dot product accumulated exactly in the quire, and double
+| conversions.  z may alias a or b.
+*----------------------------------------------------------------------------*/
+void p8_add_n( const posit8_t * a, const posit8_t * b, size_t n, posit8_t * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = p8_add( a[i], b[i] );
+}
+
+void p8_sub_n( const posit8_t * a, const posit8_t * b, size_t n, posit8_t * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = p8_sub( a[i], b[i] );
+}
+
+void p8_mul_n( const posit8_t * a, const posit8_t * b, size_t n, posit8_t * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = p8_mul( a[i], b[i] );
+}
+
+void p8_div_n( const posit8_t * a, const posit8_t * b, size_t n, posit8_t * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = p8_div( a[i], b[i] );
+}
+
+//z = a*b + c, rounded once
+void p8_mulAdd_n( const posit8_t * a, const posit8_t * b, const posit8_t * c, size_t n, posit8_t * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = p8_mulAdd( a[i], b[i], c[i] );
+}
+
+void p8_sqrt_n( const posit8_t * a, size_t n, posit8_t * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = p8_sqrt( a[i] );
+}
+
+posit8_t p8_dot_n( const posit8_t * a, const posit8_t * b, size_t n ){
+	quire8_t qZ = q8Clr();
+	size_t i;
+
+	for (i=0; i<n; i++) qZ = q8_fdp_add( qZ, a[i], b[i] );
+	return q8_to_p8( qZ );
+}
+
+void convertDoubleToP8_n( const double * a, size_t n, posit8_t * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = convertDoubleToP8( a[i] );
+}
+
+void convertP8ToDouble_n( const posit8_t * a, size_t n, double * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = convertP8ToDouble( a[i] );
+}
@@ -0,0 +1,207 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Array kernels that only need the two's complement order of posits.  Every
+| loop works on the raw bit patterns with plain integer operations so the
+| compiler can turn it into integer SIMD.
+|
+| min, max, argmin and argmax return NaR (or the position of the first NaR)
+| as soon as the array holds one, like the arithmetic operations do.  For max
+| the bit patterns are shifted down by one so that NaR wraps around to the
+| top of the order and the same vectorised maximum finds it.
+*----------------------------------------------------------------------------*/
+#define P8_ARG_BLOCK 1024
+#define p8MaxKey( a ) ( (int8_t) ((uint8_t) (a) - 1) )
+
+posit8_t p8_min_n( const posit8_t * a, size_t n ){
+	union ui8_p8 uZ;
+	int8_t m = 0x7F;
+
+	if (n==0){
+		uZ.ui = 0x80;
+		return uZ.p;
+	}
+	for (size_t i=0; i<n; i++){
+		int8_t uiA = (int8_t) a[i].v;
+		m = (uiA<m) ? uiA : m;
+	}
+	uZ.ui = (uint8_t) m;
+	return uZ.p;
+}
+
+posit8_t p8_max_n( const posit8_t * a, size_t n ){
+	union ui8_p8 uZ;
+	int8_t m = INT8_MIN;
+
+	if (n==0){
+		uZ.ui = 0x80;
+		return uZ.p;
+	}
+	for (size_t i=0; i<n; i++){
+		int8_t key = p8MaxKey(a[i].v);
+		m = (key>m) ? key : m;
+	}
+	uZ.ui = (uint8_t) m + 1;
+	return uZ.p;
+}
+
+/*----------------------------------------------------------------------------
+| The argument reductions run the vectorised reduction block by block and
+| remember the first block that improved on the best value, then scan only
+| that block for the first position holding it.  Returns 0 when 'n' is 0.
+*----------------------------------------------------------------------------*/
+size_t p8_argmin_n( const posit8_t * a, size_t n ){
+	int8_t best = 0x7F;
+	size_t bestBlock = 0, i;
+
+	if (n==0) return 0;
+	for (size_t b=0; b<n; b+=P8_ARG_BLOCK){
+		size_t e = (n-b<P8_ARG_BLOCK) ? n : b+P8_ARG_BLOCK;
+		int8_t m = 0x7F;
+		for (i=b; i<e; i++){
+			int8_t uiA = (int8_t) a[i].v;
+			m = (uiA<m) ? uiA : m;
+		}
+		if (b==0 || m<best){
+			best = m;
+			bestBlock = b;
+		}
+	}
+	for (i=bestBlock; (int8_t)a[i].v!=best; i++);
+	return i;
+}
+
+size_t p8_argmax_n( const posit8_t * a, size_t n ){
+	int8_t best = INT8_MIN;
+	size_t bestBlock = 0, i;
+
+	if (n==0) return 0;
+	for (size_t b=0; b<n; b+=P8_ARG_BLOCK){
+		size_t e = (n-b<P8_ARG_BLOCK) ? n : b+P8_ARG_BLOCK;
+		int8_t m = INT8_MIN;
+		for (i=b; i<e; i++){
+			int8_t key = p8MaxKey(a[i].v);
+			m = (key>m) ? key : m;
+		}
+		if (b==0 || m>best){
+			best = m;
+			bestBlock = b;
+		}
+	}
+	for (i=bestBlock; p8MaxKey(a[i].v)!=best; i++);
+	return i;
+}
+
+//NaR elements stay NaR; a NaR bound turns every element into NaR
+void p8_clamp_n( const posit8_t * a, size_t n, posit8_t lo, posit8_t hi, posit8_t * z ){
+	int8_t uiLo = (int8_t) lo.v, uiHi = (int8_t) hi.v;
+
+	if (isNaRP8UI(lo.v) || isNaRP8UI(hi.v)){
+		for (size_t i=0; i<n; i++) z[i].v = 0x80;
+		return;
+	}
+	for (size_t i=0; i<n; i++){
+		int8_t uiA = (int8_t) a[i].v;
+		int8_t uiZ = (uiA<uiLo) ? uiLo : uiA;
+		uiZ = (uiZ>uiHi) ? uiHi : uiZ;
+		z[i].v = (uint8_t) ((uiA==INT8_MIN) ? uiA : uiZ);
+	}
+}
+
+//z[i] = mask[i] ? a[i] : b[i]
+void p8_select_n(
+	const uint8_t * mask, const posit8_t * a, const posit8_t * b, size_t n, posit8_t * z ){
+	for (size_t i=0; i<n; i++)
+		z[i].v = mask[i] ? a[i].v : b[i].v;
+}
+
+/*----------------------------------------------------------------------------
+| Elementwise comparisons writing 1 or 0 per element into 'mask', with the
+| same results as p8_eq, p8_le and p8_lt.
+*----------------------------------------------------------------------------*/
+void p8_eq_n( const posit8_t * a, const posit8_t * b, size_t n, uint8_t * mask ){
+	for (size_t i=0; i<n; i++)
+		mask[i] = (a[i].v==b[i].v);
+}
+
+void p8_le_n( const posit8_t * a, const posit8_t * b, size_t n, uint8_t * mask ){
+	for (size_t i=0; i<n; i++)
+		mask[i] = ((int8_t)a[i].v<=(int8_t)b[i].v);
+}
+
+void p8_lt_n( const posit8_t * a, const posit8_t * b, size_t n, uint8_t * mask ){
+	for (size_t i=0; i<n; i++)
+		mask[i] = ((int8_t)a[i].v<(int8_t)b[i].v);
+}
+
+size_t p8_countNaR_n( const posit8_t * a, size_t n ){
+	size_t count = 0;
+
+	//narrow per-block counters keep the SIMD lanes as wide as the data
+	for (size_t b=0; b<n; b+=65535){
+		size_t e = (n-b<65535) ? n : b+65535;
+		uint16_t c = 0;
+		for (size_t i=b; i<e; i++)
+			c += (a[i].v==0x80);
+		count += c;
+	}
+	return count;
+}
+
+/*----------------------------------------------------------------------------
+| Array forms of absP8 and negP8; NaR maps to itself.
+*----------------------------------------------------------------------------*/
+void p8_abs_n( const posit8_t * a, size_t n, posit8_t * z ){
+	for (size_t i=0; i<n; i++){
+		uint8_t uiA = a[i].v;
+		uint8_t mask = -(uiA>>7);
+		z[i].v = (uiA + mask) ^ mask;
+	}
+}
+
+void p8_neg_n( const posit8_t * a, size_t n, posit8_t * z ){
+	for (size_t i=0; i<n; i++)
+		z[i].v = -a[i].v;
+}
+
@@ -46,6 +46,7 @@ posit8_t p8_div( posit8_t pA, posit8_t pB ) {
 	uint_fast16_t frac16A, frac16Z, rem;
 	div_t divresult;
 
+	SOFTPOSIT_STAT_OP( div, p8 );
 	uA.p = pA;
 	uiA = uA.ui;
 	uB.p = pB;
@@ -53,24 +54,12 @@ posit8_t p8_div( posit8_t pA, posit8_t pB ) {
 
 	//Zero or infinity
 	if ( uiA==0x80 || uiB==0x80 || uiB==0){
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = 0x80;
-		uZ.ui.exact = 0;
-#else
+		SOFTPOSIT_STAT_NAR( p8 );
 		uZ.ui = 0x80;
-#endif
 		return uZ.p;
 	}
 	else if (uiA==0){
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = 0;
-		if ( (uiA==0 && uiA.ui.exact) || (uiB==0 && uiB.ui.exact) )
-			uZ.ui.exact = 1;
-		else
-			uZ.ui.exact = 0;
-#else
 		uZ.ui = 0;
-#endif
 		return uZ.p;
 	}
 
@@ -143,6 +132,7 @@ posit8_t p8_div( posit8_t pA, posit8_t pB ) {
 	if(regA>6){
 		//max or min pos. exp and frac does not matter.
 		(regSA) ? (uZ.ui= 0x7F): (uZ.ui=0x1);
+		SOFTPOSIT_SATURATED( p8, regSA, !regSA || regA>7 || (frac16Z&0x7F) || rem );
 	}
 	else{
 		//remove carry and rcarry bits and shift to correct position
@@ -153,6 +143,7 @@ posit8_t p8_div( posit8_t pA, posit8_t pB ) {
 		uZ.ui = packToP8UI(regime, fracA);
 
 		//uZ.ui = (uint16_t) (regime) + ((uint16_t) (expA)<< (13-regA)) + ((uint16_t)(fracA));
+		SOFTPOSIT_ROUNDED( p8, bitNPlusOne, bitsMore || (((1<<regA)-1) & frac16Z) || rem, uZ.ui&1 );
 		if (bitNPlusOne){
 			(((1<<regA)-1) & frac16Z) ? (bitsMore=1) : (bitsMore=0);
 			if (rem) bitsMore =1;
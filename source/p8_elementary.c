@@ -0,0 +1,112 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#ifdef __AVX512VBMI__
+#include <immintrin.h>
+#endif
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Posit8 functions by table lookup.  There are only 256 posit8 values, so
+| each function is a table of correctly rounded results produced when the
+| library is built (see gen_elementaryTables.c).  With AVX-512 VBMI a whole
+| table fits in four registers and the batch forms look up 64 values per
+| pair of byte permutes.
+*----------------------------------------------------------------------------*/
+static void p8_lookup_n( const uint8_t * table, const posit8_t * a, size_t n, posit8_t * z ){
+
+	size_t i = 0;
+#ifdef __AVX512VBMI__
+	__m512i t0 = _mm512_loadu_si512( table ), t1 = _mm512_loadu_si512( table+64 );
+	__m512i t2 = _mm512_loadu_si512( table+128 ), t3 = _mm512_loadu_si512( table+192 );
+	for (; i<n; i+=64){
+		__mmask64 m = (n-i>=64) ? ~(__mmask64)0 : (((__mmask64)1<<(n-i))-1);
+		__m512i idx = _mm512_maskz_loadu_epi8( m, a+i );
+		__m512i lo = _mm512_permutex2var_epi8( t0, idx, t1 );
+		__m512i hi = _mm512_permutex2var_epi8( t2, idx, t3 );
+		_mm512_mask_storeu_epi8( z+i, m, _mm512_mask_blend_epi8( _mm512_movepi8_mask(idx), lo, hi ) );
+	}
+#endif
+	for (; i<n; i++) z[i].v = table[a[i].v];
+}
+
+#define P8_TABLE_FUNCTION( name ) \
+	posit8_t p8_##name( posit8_t a ){ \
+		union ui8_p8 uZ; \
+		uZ.ui = softposit_##name##P8[castUI(a)]; \
+		return uZ.p; \
+	} \
+	void p8_##name##_n( const posit8_t * a, size_t n, posit8_t * z ){ \
+		p8_lookup_n( softposit_##name##P8, a, n, z ); \
+	}
+
+P8_TABLE_FUNCTION( exp )
+P8_TABLE_FUNCTION( log )
+P8_TABLE_FUNCTION( sigmoid )
+P8_TABLE_FUNCTION( tanh )
+P8_TABLE_FUNCTION( gelu )
+P8_TABLE_FUNCTION( reciprocal )
+P8_TABLE_FUNCTION( rsqrt )
+P8_TABLE_FUNCTION( sin )
+P8_TABLE_FUNCTION( cos )
+
+/*----------------------------------------------------------------------------
+| For es=0 the logistic function is approximated by flipping the sign bit
+| and shifting right two places (Gustafson's fast sigmoid); the result lies
+| within a few percent of 1/(1+exp(-x)) over the whole range.
+*----------------------------------------------------------------------------*/
+posit8_t p8_sigmoidFast( posit8_t a ){
+	union ui8_p8 uA, uZ;
+
+	uA.p = a;
+	uZ.ui = (uA.ui==0x80) ? 0x80 : (uint8_t) (uA.ui^0x80)>>2;
+	return uZ.p;
+}
+
+void p8_sigmoidFast_n( const posit8_t * a, size_t n, posit8_t * z ){
+	size_t i;
+
+	for (i=0; i<n; i++){
+		uint8_t uiA = a[i].v;
+		z[i].v = (uiA==0x80) ? 0x80 : (uint8_t) (uiA^0x80)>>2;
+	}
+}
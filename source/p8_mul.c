@@ -45,36 +45,20 @@ posit8_t p8_mul( posit8_t pA, posit8_t pB ){
 	int_fast8_t kA=0;
 	uint_fast16_t frac16Z;
 
+	SOFTPOSIT_STAT_OP( mul, p8 );
 	uA.p = pA;
 	uiA = uA.ui;
 	uB.p = pB;
 	uiB = uB.ui;
 
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.exact = (uiA.ui.exact & uiB.ui.exact);
-#endif
 	//NaR or Zero
 	if ( uiA==0x80 || uiB==0x80 ){
-
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = 0x80;
-		uZ.ui.exact = 0;
-#else
+		SOFTPOSIT_STAT_NAR( p8 );
 		uZ.ui = 0x80;
-#endif
 		return uZ.p;
 	}
 	else if (uiA==0 || uiB==0){
-#ifdef SOFTPOSIT_EXACT
-
-		uZ.ui.v = 0;
-		if ( (uiA==0 && uiA.ui.exact) || (uiB==0 && uiB.ui.exact) )
-			uZ.ui.exact = 1;
-		else
-			uZ.ui.exact = 0;
-#else
 		uZ.ui = 0;
-#endif
 		return uZ.p;
 	}
 
@@ -125,6 +109,7 @@ posit8_t p8_mul( posit8_t pA, posit8_t pB ){
 	rcarry = frac16Z>>15;//1st bit of frac32Z
 	if (rcarry){
 		kA++;
+		if (frac16Z&0x1) bitsMore=1;
 		frac16Z>>=1;
 	}
 
@@ -144,14 +129,17 @@ posit8_t p8_mul( posit8_t pA, posit8_t pB ){
 	if(regA>6){
 		//max or min pos. exp and frac does not matter.
 		(regSA) ? (uZ.ui= 0x7F): (uZ.ui=0x1);
+		SOFTPOSIT_SATURATED( p8, regSA, !regSA || regA>7 || (frac16Z&0x3FFF) || bitsMore );
 	}
 	else{
 		//remove carry and rcarry bits and shift to correct position
+		if (frac16Z & ((1<<regA)-1)) bitsMore=1;
 		frac16Z = (frac16Z&0x3FFF) >> regA;
 		fracA = (uint_fast8_t) (frac16Z>>8);
 		bitNPlusOne = (0x80 & frac16Z) ;
 		uZ.ui = packToP8UI(regime, fracA);
 
+		SOFTPOSIT_ROUNDED( p8, bitNPlusOne, bitsMore || (0x7F & frac16Z), uZ.ui&1 );
 		//n+1 frac bit is 1. Need to check if another bit is 1 too if not round to even
 		if (bitNPlusOne){
 			if (0x7F & frac16Z)  bitsMore=1;
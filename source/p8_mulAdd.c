@@ -44,6 +44,7 @@ posit8_t p8_mulAdd( posit8_t a, posit8_t b, posit8_t c )
     union ui8_p8 uC;
     uint_fast8_t uiC;
 
+    SOFTPOSIT_STAT_OP( mulAdd, p8 );
     uA.p = a;
     uiA = uA.ui;
     uB.p = b;
@@ -0,0 +1,151 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Posits order exactly like two's complement integers, so sorting never has to
+| decode them.  With only 256 bit patterns a single counting pass over the
+| sign-flipped pattern sorts any array.  NaR (0x80) becomes key 0 and
+| therefore sorts before every real value, the same order p8_lt gives.
+*----------------------------------------------------------------------------*/
+#define p8SortKey( a ) ( (uint8_t) ((a) ^ 0x80) )
+
+void p8_sort_n( posit8_t * a, size_t n ){
+	size_t count[256] = {0};
+	size_t i = 0;
+
+	for (size_t j=0; j<n; j++) count[p8SortKey(a[j].v)]++;
+	for (int d=0; d<256; d++){
+		uint8_t uiA = p8SortKey(d);
+		for (size_t c=count[d]; c>0; c--) a[i++].v = uiA;
+	}
+}
+
+void p8_argsort_n( const posit8_t * a, size_t n, size_t * idx ){
+	size_t count[256] = {0};
+	size_t sum = 0;
+
+	for (size_t i=0; i<n; i++) count[p8SortKey(a[i].v)]++;
+	for (int d=0; d<256; d++){
+		size_t t = count[d];
+		count[d] = sum;
+		sum += t;
+	}
+	for (size_t i=0; i<n; i++) idx[count[p8SortKey(a[i].v)]++] = i;
+}
+
+/*----------------------------------------------------------------------------
+| Writes the 'k' largest values of 'a' to 'out' in descending order, and their
+| positions to 'idx' when it is not NULL.  Equal values keep their original
+| order.  NaR is the smallest posit, so it only appears once every real value
+| has been taken.  Returns the number of values written, min(k, n).
+*----------------------------------------------------------------------------*/
+static bool p8_topkWorse( const posit8_t * out, const size_t * idx, size_t i, size_t j ){
+	if (out[i].v!=out[j].v) return (int8_t)out[i].v < (int8_t)out[j].v;
+	return idx && idx[i]>idx[j];
+}
+
+static void p8_topkSiftDown( posit8_t * out, size_t * idx, size_t root, size_t k ){
+	size_t child;
+	while ((child = 2*root+1) < k){
+		if (child+1<k && p8_topkWorse(out, idx, child+1, child)) child++;
+		if (!p8_topkWorse(out, idx, child, root)) return;
+		posit8_t pT = out[root]; out[root] = out[child]; out[child] = pT;
+		if (idx){
+			size_t t = idx[root]; idx[root] = idx[child]; idx[child] = t;
+		}
+		root = child;
+	}
+}
+
+size_t p8_topk_n( const posit8_t * a, size_t n, size_t k, posit8_t * out, size_t * idx ){
+	if (k>n) k = n;
+	if (k==0) return 0;
+
+	//min-heap holding the best k seen so far, the worst of them at the root
+	for (size_t i=0; i<k; i++){
+		out[i] = a[i];
+		if (idx) idx[i] = i;
+	}
+	for (size_t i=k/2; i-->0;)
+		p8_topkSiftDown(out, idx, i, k);
+	for (size_t i=k; i<n; i++){
+		//a later equal value never displaces an earlier one
+		if ((int8_t)a[i].v <= (int8_t)out[0].v) continue;
+		out[0] = a[i];
+		if (idx) idx[0] = i;
+		p8_topkSiftDown(out, idx, 0, k);
+	}
+	//popping the worst to the back leaves the heap sorted best first
+	for (size_t i=k; i-->1;){
+		posit8_t pT = out[0]; out[0] = out[i]; out[i] = pT;
+		if (idx){
+			size_t t = idx[0]; idx[0] = idx[i]; idx[i] = t;
+		}
+		p8_topkSiftDown(out, idx, 0, i);
+	}
+	return k;
+}
+
+/*----------------------------------------------------------------------------
+| Index of the first element of the sorted array 'a' that is not less than
+| 'pB' (lower bound), using a branch-free binary search.
+*----------------------------------------------------------------------------*/
+size_t p8_searchsorted( const posit8_t * a, size_t n, posit8_t pB ){
+	const posit8_t * base = a;
+	int8_t uiB = (int8_t) pB.v;
+
+	if (n==0) return 0;
+	while (n>1){
+		size_t half = n>>1;
+		base = ((int8_t)base[half].v < uiB) ? base+half : base;
+		n -= half;
+	}
+	return (size_t)(base-a) + ((int8_t)base->v < uiB);
+}
+
+void p8_searchsorted_n(
+	const posit8_t * a, size_t n, const posit8_t * b, size_t m, size_t * pos ){
+	for (size_t i=0; i<m; i++)
+		pos[i] = p8_searchsorted(a, n, b[i]);
+}
+
@@ -49,13 +49,20 @@ posit8_t p8_sqrt( posit8_t pA ) {
 						73, 74, 74, 74, 75, 75, 75, 76, 76, 77, 77, 77, 79, 80, 81, 83, 84,
 						85, 86, 87, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 100,
 						101, 102, 103, 105, 108, 110, 112, 114, 115, 120};
+#ifdef SOFTPOSIT_EXACT
+    //Inputs whose square root is exact, one bit per posit
+    static const uint64_t p8SqrtExact [] = {0x0002001002010213, 0x9001000400040001};
+#endif
+    SOFTPOSIT_STAT_OP( sqrt, p8 );
     uA.p = pA;
     uiA = uA.ui;
 
     if (uiA>=0x80){
+    	SOFTPOSIT_STAT_NAR( p8 );
     	uA.ui = 0x80;
     	return uA.p;
     }
+    SOFTPOSIT_RAISE_INEXACT( !((p8SqrtExact[uiA>>6]>>(uiA&63)) & 1) );
     uA.ui = p8Sqrt[uiA];
 
     return uA.p;
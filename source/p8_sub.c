@@ -43,6 +43,7 @@ posit8_t p8_sub( posit8_t a, posit8_t b ){
     uint_fast8_t uiA, uiB;
     union ui8_p8 uZ;
 
+    SOFTPOSIT_STAT_OP( sub, p8 );
     uA.p = a;
 	uiA = uA.ui;
 	uB.p = b;
@@ -50,28 +51,15 @@ posit8_t p8_sub( posit8_t a, posit8_t b ){
 
 
 
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.exact = (uiA.ui.exact & uiB.ui.exact);
-#endif
-
     //infinity
 	if ( uiA==0x80 || uiB==0x80 ){
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = 0x80;
-		uZ.ui.exact = 0;
-#else
+		SOFTPOSIT_STAT_NAR( p8 );
 		uZ.ui = 0x80;
-#endif
 		return uZ.p;
 	}
     //Zero
 	else if ( uiA==0 || uiB==0 ){
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = (uiA | -uiB);
-		uZ.ui.exact = 0;
-#else
 		uZ.ui = (uiA | -uiB);
-#endif
 		return uZ.p;
 	}
 
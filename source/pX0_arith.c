@@ -0,0 +1,108 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Dynamic-width posits with es=0.  All operations go through the shared
+| decode and round core (s_arithPX.c), which handles any width and es, so
+| only the width check and the type wrapping live here.
+*----------------------------------------------------------------------------*/
+#define PX0_RESULT( x, expr ) ({ \
+		union ui32_pX0 uZ; \
+		uZ.ui = ((x)<2 || (x)>32) ? 0x80000000 : (expr); \
+		uZ.p; \
+})
+
+posit_0_t pX0_add( posit_0_t pA, posit_0_t pB, int x ){
+	return PX0_RESULT( x, softposit_addPX( pA.v, pB.v, x, 0 ) );
+}
+
+posit_0_t pX0_sub( posit_0_t pA, posit_0_t pB, int x ){
+	return PX0_RESULT( x, softposit_addPX( pA.v, -pB.v & 0xFFFFFFFF, x, 0 ) );
+}
+
+posit_0_t pX0_mul( posit_0_t pA, posit_0_t pB, int x ){
+	return PX0_RESULT( x, softposit_mulPX( pA.v, pB.v, x, 0 ) );
+}
+
+posit_0_t pX0_div( posit_0_t pA, posit_0_t pB, int x ){
+	return PX0_RESULT( x, softposit_divPX( pA.v, pB.v, x, 0 ) );
+}
+
+posit_0_t pX0_mulAdd( posit_0_t pA, posit_0_t pB, posit_0_t pC, int x ){
+	return PX0_RESULT( x, softposit_mulAddPX( pA.v, pB.v, pC.v, x, 0 ) );
+}
+
+posit_0_t pX0_sqrt( posit_0_t pA, int x ){
+	return PX0_RESULT( x, softposit_sqrtPX( pA.v, x, 0 ) );
+}
+
+posit_0_t pX0_roundToInt( posit_0_t pA, int x ){
+	uint_fast32_t uiA = pA.v;
+
+	if (uiA==0x80000000) return PX0_RESULT( x, uiA );
+	return PX0_RESULT( x, softposit_fromIntPX( uiA>>31, softposit_toIntMagPX( uiA, 0 ), x, 0 ) );
+}
+
+bool pX0_eq( posit_0_t pA, posit_0_t pB ){
+	return pA.v==pB.v;
+}
+
+bool pX0_le( posit_0_t pA, posit_0_t pB ){
+	return (int32_t) pA.v <= (int32_t) pB.v;
+}
+
+bool pX0_lt( posit_0_t pA, posit_0_t pB ){
+	return (int32_t) pA.v < (int32_t) pB.v;
+}
+
+/*----------------------------------------------------------------------------
+| For es=0, flipping the sign bit and shifting right two places gives an
+| approximation of 1/(1+exp(-x)) within a few percent over the whole range
+| (Gustafson's fast sigmoid).  Bits shifted below the width are dropped.
+*----------------------------------------------------------------------------*/
+posit_0_t pX0_sigmoidFast( posit_0_t pA, int x ){
+	uint_fast32_t uiA = pA.v;
+
+	if (uiA==0x80000000) return PX0_RESULT( x, uiA );
+	return PX0_RESULT( x, ((uiA^0x80000000)>>2) & ((int32_t)0x80000000>>(x-1)) );
+}
@@ -0,0 +1,122 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Batch kernels for es=0 posits.  The width is checked once per call and the
+| loops call the shared core directly.
+*----------------------------------------------------------------------------*/
+#define PX0_CHECK_WIDTH( x, z, n ) \
+	if ((x)<2 || (x)>32){ \
+		size_t j; \
+		for (j=0; j<(n); j++) (z)[j].v = 0x80000000; \
+		return; \
+	}
+
+void pX0_add_n( const posit_0_t * a, const posit_0_t * b, size_t n, posit_0_t * z, int x ){
+	size_t i;
+
+	PX0_CHECK_WIDTH( x, z, n );
+	for (i=0; i<n; i++) z[i].v = softposit_addPX( a[i].v, b[i].v, x, 0 );
+}
+
+void pX0_sub_n( const posit_0_t * a, const posit_0_t * b, size_t n, posit_0_t * z, int x ){
+	size_t i;
+
+	PX0_CHECK_WIDTH( x, z, n );
+	for (i=0; i<n; i++) z[i].v = softposit_addPX( a[i].v, -b[i].v & 0xFFFFFFFF, x, 0 );
+}
+
+void pX0_mul_n( const posit_0_t * a, const posit_0_t * b, size_t n, posit_0_t * z, int x ){
+	size_t i;
+
+	PX0_CHECK_WIDTH( x, z, n );
+	for (i=0; i<n; i++) z[i].v = softposit_mulPX( a[i].v, b[i].v, x, 0 );
+}
+
+void pX0_div_n( const posit_0_t * a, const posit_0_t * b, size_t n, posit_0_t * z, int x ){
+	size_t i;
+
+	PX0_CHECK_WIDTH( x, z, n );
+	for (i=0; i<n; i++) z[i].v = softposit_divPX( a[i].v, b[i].v, x, 0 );
+}
+
+void pX0_mulAdd_n( const posit_0_t * a, const posit_0_t * b, const posit_0_t * c, size_t n, posit_0_t * z, int x ){
+	size_t i;
+
+	PX0_CHECK_WIDTH( x, z, n );
+	for (i=0; i<n; i++) z[i].v = softposit_mulAddPX( a[i].v, b[i].v, c[i].v, x, 0 );
+}
+
+void pX0_sqrt_n( const posit_0_t * a, size_t n, posit_0_t * z, int x ){
+	size_t i;
+
+	PX0_CHECK_WIDTH( x, z, n );
+	for (i=0; i<n; i++) z[i].v = softposit_sqrtPX( a[i].v, x, 0 );
+}
+
+//Branch-free, so it vectorises
+void pX0_sigmoidFast_n( const posit_0_t * a, size_t n, posit_0_t * z, int x ){
+	uint32_t mask;
+	size_t i;
+
+	PX0_CHECK_WIDTH( x, z, n );
+	mask = (int32_t)0x80000000>>(x-1);
+	for (i=0; i<n; i++){
+		uint32_t uiA = a[i].v;
+		uint32_t uiZ = ((uiA^0x80000000)>>2) & mask;
+		z[i].v = (uiA==0x80000000) ? uiA : uiZ;
+	}
+}
+
+void convertDoubleToPX0_n( const double * a, size_t n, posit_0_t * z, int x ){
+	size_t i;
+
+	PX0_CHECK_WIDTH( x, z, n );
+	for (i=0; i<n; i++) z[i] = convertDoubleToPX0( a[i], x );
+}
+
+void convertPX0ToDouble_n( const posit_0_t * a, size_t n, double * z ){
+	size_t i;
+
+	for (i=0; i<n; i++) z[i] = convertPX0ToDouble( a[i] );
+}
@@ -0,0 +1,194 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <math.h>
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Conversions to and from es=0 dynamic-width posits.  Fixed-width posits are
+| left-aligned and re-rounded by the shared core, so each pair is one decode
+| and one rounding.  As for the other posit types, the most negative integer
+| maps to NaR and NaR converts to 0 (or to INT64_MIN for pX0_int).
+*----------------------------------------------------------------------------*/
+#define PX0_RESULT( x, expr ) ({ \
+		union ui32_pX0 uZ; \
+		uZ.ui = ((x)<2 || (x)>32) ? 0x80000000 : (expr); \
+		uZ.p; \
+})
+
+posit_0_t ui32_to_pX0( uint32_t a, int x ){
+	return PX0_RESULT( x, softposit_fromIntPX( 0, a, x, 0 ) );
+}
+
+posit_0_t ui64_to_pX0( uint64_t a, int x ){
+	return PX0_RESULT( x, softposit_fromIntPX( 0, a, x, 0 ) );
+}
+
+posit_0_t i32_to_pX0( int32_t a, int x ){
+	if (a==INT32_MIN) return PX0_RESULT( x, 0x80000000 );
+	return PX0_RESULT( x, softposit_fromIntPX( a<0, a<0 ? -(int_fast64_t)a : a, x, 0 ) );
+}
+
+posit_0_t i64_to_pX0( int64_t a, int x ){
+	if (a==INT64_MIN) return PX0_RESULT( x, 0x80000000 );
+	return PX0_RESULT( x, softposit_fromIntPX( a<0, a<0 ? -(uint_fast64_t)a : (uint_fast64_t)a, x, 0 ) );
+}
+
+uint_fast32_t pX0_to_ui32( posit_0_t pA ){
+	uint_fast64_t iZ;
+
+	if (pA.v>=0x80000000) return 0;
+	iZ = softposit_toIntMagPX( pA.v, 0 );
+	return (iZ>UINT32_MAX) ? UINT32_MAX : iZ;
+}
+
+uint_fast64_t pX0_to_ui64( posit_0_t pA ){
+	if (pA.v>=0x80000000) return 0;
+	return softposit_toIntMagPX( pA.v, 0 );
+}
+
+int_fast32_t pX0_to_i32( posit_0_t pA ){
+	uint_fast64_t iZ;
+
+	if (pA.v==0x80000000) return 0;
+	iZ = softposit_toIntMagPX( pA.v, 0 );
+	if (pA.v>>31) return (iZ>0x80000000) ? INT32_MIN : -(int_fast32_t)iZ;
+	return (iZ>INT32_MAX) ? INT32_MAX : (int_fast32_t)iZ;
+}
+
+int_fast64_t pX0_to_i64( posit_0_t pA ){
+	uint_fast64_t iZ;
+
+	if (pA.v==0x80000000) return 0;
+	iZ = softposit_toIntMagPX( pA.v, 0 );
+	if (pA.v>>31) return (iZ>0x8000000000000000ULL) ? INT64_MIN : -(int_fast64_t)iZ;
+	return (iZ>INT64_MAX) ? INT64_MAX : (int_fast64_t)iZ;
+}
+
+//Truncates toward zero
+int64_t pX0_int( posit_0_t pA ){
+	uint_fast64_t sig;
+	int_fast32_t scale;
+	bool sign;
+	int64_t iZ;
+
+	if (pA.v==0x80000000) return INT64_MIN;
+	if (pA.v==0) return 0;
+	scale = softposit_unpackPX( pA.v, 0, &sign, &sig );
+	if (scale<0) return 0;
+	iZ = (scale>=63) ? INT64_MAX : (int64_t) (sig>>(63-scale));
+	return sign ? -iZ : iZ;
+}
+
+posit8_t pX0_to_p8( posit_0_t pA ){
+	union ui8_p8 uZ;
+	uZ.ui = softposit_convertPX( pA.v, 0, 8, 0 )>>24;
+	return uZ.p;
+}
+
+posit16_t pX0_to_p16( posit_0_t pA ){
+	union ui16_p16 uZ;
+	uZ.ui = softposit_convertPX( pA.v, 0, 16, 1 )>>16;
+	return uZ.p;
+}
+
+posit32_t pX0_to_p32( posit_0_t pA ){
+	union ui32_p32 uZ;
+	uZ.ui = softposit_convertPX( pA.v, 0, 32, 2 );
+	return uZ.p;
+}
+
+posit_0_t pX0_to_pX0( posit_0_t pA, int x ){
+	return PX0_RESULT( x, softposit_convertPX( pA.v, 0, x, 0 ) );
+}
+
+posit_1_t pX0_to_pX1( posit_0_t pA, int x ){
+	union ui32_pX1 uZ;
+	uZ.ui = (x<2 || x>32) ? 0x80000000 : softposit_convertPX( pA.v, 0, x, 1 );
+	return uZ.p;
+}
+
+posit_2_t pX0_to_pX2( posit_0_t pA, int x ){
+	union ui32_pX2 uZ;
+	uZ.ui = (x<2 || x>32) ? 0x80000000 : softposit_convertPX( pA.v, 0, x, 2 );
+	return uZ.p;
+}
+
+posit_0_t p8_to_pX0( posit8_t pA, int x ){
+	return PX0_RESULT( x, softposit_convertPX( (uint_fast32_t) pA.v<<24, 0, x, 0 ) );
+}
+
+posit_0_t p16_to_pX0( posit16_t pA, int x ){
+	return PX0_RESULT( x, softposit_convertPX( (uint_fast32_t) pA.v<<16, 1, x, 0 ) );
+}
+
+posit_0_t p32_to_pX0( posit32_t pA, int x ){
+	return PX0_RESULT( x, softposit_convertPX( pA.v, 2, x, 0 ) );
+}
+
+posit_0_t pX1_to_pX0( posit_1_t pA, int x ){
+	return PX0_RESULT( x, softposit_convertPX( pA.v, 1, x, 0 ) );
+}
+
+posit_0_t pX2_to_pX0( posit_2_t pA, int x ){
+	return PX0_RESULT( x, softposit_convertPX( pA.v, 2, x, 0 ) );
+}
+
+posit_0_t convertDoubleToPX0( double a, int x ){
+	int e;
+
+	if (isnan(a) || isinf(a)) return PX0_RESULT( x, 0x80000000 );
+	if (a==0) return PX0_RESULT( x, 0 );
+	a = frexp( a, &e );
+	return PX0_RESULT( x, softposit_packPX( a<0, e-1, (uint_fast64_t) ldexp( fabs(a), 64 ), false, x, 0 ) );
+}
+
+double convertPX0ToDouble( posit_0_t pA ){
+	uint_fast64_t sig;
+	int_fast32_t scale;
+	bool sign;
+
+	if (pA.v==0) return 0;
+	if (pA.v==0x80000000) return NAN;
+	scale = softposit_unpackPX( pA.v, 0, &sign, &sig );
+	return ldexp( sign ? -(double) sig : (double) sig, scale-63 );
+}
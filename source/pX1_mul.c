@@ -64,31 +64,14 @@ posit_1_t pX1_mul( posit_1_t pA, posit_1_t pB, int x ){
 	uB.p = pB;
 	uiB = uB.ui;
 
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.exact = (uiA.ui.exact & uiB.ui.exact);
-#endif
 	//NaR or Zero
 	if ( uiA==0x80000000 || uiB==0x80000000 ){
 
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = 0x80000000;
-		uZ.ui.exact = 0;
-#else
 		uZ.ui = 0x80000000;
-#endif
 		return uZ.p;
 	}
 	else if (uiA==0 || uiB==0){
-#ifdef SOFTPOSIT_EXACT
-
-		uZ.ui.v = 0;
-		if ( (uiA==0 && uiA.ui.exact) || (uiB==0 && uiB.ui.exact) )
-			uZ.ui.exact = 1;
-		else
-			uZ.ui.exact = 0;
-#else
 		uZ.ui = 0;
-#endif
 		return uZ.p;
 	}
 
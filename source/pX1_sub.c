@@ -51,28 +51,14 @@ posit_1_t pX1_sub( posit_1_t a, posit_1_t b, int x) {
 	uB.p = b;
 	uiB = uB.ui;
 
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.exact = (uiA.ui.exact & uiB.ui.exact);
-#endif
-
 	//infinity
 	if ( uiA==0x80000000 || uiB==0x80000000 ){
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = 0x80000000;
-		uZ.ui.exact = 0;
-#else
 		uZ.ui = 0x80000000;
-#endif
 		return uZ.p;
 	}
 	//Zero
 	else if ( uiA==0 || uiB==0 ){
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = (uiA | -uiB);
-		uZ.ui.exact = 0;
-#else
 		uZ.ui = (uiA | -uiB);
-#endif
 		return uZ.p;
 	}
 
@@ -65,25 +65,11 @@ posit_2_t pX2_div( posit_2_t pA, posit_2_t pB, int x ) {
 
 	//Zero or infinity
 	if ( uiA==0x80000000 || uiB==0x80000000 || uiB==0){
-#ifdef SOFTPOSIT_EXACT
-		uZ.ui.v = 0x80000000;
-		uZ.ui.exact = 0;
-#else
 		uZ.ui = 0x80000000;
-#endif
 		return uZ.p;
 	}
 	else if (uiA==0){
-#ifdef SOFTPOSIT_EXACT
-
-		uZ.ui.v = 0;
-		if ( (uiA==0 && uiA.ui.exact) || (uiB==0 && uiB.ui.exact) )
-			uZ.ui.exact = 1;
-		else
-			uZ.ui.exact = 0;
-#else
 		uZ.ui = 0;
-#endif
 		return uZ.p;
 	}
 
@@ -0,0 +1,119 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| quire64 is 1024 bits, v[0] most significant, in two's complement with the
+| binary point 496 bits from the right: minpos squared is the last bit and
+| maxpos squared leaves 30 carry bits below the sign.  NaR is the sign bit
+| alone.
+*----------------------------------------------------------------------------*/
+static quire64_t softposit_fdpQ64( quire64_t q, posit64_t pA, posit64_t pB, bool negate ){
+	union ui64_p64 uA, uB;
+	uint_fast64_t uiA, uiB, sigA, sigB, w[16] = { 0 }, lo, hi, carry;
+	unsigned __int128 prod;
+	int_fast32_t pos;
+	int i, b;
+	bool sign;
+
+	uA.p = pA;
+	uiA = uA.ui;
+	uB.p = pB;
+	uiB = uB.ui;
+
+	if (isNaRQ64( q )) return q;
+	if (isNaRP64UI( uiA ) || isNaRP64UI( uiB )){
+		q = q64Clr();
+		q.v[0] = 0x8000000000000000ULL;
+		return q;
+	}
+	if (uiA==0 || uiB==0) return q;
+
+	sign = signP64UI( uiA ^ uiB ) ^ negate;
+	if (signP64UI( uiA )) uiA = -uiA;
+	if (signP64UI( uiB )) uiB = -uiB;
+	pos = softposit_decodeMagPX( uiA, 2, &sigA ) + softposit_decodeMagPX( uiB, 2, &sigB ) + 496 - 118;
+
+	//At most 60 significant bits each, so the 120-bit product is exact; the
+	//bits dropped for products near minpos squared are all zero
+	prod = (unsigned __int128) (sigA>>4) * (sigB>>4);
+	if (pos<0){
+		prod >>= -pos;
+		pos = 0;
+	}
+	lo = (uint_fast64_t) prod;
+	hi = (uint_fast64_t) (prod>>64);
+	i = 15 - (pos>>6);
+	b = pos & 63;
+	w[i] = lo<<b;
+	w[i-1] = (b ? lo>>(64-b) : 0) | hi<<b;
+	if (b) w[i-2] = hi>>(64-b);
+
+	carry = sign;
+	for (i=15; i>=0; i--){
+		uint_fast64_t term = sign ? ~w[i] : w[i];
+		uint_fast64_t sum = q.v[i] + term;
+		uint_fast64_t next = sum < q.v[i];
+		q.v[i] = sum + carry;
+		carry = next | (q.v[i] < sum);
+	}
+	return q;
+}
+
+quire64_t q64_fdp_add( quire64_t q, posit64_t pA, posit64_t pB ){
+	return softposit_fdpQ64( q, pA, pB, false );
+}
+
+quire64_t q64_fdp_sub( quire64_t q, posit64_t pA, posit64_t pB ){
+	return softposit_fdpQ64( q, pA, pB, true );
+}
+
+quire64_t q64_TwosComplement( quire64_t q ){
+	uint_fast64_t carry = 1;
+	int i;
+
+	for (i=15; i>=0; i--){
+		q.v[i] = ~q.v[i] + carry;
+		carry = carry && !q.v[i];
+	}
+	return q;
+}
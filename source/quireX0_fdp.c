@@ -0,0 +1,177 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| The es=0 quire is a 512-bit two's complement fixed-point number, most
+| significant word first, with its lowest bit worth 2^-64.  Products of two
+| es=0 posits of up to 32 bits lie between 2^-60 and 2^62, so each one fits
+| exactly in the bottom 128 bits and only carries reach the upper words.
+*----------------------------------------------------------------------------*/
+
+//|A*B| in quire units for nonzero, non-NaR A and B
+static inline unsigned __int128 qX0_product( uint_fast32_t uiA, uint_fast32_t uiB, bool * sign ){
+	uint_fast64_t sigA, sigB, sigP;
+	int_fast32_t shift;
+	bool signA, signB;
+
+	shift = softposit_unpackPX( uiA, 0, &signA, &sigA );
+	shift += softposit_unpackPX( uiB, 0, &signB, &sigB ) + 2;
+	*sign = signA^signB;
+	sigP = (sigA>>32) * (sigB>>32);
+	return (shift>=0) ? (unsigned __int128) sigP<<shift : sigP>>-shift;
+}
+
+//Adds the 192-bit signed value hi:lo to the quire
+static inline quire_0_t qX0_addWide( quire_0_t q, unsigned __int128 lo, int64_t hi ){
+	unsigned __int128 low = ((unsigned __int128) q.v[6]<<64) | q.v[7], sum;
+	uint_fast64_t ext = (hi<0) ? ~0ULL : 0;
+	int i;
+
+	sum = low + lo;
+	q.v[6] = (uint64_t) (sum>>64);
+	q.v[7] = (uint64_t) sum;
+	sum = (unsigned __int128) q.v[5] + (uint64_t) hi + (sum<low);
+	q.v[5] = (uint64_t) sum;
+	for (i=4; i>=0; i--){
+		sum = (unsigned __int128) q.v[i] + ext + (uint64_t) (sum>>64);
+		q.v[i] = (uint64_t) sum;
+	}
+	return q;
+}
+
+static inline quire_0_t qX0_NaR( void ){
+	quire_0_t q = qX0Clr();
+	q.v[0] = 0x8000000000000000ULL;
+	return q;
+}
+
+static inline quire_0_t qX0_fdp( quire_0_t q, uint_fast32_t uiA, uint_fast32_t uiB, bool negate ){
+	unsigned __int128 prod;
+	bool sign;
+
+	if (isNaRqX0(q)) return q;
+	if (uiA==0x80000000 || uiB==0x80000000) return qX0_NaR();
+	if (uiA==0 || uiB==0) return q;
+
+	prod = qX0_product( uiA, uiB, &sign );
+	return (sign^negate) ? qX0_addWide( q, -prod, -1 ) : qX0_addWide( q, prod, 0 );
+}
+
+quire_0_t qX0_fdp_add( quire_0_t q, posit_0_t pA, posit_0_t pB ){
+	return qX0_fdp( q, pA.v, pB.v, 0 );
+}
+
+quire_0_t qX0_fdp_sub( quire_0_t q, posit_0_t pA, posit_0_t pB ){
+	return qX0_fdp( q, pA.v, pB.v, 1 );
+}
+
+/*----------------------------------------------------------------------------
+| Accumulates a whole dot product into a local 192-bit sum, which cannot
+| overflow for any realistic n, and touches the quire once at the end.
+*----------------------------------------------------------------------------*/
+quire_0_t qX0_fdp_add_n( quire_0_t q, const posit_0_t * a, const posit_0_t * b, size_t n ){
+	unsigned __int128 lo = 0, prod;
+	int64_t hi = 0;
+	size_t i;
+	bool sign;
+
+	if (isNaRqX0(q)) return q;
+	for (i=0; i<n; i++){
+		uint_fast32_t uiA = a[i].v, uiB = b[i].v;
+		if (uiA==0x80000000 || uiB==0x80000000) return qX0_NaR();
+		if (uiA==0 || uiB==0) continue;
+		prod = qX0_product( uiA, uiB, &sign );
+		if (sign){
+			hi -= (lo<prod);
+			lo -= prod;
+		}
+		else{
+			lo += prod;
+			hi += (lo<prod);
+		}
+	}
+	return qX0_addWide( q, lo, hi );
+}
+
+quire_0_t qX0_TwosComplement( quire_0_t q ){
+	int i;
+	bool carry = 1;
+
+	for (i=7; i>=0; i--){
+		q.v[i] = ~q.v[i] + carry;
+		carry &= (q.v[i]==0);
+	}
+	return q;
+}
+
+posit_0_t qX0_to_pX0( quire_0_t q, int x ){
+	union ui32_pX0 uZ;
+	uint_fast64_t sig;
+	bool sign, sticky = 0;
+	int i, j, lz;
+
+	if (x<2 || x>32 || isNaRqX0(q)){
+		uZ.ui = 0x80000000;
+		return uZ.p;
+	}
+	sign = q.v[0]>>63;
+	if (sign) q = qX0_TwosComplement(q);
+	for (i=0; i<8 && q.v[i]==0; i++);
+	if (i==8){
+		uZ.ui = 0;
+		return uZ.p;
+	}
+	lz = __builtin_clzll(q.v[i]);
+	sig = q.v[i]<<lz;
+	if (i<7){
+		if (lz) sig |= q.v[i+1]>>(64-lz);
+		sticky = (q.v[i+1]<<lz)!=0;
+		for (j=i+2; j<8; j++) sticky |= q.v[j]!=0;
+	}
+	uZ.ui = softposit_packPX( sign, (7-i)*64 + 63 - lz - 64, sig, sticky, x, 0 );
+	return uZ.p;
+}
+
+posit_0_t pX0_dot_n( const posit_0_t * a, const posit_0_t * b, size_t n, int x ){
+	return qX0_to_pX0( qX0_fdp_add_n( qX0Clr(), a, b, n ), x );
+}
@@ -46,11 +46,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "stdlib.h"
 #include <math.h>
 
-#ifdef SOFTPOSIT_EXACT
-posit16_t softposit_addMagsP16( uint_fast16_t uiA, uint_fast16_t uiB, bool isExact){
-#else
 posit16_t softposit_addMagsP16( uint_fast16_t uiA, uint_fast16_t uiB ){
-#endif
 
 	uint_fast16_t regA, uiX, uiY;
 	uint_fast32_t frac32A, frac32B;
@@ -120,9 +116,11 @@ posit16_t softposit_addMagsP16( uint_fast16_t uiA, uint_fast16_t uiB ){
 		//rcarry is one
 		if (expA) kA ++;
 		expA^=1;
+		if (frac32A&0x1) bitsMore=1;
 		frac32A>>=1;
 	}
 	else{
+		if (shiftRight>31 || (frac32B & ((1<<shiftRight)-1))) bitsMore=1;
 		//Manage CLANG (LLVM) compiler when shifting right more than number of bits
 		(shiftRight>31) ? (frac32B=0): (frac32B >>= shiftRight); //frac32B >>= shiftRight
 
@@ -131,6 +129,7 @@ posit16_t softposit_addMagsP16( uint_fast16_t uiA, uint_fast16_t uiB ){
 		if(rcarry){
 			if (expA) kA ++;
 			expA^=1;
+			if (frac32A&0x1) bitsMore=1;
 			frac32A>>=1;
 		}
 	}
@@ -147,9 +146,11 @@ posit16_t softposit_addMagsP16( uint_fast16_t uiA, uint_fast16_t uiB ){
 	if(regA>14){
 		//max or min pos. exp and frac does not matter.
 		(regSA) ? (uZ.ui= 0x7FFF): (uZ.ui=0x1);
+		SOFTPOSIT_SATURATED( p16, regSA, !regSA || regA>15 || expA || (frac32A&0x3FFFFFFF) || bitsMore );
 	}
 	else{
 		//remove hidden bits
+		if (frac32A & ((1<<(regA+1))-1)) bitsMore=1;
 		frac32A = (frac32A & 0x3FFFFFFF) >>(regA + 1) ;
 		fracA = frac32A>>16;
 		if (regA!=14) bitNPlusOne = (frac32A>>15) & 0x1;
@@ -159,6 +160,7 @@ posit16_t softposit_addMagsP16( uint_fast16_t uiA, uint_fast16_t uiB ){
 		}
 		if (regA==14 && expA) bitNPlusOne = 1;
 		uZ.ui = packToP16UI(regime, regA, expA, fracA);
+		SOFTPOSIT_ROUNDED( p16, bitNPlusOne, bitsMore || (frac32A & 0x7FFF), uZ.ui&1 );
 		if (bitNPlusOne){
 			if ( frac32A&0x7FFF ) bitsMore=1;
 			 //n+1 frac bit is 1. Need to check if another bit is 1 too if not round to even
@@ -105,6 +105,7 @@ posit32_t softposit_addMagsP32( uint_fast32_t uiA, uint_fast32_t uiB ) {
 	//This is 4kZ + expZ; (where kZ=kA-kB and expZ=expA-expB)
 	shiftRight = (shiftRight<<2) + expA - (tmp>>29);
 
+	if (shiftRight>63 || (frac64B & ((1ULL<<shiftRight)-1))) bitsMore=1;
 	//Manage CLANG (LLVM) compiler when shifting right more than number of bits
 	(shiftRight>63) ? (frac64B=0): (frac64B >>= shiftRight); //frac64B >>= shiftRight
 
@@ -117,6 +118,7 @@ posit32_t softposit_addMagsP32( uint_fast32_t uiA, uint_fast32_t uiB ) {
 			kA ++;
 			expA&=0x3;
 		}
+		if (frac64A&0x1) bitsMore=1;
 		frac64A>>=1;
 	}
 	if(kA<0){
@@ -133,9 +135,11 @@ posit32_t softposit_addMagsP32( uint_fast32_t uiA, uint_fast32_t uiB ) {
 	if(regA>30){
 		//max or min pos. exp and frac does not matter.
 		(regSA) ? (uZ.ui= 0x7FFFFFFF): (uZ.ui=0x1);
+		SOFTPOSIT_SATURATED( p32, regSA, !regSA || regA>31 || expA || (frac64A&0x3FFFFFFFFFFFFFFF) || bitsMore );
 	}
 	else{
 		//remove hidden bits
+		if (frac64A & ((1ULL<<(regA+2))-1)) bitsMore=1;
 		frac64A = (frac64A & 0x3FFFFFFFFFFFFFFF) >>(regA + 2) ; // 2 bits exp
 
 		fracA = frac64A>>32;
@@ -147,20 +151,21 @@ posit32_t softposit_addMagsP32( uint_fast32_t uiA, uint_fast32_t uiB ) {
 		else {
 			if (regA==30){
 				bitNPlusOne = expA&0x2;
-				bitsMore = (expA&0x1);
+				bitsMore |= (expA&0x1);
 				expA = 0;
 			}
 			else if (regA==29){
 				bitNPlusOne = expA&0x1;
 				expA>>=1;
 			}
-			if (fracA>0){
+			if (frac64A>0){
 				fracA=0;
 				bitsMore =1;
 			}
 		}
 
 		uZ.ui = packToP32UI(regime, expA, fracA);
+		SOFTPOSIT_ROUNDED( p32, bitNPlusOne, bitsMore || (0x7FFFFFFF & frac64A), uZ.ui&1 );
 		//n+1 frac bit is 1. Need to check if another bit is 1 too if not round to even
 		if (bitNPlusOne){
 			if (0x7FFFFFFF & frac64A) bitsMore=1;
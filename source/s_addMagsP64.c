@@ -0,0 +1,88 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include "platform.h"
+#include "internals.h"
+
+//Both operands carry the same sign; significands are lined up in 128 bits,
+//which holds the whole of the smaller one for any exponent gap up to 67
+posit64_t softposit_addMagsP64( uint_fast64_t uiA, uint_fast64_t uiB ){
+	union ui64_p64 uZ;
+	uint_fast64_t sigA, sigB;
+	unsigned __int128 sum, lost;
+	int_fast32_t scaleA, scaleB, shiftRight;
+	bool sign, sticky;
+
+	sign = signP64UI( uiA );
+	if (sign){
+		uiA = -uiA;
+		uiB = -uiB;
+	}
+	if (uiA<uiB){
+		uiA ^= uiB;
+		uiB ^= uiA;
+		uiA ^= uiB;
+	}
+	scaleA = softposit_decodeMagPX( uiA, 2, &sigA );
+	scaleB = softposit_decodeMagPX( uiB, 2, &sigB );
+
+	//Hidden bit of A at 126 leaves room for the carry
+	sum = (unsigned __int128) sigA << 63;
+	shiftRight = scaleA - scaleB;
+	if (shiftRight>126){
+		sticky = 1;
+	}
+	else{
+		lost = (unsigned __int128) sigB << 63;
+		sticky = (lost << (128-shiftRight-1) << 1) != 0;
+		sum += lost >> shiftRight;
+	}
+	if (sum >> 127){
+		scaleA++;
+		sticky |= (uint_fast64_t) sum != 0;
+		uZ.ui = softposit_roundPackMagPXAt( scaleA, (uint_fast64_t) (sum>>64), sticky, 64, 2, softposit_stat_p64 );
+	}
+	else{
+		sticky |= (uint_fast64_t) (sum<<1) != 0;
+		uZ.ui = softposit_roundPackMagPXAt( scaleA, (uint_fast64_t) (sum>>63), sticky, 64, 2, softposit_stat_p64 );
+	}
+	if (sign) uZ.ui = -uZ.ui;
+	return uZ.p;
+}
@@ -37,11 +37,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "platform.h"
 #include "internals.h"
 
-#ifdef SOFTPOSIT_EXACT
-posit8_t softposit_addMagsP8( uint_fast8_t uiA, uint_fast8_t uiB, bool isExact){
-#else
 posit8_t softposit_addMagsP8( uint_fast8_t uiA, uint_fast8_t uiB ){
-#endif
 
 	uint_fast8_t regA;
 	uint_fast16_t frac16A, frac16B;
@@ -100,6 +96,7 @@ posit8_t softposit_addMagsP8( uint_fast8_t uiA, uint_fast8_t uiB ){
 	}
 	frac16B = (0x80 | tmp) <<7 ;
 
+	if (shiftRight>7) bitsMore=1;
 	//Manage CLANG (LLVM) compiler when shifting right more than number of bits
 	(shiftRight>7) ? (frac16B=0): (frac16B >>= shiftRight); //frac32B >>= shiftRight
 
@@ -108,6 +105,7 @@ posit8_t softposit_addMagsP8( uint_fast8_t uiA, uint_fast8_t uiB ){
 	rcarry = 0x8000 & frac16A; //first left bit
 	if (rcarry){
 		kA++;
+		if (frac16A&0x1) bitsMore=1;
 		frac16A>>=1;
 	}
 
@@ -125,13 +123,16 @@ posit8_t softposit_addMagsP8( uint_fast8_t uiA, uint_fast8_t uiB ){
 	if(regA>6){
 		//max or min pos. exp and frac does not matter.
 		(regSA) ? (uZ.ui= 0x7F): (uZ.ui=0x1);
+		SOFTPOSIT_SATURATED( p8, regSA, !regSA || regA>7 || (frac16A&0x3FFF) || bitsMore );
 	}
 	else{
+		if (frac16A & ((1<<regA)-1)) bitsMore=1;
 		frac16A = (frac16A&0x3FFF) >> regA;
 		fracA = (uint_fast8_t) (frac16A>>8);
 		bitNPlusOne = (0x80 & frac16A) ;
 		uZ.ui = packToP8UI(regime, fracA);
 
+		SOFTPOSIT_ROUNDED( p8, bitNPlusOne, bitsMore || (0x7F & frac16A), uZ.ui&1 );
 		//n+1 frac bit is 1. Need to check if another bit is 1 too if not round to even
 		if (bitNPlusOne){
 			if (0x7F & frac16A) bitsMore=1;
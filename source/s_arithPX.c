@@ -0,0 +1,219 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <math.h>
+
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Adds two unpacked values whose significands hold the hidden bit at bit 125
+| of 128, leaving two bits of headroom for the carry.  Bits shifted out of
+| the smaller operand are jammed into its lowest bit; with at least 60 guard
+| bits below any posit32 rounding position that keeps the rounding exact.
+*----------------------------------------------------------------------------*/
+static uint_fast32_t softposit_addSigsPX(
+	bool signA, int_fast32_t scaleA, unsigned __int128 sigA,
+	bool signB, int_fast32_t scaleB, unsigned __int128 sigB, int nbits, int es ){
+
+	unsigned __int128 sigZ;
+	int_fast32_t shift;
+	uint_fast64_t hi;
+	int lz;
+
+	if (scaleA<scaleB || (scaleA==scaleB && sigA<sigB)){
+		bool sign = signA; signA = signB; signB = sign;
+		shift = scaleA; scaleA = scaleB; scaleB = shift;
+		sigZ = sigA; sigA = sigB; sigB = sigZ;
+	}
+	shift = scaleA-scaleB;
+	if (shift>=126) sigB = 1;
+	else if (shift) sigB = (sigB>>shift) | ((sigB<<(128-shift))!=0);
+
+	sigZ = (signA==signB) ? sigA+sigB : sigA-sigB;
+	if (sigZ==0) return 0;
+
+	hi = (uint_fast64_t) (sigZ>>64);
+	lz = hi ? __builtin_clzll(hi) : 64 + __builtin_clzll((uint64_t) sigZ);
+	sigZ <<= lz;
+	return softposit_packPX( signA, scaleA+2-lz, (uint_fast64_t) (sigZ>>64), (uint64_t) sigZ!=0, nbits, es );
+}
+
+uint_fast32_t softposit_addPX( uint_fast32_t uiA, uint_fast32_t uiB, int nbits, int es ){
+	uint_fast64_t sigA, sigB;
+	int_fast32_t scaleA, scaleB;
+	bool signA, signB;
+
+	SOFTPOSIT_STAT_OP( add, pX );
+	if (uiA==0x80000000 || uiB==0x80000000){
+		SOFTPOSIT_STAT_NAR( pX );
+		return 0x80000000;
+	}
+	if (uiA==0) return uiB;
+	if (uiB==0) return uiA;
+
+	scaleA = softposit_unpackPX( uiA, es, &signA, &sigA );
+	scaleB = softposit_unpackPX( uiB, es, &signB, &sigB );
+	return softposit_addSigsPX( signA, scaleA, (unsigned __int128) sigA<<62,
+			signB, scaleB, (unsigned __int128) sigB<<62, nbits, es );
+}
+
+//Multiplies two nonzero, non-NaR posits
+static uint_fast32_t softposit_mulSigsPX( uint_fast32_t uiA, uint_fast32_t uiB, int nbits, int es ){
+	uint_fast64_t sigA, sigB;
+	int_fast32_t scaleZ;
+	unsigned __int128 sigZ;
+	bool signA, signB;
+
+	scaleZ = softposit_unpackPX( uiA, es, &signA, &sigA );
+	scaleZ += softposit_unpackPX( uiB, es, &signB, &sigB );
+	sigZ = (unsigned __int128) sigA * sigB;
+	if (sigZ>>127) scaleZ++;
+	else sigZ <<= 1;
+	return softposit_packPX( signA^signB, scaleZ, (uint_fast64_t) (sigZ>>64), (uint64_t) sigZ!=0, nbits, es );
+}
+
+uint_fast32_t softposit_mulPX( uint_fast32_t uiA, uint_fast32_t uiB, int nbits, int es ){
+	SOFTPOSIT_STAT_OP( mul, pX );
+	if (uiA==0x80000000 || uiB==0x80000000){
+		SOFTPOSIT_STAT_NAR( pX );
+		return 0x80000000;
+	}
+	if (uiA==0 || uiB==0) return 0;
+	return softposit_mulSigsPX( uiA, uiB, nbits, es );
+}
+
+/*----------------------------------------------------------------------------
+| A significand decoded from 32 bits has at most 31 significant bits, so the
+| divisor fits in 32 bits and one 64-by-32-bit division gives at least 32
+| quotient bits; the remainder supplies the sticky bit.
+*----------------------------------------------------------------------------*/
+uint_fast32_t softposit_divPX( uint_fast32_t uiA, uint_fast32_t uiB, int nbits, int es ){
+	uint_fast64_t sigA, sigB, sigZ;
+	int_fast32_t scaleZ;
+	bool signA, signB;
+	int lz;
+
+	SOFTPOSIT_STAT_OP( div, pX );
+	if (uiA==0x80000000 || uiB==0x80000000 || uiB==0){
+		SOFTPOSIT_STAT_NAR( pX );
+		return 0x80000000;
+	}
+	if (uiA==0) return 0;
+
+	scaleZ = softposit_unpackPX( uiA, es, &signA, &sigA );
+	scaleZ -= softposit_unpackPX( uiB, es, &signB, &sigB );
+	sigB >>= 32;
+	sigZ = sigA / sigB;
+	lz = __builtin_clzll(sigZ);
+	return softposit_packPX( signA^signB, scaleZ+31-lz, sigZ<<lz, sigA%sigB!=0, nbits, es );
+}
+
+uint_fast32_t softposit_mulAddPX( uint_fast32_t uiA, uint_fast32_t uiB, uint_fast32_t uiC, int nbits, int es ){
+	uint_fast64_t sigA, sigB, sigC;
+	int_fast32_t scaleP, scaleC;
+	unsigned __int128 sigP;
+	bool signA, signB, signC;
+
+	SOFTPOSIT_STAT_OP( mulAdd, pX );
+	if (uiA==0x80000000 || uiB==0x80000000 || uiC==0x80000000){
+		SOFTPOSIT_STAT_NAR( pX );
+		return 0x80000000;
+	}
+	if (uiA==0 || uiB==0) return uiC;
+	if (uiC==0) return softposit_mulSigsPX( uiA, uiB, nbits, es );
+
+	scaleP = softposit_unpackPX( uiA, es, &signA, &sigA );
+	scaleP += softposit_unpackPX( uiB, es, &signB, &sigB );
+	scaleC = softposit_unpackPX( uiC, es, &signC, &sigC );
+	//The product is exact and its low 66 bits are clear, so moving the
+	//hidden bit down to bit 125 loses nothing
+	sigP = (unsigned __int128) sigA * sigB;
+	if (sigP>>127){
+		scaleP++;
+		sigP >>= 2;
+	}
+	else sigP >>= 1;
+	return softposit_addSigsPX( signA^signB, scaleP, sigP,
+			signC, scaleC, (unsigned __int128) sigC<<62, nbits, es );
+}
+
+/*----------------------------------------------------------------------------
+| The significand is brought to [2^62, 2^64) with an even scale, so its
+| 32-bit integer square root carries the result's hidden bit at bit 31.
+*----------------------------------------------------------------------------*/
+uint_fast32_t softposit_sqrtPX( uint_fast32_t uiA, int nbits, int es ){
+	uint_fast64_t sig, root;
+	int_fast32_t scale;
+	bool sign;
+
+	SOFTPOSIT_STAT_OP( sqrt, pX );
+	if (uiA & 0x80000000){
+		SOFTPOSIT_STAT_NAR( pX );
+		return 0x80000000;
+	}
+	if (uiA==0) return 0;
+
+	scale = softposit_unpackPX( uiA, es, &sign, &sig );
+	if (!(scale & 1)) sig >>= 1;
+	root = (uint_fast64_t) sqrt( (double) sig );
+	while (root*root > sig) root--;
+	while (root<0xFFFFFFFF && (root+1)*(root+1) <= sig) root++;
+	return softposit_packPX( 0, scale>>1, root<<32, root*root!=sig, nbits, es );
+}
+
+uint_fast32_t softposit_fromIntPX( bool sign, uint_fast64_t a, int nbits, int es ){
+	int lz;
+
+	if (a==0) return 0;
+	lz = __builtin_clzll(a);
+	return softposit_packPX( sign, 63-lz, a<<lz, false, nbits, es );
+}
+
+//Magnitude rounded to the nearest integer, ties to even; saturates
+uint_fast64_t softposit_toIntMagPX( uint_fast32_t uiA, int es ){
+	uint_fast64_t sig;
+	int_fast32_t scale;
+	bool sign;
+
+	if (uiA==0 || uiA==0x80000000) return 0;
+	scale = softposit_unpackPX( uiA, es, &sign, &sig );
+	return softposit_roundSigToInt( scale, sig );
+}
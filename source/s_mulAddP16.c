@@ -57,6 +57,7 @@ posit16_t softposit_mulAddP16( uint_fast16_t uiA, uint_fast16_t uiB, uint_fast16
 
 	//NaR
 	if ( uiA==0x8000 || uiB==0x8000  || uiC==0x8000 ){
+		SOFTPOSIT_STAT_NAR( p16 );
 		uZ.ui = 0x8000;
 		return uZ.p;
 	}
@@ -249,6 +250,7 @@ posit16_t softposit_mulAddP16( uint_fast16_t uiA, uint_fast16_t uiB, uint_fast16
 	if(regZ>14){
 		//max or min pos. exp and frac does not matter.
 		(regSZ) ? (uZ.ui= 0x7FFF): (uZ.ui=0x1);
+		SOFTPOSIT_SATURATED( p16, regSZ, !regSZ || regZ>15 || expZ || (frac32Z&0x3FFFFFFF) || bitsMore );
 	}
 	else{
 		//remove hidden bits
@@ -262,6 +264,7 @@ posit16_t softposit_mulAddP16( uint_fast16_t uiA, uint_fast16_t uiB, uint_fast16
 		}
 		if (regZ==14 && expZ) bitNPlusOne = 1;
 		uZ.ui = packToP16UI(regime, regZ, expZ, fracZ);
+		SOFTPOSIT_ROUNDED( p16, bitNPlusOne, bitsMore || ((frac32Z<<(16-regZ)) & 0xFFFFFFFF), uZ.ui&1 );
 		if (bitNPlusOne){
 			if ( (frac32Z<<(16-regZ)) &0xFFFFFFFF  ) bitsMore =1;
 			uZ.ui += (uZ.ui&1) | bitsMore;
@@ -56,6 +56,7 @@ posit32_t
 
 	//NaR
 	if ( uiA==0x80000000 || uiB==0x80000000  || uiC==0x80000000 ){
+		SOFTPOSIT_STAT_NAR( p32 );
 		uZ.ui = 0x80000000;
 		return uZ.p;
 	}
@@ -215,6 +216,7 @@ posit32_t
 				kZ++;
 				expZ&=0x3;
 			}
+			if (frac64Z&0x1) bitsMore = 1;
 			frac64Z=(frac64Z>>1)&0x7FFFFFFFFFFFFFFF;
 		}
 		else {
@@ -254,6 +256,7 @@ posit32_t
 	if(regZ>30){
 		//max or min pos. exp and frac does not matter.
 		(regSZ) ? (uZ.ui= 0x7FFFFFFF): (uZ.ui=0x1);
+		SOFTPOSIT_SATURATED( p32, regSZ, !regSZ || regZ>31 || expZ || (frac64Z&0x3FFFFFFFFFFFFFFF) || bitsMore );
 	}
 	else{
 
@@ -262,30 +265,26 @@ posit32_t
 			frac64Z &= 0x3FFFFFFFFFFFFFFF;
 			fracZ = frac64Z >> (regZ + 34);//frac32Z>>16;
 			bitNPlusOne |= (0x200000000 & (frac64Z >>regZ ) ) ;
+			if (frac64Z<<(31-regZ)) bitsMore =1;
 			expZ <<= (28-regZ);
 		}
 		else {
 			if (regZ==30){
 				bitNPlusOne = expZ&0x2;
-				bitsMore = (expZ&0x1);
+				bitsMore |= (expZ&0x1);
 				expZ = 0;
 			}
 			else if (regZ==29){
 				bitNPlusOne = expZ&0x1;
 				expZ>>=1;
 			}
-			if (fracZ>0){
-				fracZ=0;
-				bitsMore =1;
-
-			}
+			fracZ=0;
+			if (frac64Z & 0x3FFFFFFFFFFFFFFF) bitsMore =1;
 		}
 		uZ.ui = packToP32UI(regime, expZ, fracZ);
 
-		if (bitNPlusOne){
-			if ( (frac64Z<<(32-regZ)) &0xFFFFFFFFFFFFFFFF  ) bitsMore =1;
-			uZ.ui += (uZ.ui&1) | bitsMore;
-		}
+		SOFTPOSIT_ROUNDED( p32, bitNPlusOne, bitsMore, uZ.ui&1 );
+		if (bitNPlusOne) uZ.ui += (uZ.ui&1) | bitsMore;
 
 	}
 	if (signZ) uZ.ui = -uZ.ui & 0xFFFFFFFFFFFFFFFF;
@@ -0,0 +1,61 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include "platform.h"
+#include "internals.h"
+
+//The product is exact in 120 bits, so the sum is formed in a quire64 and
+//rounded once
+posit64_t softposit_mulAddP64(
+	uint_fast64_t uiA, uint_fast64_t uiB, uint_fast64_t uiC, uint_fast64_t op ){
+
+	union ui64_p64 uA, uB, uC, uOne;
+	quire64_t q = q64Clr();
+
+	uA.ui = uiA;
+	uB.ui = uiB;
+	uC.ui = uiC;
+	uOne.ui = 0x4000000000000000;
+	if (uiA==0x8000000000000000 || uiB==0x8000000000000000 || uiC==0x8000000000000000) SOFTPOSIT_STAT_NAR( p64 );
+
+	q = (op == softposit_mulAdd_subProd) ? q64_fdp_sub( q, uA.p, uB.p ) : q64_fdp_add( q, uA.p, uB.p );
+	q = (op == softposit_mulAdd_subC) ? q64_fdp_sub( q, uC.p, uOne.p ) : q64_fdp_add( q, uC.p, uOne.p );
+	return softposit_roundQ64ToP64( q, softposit_stat_p64 );
+}
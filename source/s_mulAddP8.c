@@ -50,6 +50,7 @@ posit8_t softposit_mulAddP8( uint_fast8_t uiA, uint_fast8_t uiB, uint_fast8_t ui
 
 	//NaR
 	if ( uiA==0x80 || uiB==0x80  || uiC==0x80 ){
+		SOFTPOSIT_STAT_NAR( p8 );
 		uZ.ui = 0x80;
 		return uZ.p;
 	}
@@ -188,6 +189,7 @@ posit8_t softposit_mulAddP8( uint_fast8_t uiA, uint_fast8_t uiB, uint_fast8_t ui
 		rcarry = 0x8000 & frac16Z; //first left bit
 		if(rcarry){
 			kZ ++;
+			if (frac16Z&0x1) bitsMore = 1;
 			frac16Z=(frac16Z>>1)&0x7FFF;
 		}
 		else {
@@ -220,6 +222,7 @@ posit8_t softposit_mulAddP8( uint_fast8_t uiA, uint_fast8_t uiB, uint_fast8_t ui
 	if(regZ>6){
 		//max or min pos. exp and frac does not matter.
 		(regSZ) ? (uZ.ui= 0x7F): (uZ.ui=0x1);
+		SOFTPOSIT_SATURATED( p8, regSZ, !regSZ || regZ>7 || (frac16Z&0x3FFF) || bitsMore );
 	}
 	else{
 		//remove hidden bits
@@ -230,6 +233,7 @@ posit8_t softposit_mulAddP8( uint_fast8_t uiA, uint_fast8_t uiB, uint_fast8_t ui
 		bitNPlusOne = ((frac16Z>>regZ) & 0x80);
 		uZ.ui = packToP8UI(regime, fracZ);
 
+		SOFTPOSIT_ROUNDED( p8, bitNPlusOne, bitsMore || ((frac16Z<<(9-regZ)) & 0xFFFF), uZ.ui&1 );
 		if (bitNPlusOne){
 			if ( (frac16Z<<(9-regZ)) &0xFFFF  ) bitsMore =1;
 			uZ.ui += (uZ.ui&1) | bitsMore;
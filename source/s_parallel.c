@@ -0,0 +1,99 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include "platform.h"
+#include "internals.h"
+
+typedef struct {
+	void (*body)( void *, int, int );
+	void * ctx;
+	int part, nParts;
+	uint_fast8_t flags;
+} s_parallelTask;
+
+static void * s_parallelEntry( void * arg ){
+	s_parallelTask * task = arg;
+
+	task->body( task->ctx, task->part, task->nParts );
+	task->flags = softposit_testFlags( softposit_flag_inexact );
+	return 0;
+}
+
+int softposit_threadCount( int nThreads ){
+	long online;
+
+	if (nThreads<=0){
+		online = sysconf( _SC_NPROCESSORS_ONLN );
+		nThreads = (online>0) ? (int) online : 1;
+	}
+	return (nThreads>SOFTPOSIT_MAXTHREADS) ? SOFTPOSIT_MAXTHREADS : nThreads;
+}
+
+/*----------------------------------------------------------------------------
+| Part 0 runs on the calling thread.  A part whose thread cannot be created
+| runs there too, after part 0, so the result never depends on how many
+| threads were actually obtained.  Flags raised by the workers are raised
+| in the calling thread as well.
+*----------------------------------------------------------------------------*/
+void softposit_parallelRun( int nThreads, void (*body)( void *, int, int ), void * ctx ){
+	pthread_t threads[SOFTPOSIT_MAXTHREADS];
+	s_parallelTask tasks[SOFTPOSIT_MAXTHREADS];
+	bool started[SOFTPOSIT_MAXTHREADS];
+	int nParts = softposit_threadCount( nThreads ), i;
+
+	for (i=1; i<nParts; i++){
+		tasks[i].body = body;
+		tasks[i].ctx = ctx;
+		tasks[i].part = i;
+		tasks[i].nParts = nParts;
+		started[i] = pthread_create( &threads[i], 0, s_parallelEntry, &tasks[i] )==0;
+	}
+	body( ctx, 0, nParts );
+	for (i=1; i<nParts; i++){
+		if (started[i]){
+			pthread_join( threads[i], 0 );
+			softposit_raiseFlags( tasks[i].flags );
+		}
+		else body( ctx, i, nParts );
+	}
+}
@@ -0,0 +1,161 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <pthread.h>
+#include <string.h>
+
+#include "platform.h"
+#include "internals.h"
+
+static const char * const s_statsOpNames[softposit_stat_nOps] = {
+	"add", "sub", "mul", "div", "mulAdd", "sqrt"
+};
+static const char * const s_statsWidthNames[softposit_stat_nWidths] = {
+	"p8", "p16", "p32", "p64", "pX"
+};
+
+#ifdef SOFTPOSIT_STATS
+/*----------------------------------------------------------------------------
+| Every thread that has counted anything is linked into a list so that
+| softposit_statsGet can sum the live counters.  A thread's counters are
+| folded into s_statsRetired when it exits, before its thread-local storage
+| goes away.
+*----------------------------------------------------------------------------*/
+typedef struct s_statsLink {
+	softposit_stats_t * stats;
+	struct s_statsLink * prev, * next;
+} s_statsLink;
+
+THREAD_LOCAL softposit_stats_t softposit_statsThread;
+THREAD_LOCAL bool softposit_statsRegistered;
+static THREAD_LOCAL s_statsLink s_statsSelf;
+
+static s_statsLink * s_statsHead;
+static softposit_stats_t s_statsRetired;
+static pthread_mutex_t s_statsLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t s_statsOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t s_statsKey;
+
+static void s_statsAdd( softposit_stats_t * z, const softposit_stats_t * a ){
+	uint64_t * uiZ = (uint64_t *) z;
+	const uint64_t * uiA = (const uint64_t *) a;
+	size_t i;
+
+	for (i=0; i<sizeof(softposit_stats_t)/sizeof(uint64_t); i++) uiZ[i] += uiA[i];
+}
+
+static void s_statsRetire( void * arg ){
+	s_statsLink * link = arg;
+
+	pthread_mutex_lock( &s_statsLock );
+	s_statsAdd( &s_statsRetired, link->stats );
+	if (link->prev) link->prev->next = link->next;
+	else s_statsHead = link->next;
+	if (link->next) link->next->prev = link->prev;
+	pthread_mutex_unlock( &s_statsLock );
+}
+
+static void s_statsCreateKey( void ){
+	pthread_key_create( &s_statsKey, s_statsRetire );
+}
+
+void softposit_statsRegister( void ){
+	pthread_once( &s_statsOnce, s_statsCreateKey );
+	s_statsSelf.stats = &softposit_statsThread;
+	s_statsSelf.prev = 0;
+	pthread_mutex_lock( &s_statsLock );
+	s_statsSelf.next = s_statsHead;
+	if (s_statsHead) s_statsHead->prev = &s_statsSelf;
+	s_statsHead = &s_statsSelf;
+	pthread_mutex_unlock( &s_statsLock );
+	pthread_setspecific( s_statsKey, &s_statsSelf );
+	softposit_statsRegistered = true;
+}
+
+void softposit_statsGet( softposit_stats_t * stats ){
+	s_statsLink * link;
+
+	pthread_mutex_lock( &s_statsLock );
+	*stats = s_statsRetired;
+	for (link=s_statsHead; link; link=link->next) s_statsAdd( stats, link->stats );
+	pthread_mutex_unlock( &s_statsLock );
+}
+
+void softposit_statsReset( void ){
+	s_statsLink * link;
+
+	pthread_mutex_lock( &s_statsLock );
+	memset( &s_statsRetired, 0, sizeof(softposit_stats_t) );
+	for (link=s_statsHead; link; link=link->next) memset( link->stats, 0, sizeof(softposit_stats_t) );
+	pthread_mutex_unlock( &s_statsLock );
+}
+#else
+void softposit_statsGet( softposit_stats_t * stats ){
+	memset( stats, 0, sizeof(softposit_stats_t) );
+}
+
+void softposit_statsReset( void ){
+}
+#endif
+
+//Prints call counts by operation and width, then NaR, saturation and rounding counts by width
+void softposit_statsPrint( FILE * f, const softposit_stats_t * stats ){
+	int op, w;
+
+	fprintf( f, "%-8s", "" );
+	for (w=0; w<softposit_stat_nWidths; w++) fprintf( f, "%16s", s_statsWidthNames[w] );
+	fputc( '\n', f );
+	for (op=0; op<softposit_stat_nOps; op++){
+		fprintf( f, "%-8s", s_statsOpNames[op] );
+		for (w=0; w<softposit_stat_nWidths; w++) fprintf( f, "%16llu", (unsigned long long) stats->calls[op][w] );
+		fputc( '\n', f );
+	}
+#define S_STATS_ROW( name, field ) \
+	fprintf( f, "%-8s", name ); \
+	for (w=0; w<softposit_stat_nWidths; w++) fprintf( f, "%16llu", (unsigned long long) stats->field[w] ); \
+	fputc( '\n', f );
+	S_STATS_ROW( "NaR", nar )
+	S_STATS_ROW( "maxpos", maxpos )
+	S_STATS_ROW( "minpos", minpos )
+	S_STATS_ROW( "up", roundUp )
+	S_STATS_ROW( "down", roundDown )
+	S_STATS_ROW( "exact", exact )
+#undef S_STATS_ROW
+}
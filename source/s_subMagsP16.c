@@ -42,11 +42,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "platform.h"
 #include "internals.h"
 
-#ifdef SOFTPOSIT_EXACT
-posit16_t softposit_subMagsP16( uint_fast16_t uiA, uint_fast16_t uiB, bool isExact){
-#else
 posit16_t softposit_subMagsP16( uint_fast16_t uiA, uint_fast16_t uiB ){
-#endif
 	uint_fast16_t regA;
 	uint_fast32_t frac32A, frac32B;
 	uint_fast16_t fracA=0, regime, tmp;
@@ -115,12 +111,16 @@ posit16_t softposit_subMagsP16( uint_fast16_t uiA, uint_fast16_t uiB ){
 
 	if (shiftRight!=0){
 		if (shiftRight>=29){
+			//A minus a sliver rounds back up to A
+			SOFTPOSIT_ROUNDED( p16, 1, 1, uiA&1 );
 			uZ.ui = uiA;
 			if (sign) uZ.ui = -uZ.ui & 0xFFFF;
 			return uZ.p;
 		}
-		else
+		else{
+			if (frac32B & ((1<<shiftRight)-1)) bitsMore=1;
 			frac32B >>= shiftRight;
+		}
 	}
 
 	frac32A -= frac32B;
@@ -150,9 +150,11 @@ posit16_t softposit_subMagsP16( uint_fast16_t uiA, uint_fast16_t uiB ){
 	if(regA>14){
 		//max or min pos. exp and frac does not matter.
 		(regSA) ? (uZ.ui= 0x7FFF): (uZ.ui=0x1);
+		SOFTPOSIT_SATURATED( p16, regSA, !regSA || regA>15 || expA || (frac32A&0x3FFFFFFF) || bitsMore );
 	}
 	else{
 		//remove hidden bits
+		if (frac32A & ((1<<(regA+1))-1)) bitsMore=1;
 		frac32A = (frac32A & 0x3FFFFFFF) >>(regA + 1) ;
 		fracA = frac32A>>16;
 		if (regA!=14) bitNPlusOne = (frac32A>>15) & 0x1;
@@ -162,6 +164,7 @@ posit16_t softposit_subMagsP16( uint_fast16_t uiA, uint_fast16_t uiB ){
 		}
 		if (regA==14 && expA) bitNPlusOne = 1;
 		uZ.ui = packToP16UI(regime, regA, expA, fracA);
+		SOFTPOSIT_ROUNDED( p16, bitNPlusOne, bitsMore || (frac32A & 0x7FFF), uZ.ui&1 );
 		if (bitNPlusOne){
 			if ( frac32A&0x7FFF ) bitsMore=1;
 			 //n+1 frac bit is 1. Need to check if another bit is 1 too if not round to even
@@ -0,0 +1,91 @@
+
+/*============================================================================
+This C source file is part of the SoftPosit Posit Arithmetic Package
+by S. H. Leong (Cerlane).
+
+Copyright 2017 2018 A*STAR.  All rights reserved.
+
+This C source file was based on SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3d, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014 The Regents of the University of California.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include "platform.h"
+#include "internals.h"
+
+//The operands carry opposite signs.  Bits of B shifted out below the
+//128-bit window are folded into one unit taken off the difference, so the
+//truncated result still rounds the right way.
+posit64_t softposit_subMagsP64( uint_fast64_t uiA, uint_fast64_t uiB ){
+	union ui64_p64 uZ;
+	uint_fast64_t sigA, sigB;
+	unsigned __int128 diff, lost;
+	int_fast32_t scaleA, scaleB, shiftRight;
+	int shiftLeft;
+	bool sign, sticky;
+
+	sign = signP64UI( uiA );
+	(sign) ? (uiA = -uiA) : (uiB = -uiB);
+
+	if (uiA==uiB){
+		uZ.ui = 0;
+		return uZ.p;
+	}
+	if (uiA<uiB){
+		uiA ^= uiB;
+		uiB ^= uiA;
+		uiA ^= uiB;
+		sign = !sign;
+	}
+	scaleA = softposit_decodeMagPX( uiA, 2, &sigA );
+	scaleB = softposit_decodeMagPX( uiB, 2, &sigB );
+
+	diff = (unsigned __int128) sigA << 63;
+	shiftRight = scaleA - scaleB;
+	if (shiftRight>126){
+		sticky = 1;
+	}
+	else{
+		lost = (unsigned __int128) sigB << 63;
+		sticky = (lost << (128-shiftRight-1) << 1) != 0;
+		diff -= lost >> shiftRight;
+	}
+	diff -= sticky;
+
+	//Normalise so that the leading one sits at bit 127
+	shiftLeft = (diff>>64) ? __builtin_clzll( (uint_fast64_t) (diff>>64) )
+			: 64 + __builtin_clzll( (uint_fast64_t) diff );
+	diff <<= shiftLeft;
+	sticky |= (uint_fast64_t) diff != 0;
+	uZ.ui = softposit_roundPackMagPXAt( scaleA + 1 - shiftLeft, (uint_fast64_t) (diff>>64), sticky, 64, 2, softposit_stat_p64 );
+	if (sign) uZ.ui = -uZ.ui;
+	return uZ.p;
+}
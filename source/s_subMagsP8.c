@@ -38,11 +38,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 
 
-#ifdef SOFTPOSIT_EXACT
-posit8_t softposit_subMagsP8( uint_fast8_t uiA, uint_fast8_t uiB, bool isExact){
-#else
 posit8_t softposit_subMagsP8( uint_fast8_t uiA, uint_fast8_t uiB ){
-#endif
 	uint_fast8_t regA;
 	uint_fast16_t frac16A, frac16B;
 	uint_fast8_t fracA=0, regime, tmp;
@@ -108,12 +104,16 @@ posit8_t softposit_subMagsP8( uint_fast8_t uiA, uint_fast8_t uiB ){
 
 
 	if (shiftRight>=14){
+		//A minus a sliver rounds back up to A
+		SOFTPOSIT_ROUNDED( p8, 1, 1, uiA&1 );
 		uZ.ui = uiA;
 		if (sign) uZ.ui = -uZ.ui & 0xFFFF;
 		return uZ.p;
 	}
-	else
+	else{
+		if (frac16B & ((1<<shiftRight)-1)) bitsMore=1;
 		frac16B >>= shiftRight;
+	}
 
 	frac16A -= frac16B;
 
@@ -141,13 +141,16 @@ posit8_t softposit_subMagsP8( uint_fast8_t uiA, uint_fast8_t uiB ){
 	if(regA>6){
 		//max or min pos. exp and frac does not matter.
 		(regSA) ? (uZ.ui= 0x7F): (uZ.ui=0x1);
+		SOFTPOSIT_SATURATED( p8, regSA, !regSA || regA>7 || (frac16A&0x3FFF) || bitsMore );
 	}
 	else{
+		if (frac16A & ((1<<regA)-1)) bitsMore=1;
 		frac16A = (frac16A&0x3FFF) >> regA;
 		fracA = (uint_fast8_t) (frac16A>>8);
 		bitNPlusOne = (0x80 & frac16A) ;
 		uZ.ui = packToP8UI(regime, fracA);
 
+		SOFTPOSIT_ROUNDED( p8, bitNPlusOne, bitsMore || (0x7F & frac16A), uZ.ui&1 );
 		if (bitNPlusOne){
 			if (0x7F & frac16A) bitsMore=1;
 			uZ.ui += (uZ.ui&1) | bitsMore;
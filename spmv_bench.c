@@ -0,0 +1,78 @@
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "softposit.h"
+
+//SpMV throughput on Matrix Market files (e.g. from the SuiteSparse collection):
+//  ./spmv_bench matrix.mtx [threads] [repeats]
+
+static double now(){
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + 1e-9*t.tv_nsec;
+}
+
+#define BENCH(N) \
+static void bench##N(const char *path, int threads, int repeats){ \
+	p##N##_csr_t A; \
+	p##N##_sell_t S; \
+	posit##N##_t *x, *y, *z; \
+	double t0, tCsr, tSell; \
+	uint64_t i, mismatches = 0; \
+	int r; \
+	\
+	if (p##N##_csr_readMatrixMarket(&A, path)) { \
+		perror(path); \
+		return; \
+	} \
+	if (p##N##_sell_fromCSR(&S, &A, 8, 256)) { \
+		perror("sell"); \
+		p##N##_csr_free(&A); \
+		return; \
+	} \
+	x = malloc(A.cols*sizeof *x + 1); \
+	y = malloc(A.rows*sizeof *y + 1); \
+	z = malloc(A.rows*sizeof *z + 1); \
+	for (i=0; i<A.cols; i++) \
+		x[i] = convertDoubleToP##N(1.0/(1 + i%7)); \
+	\
+	t0 = now(); \
+	for (r=0; r<repeats; r++) p##N##_csr_spmv(&A, x, y, threads); \
+	tCsr = (now() - t0)/repeats; \
+	t0 = now(); \
+	for (r=0; r<repeats; r++) p##N##_sell_spmv(&S, x, z, threads); \
+	tSell = (now() - t0)/repeats; \
+	for (i=0; i<A.rows; i++) mismatches += y[i].v!=z[i].v; \
+	/* NaR in x reaches only the rows that use that column */ \
+	if (A.cols) x[0].v = (uint##N##_t) 1 << (N-1); \
+	p##N##_csr_spmv(&A, x, y, threads); \
+	p##N##_sell_spmv(&S, x, z, threads); \
+	for (i=0; i<A.rows; i++) mismatches += y[i].v!=z[i].v; \
+	\
+	printf("posit%-2d %llu x %llu, %llu nnz: CSR %.3f ms (%.1f Mnnz/s), SELL-8-256 %.3f ms (%.1f Mnnz/s, %.2fx padding), %llu mismatches\n", \
+		N, (unsigned long long)A.rows, (unsigned long long)A.cols, (unsigned long long)A.nnz, \
+		1e3*tCsr, 1e-6*A.nnz/tCsr, 1e3*tSell, 1e-6*A.nnz/tSell, \
+		A.nnz ? (double)S.slicePtr[S.nSlices]/A.nnz : 1.0, (unsigned long long)mismatches); \
+	free(x); \
+	free(y); \
+	free(z); \
+	p##N##_sell_free(&S); \
+	p##N##_csr_free(&A); \
+}
+
+BENCH(16)
+BENCH(32)
+
+int main(int argc, char **argv) {
+
+	int threads = (argc>2) ? atoi(argv[2]) : 0;
+	int repeats = (argc>3) ? atoi(argv[3]) : 10;
+
+	if (argc<2) {
+		printf("usage: %s matrix.mtx [threads] [repeats]\n", argv[0]);
+		return 1;
+	}
+	bench16(argv[1], threads, repeats);
+	bench32(argv[1], threads, repeats);
+	return 0;
+}